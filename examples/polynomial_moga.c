@@ -41,7 +41,7 @@
   synopsis:	Fitness function.
   parameters:
   return:
-  updated:	07 Aug 2005
+  updated:	17 Oct 2026
  **********************************************************************/
 
 boolean polynomial_score(population *pop, entity *entity)
@@ -53,10 +53,11 @@ boolean polynomial_score(population *pop, entity *entity)
   C = ((double *)entity->chromosome[0])[2];
   D = ((double *)entity->chromosome[0])[3];
 
-  entity->fitvector[0] = fabs(0.75-A);
-  entity->fitvector[1] = fabs(0.95-B);
-  entity->fitvector[2] = fabs(0.23-C);
-  entity->fitvector[3] = fabs(0.71-D);
+/* Larger values are better, so the errors are negated. */
+  entity->fitvector[0] = -fabs(0.75-A);
+  entity->fitvector[1] = -fabs(0.95-B);
+  entity->fitvector[2] = -fabs(0.23-C);
+  entity->fitvector[3] = -fabs(0.71-D);
 
   entity->fitness = -(fabs(0.75-A)+SQU(0.95-B)+fabs(CUBE(0.23-C))+FOURTH_POW(0.71-D));
 
@@ -121,7 +122,7 @@ boolean polynomial_seed(population *pop, entity *adam)
   synopsis:	Main function.
   parameters:
   return:
-  updated:	07 Aug 2005
+  updated:	17 Oct 2026
  **********************************************************************/
 
 int main(int argc, char **argv)
@@ -210,6 +211,46 @@ int main(int argc, char **argv)
 
   ga_extinction(pop);
 
+/* "Pareto Fronts" (NSGA-II style) Multiobjective GA. */
+  printf("Using the Pareto Fronts Multiobjective GA varient.\n");
+
+  pop = ga_genesis_double(
+       100,			/* const int              population_size */
+       1,			/* const int              num_chromo */
+       4,			/* const int              len_chromo */
+       polynomial_generation_callback,/* GAgeneration_hook      generation_hook */
+       NULL,			/* GAiteration_hook       iteration_hook */
+       NULL,			/* GAdata_destructor      data_destructor */
+       NULL,			/* GAdata_ref_incrementor data_ref_incrementor */
+       polynomial_score,		/* GAevaluate             evaluate */
+       polynomial_seed,		/* GAseed                 seed */
+       NULL,			/* GAadapt                adapt */
+       ga_select_one_bestof2,	/* GAselect_one           select_one */
+       ga_select_two_bestof2,	/* GAselect_two           select_two */
+       ga_mutate_double_singlepoint_drift,	/* GAmutate               mutate */
+       ga_crossover_double_doublepoints,	/* GAcrossover            crossover */
+       NULL,			/* GAreplace              replace */
+       NULL			/* vpointer	User data */
+            );
+
+  ga_population_set_parameters(
+       pop,				/* population      *pop */
+       GA_SCHEME_DARWIN,		/* const ga_scheme_type     scheme */
+       GA_ELITISM_PARETO_FRONTS_SURVIVE,	/* const ga_elitism_type   elitism */
+       0.8,				/* double  crossover */
+       0.2,				/* double  mutation */
+       0.0      		        /* double  migration */
+                              );
+
+  ga_population_set_fitness_dimensions(pop, 4);
+
+  ga_evolution(
+       pop,				/* population	*pop */
+       200				/* const int	max_generations */
+              );
+
+  ga_extinction(pop);
+
   exit(EXIT_SUCCESS);
   }
 
@@ -33,13 +33,27 @@
 
   To do:	Mappings.
 
-  FIXME:	Performance of gray encoding/decoding is dreadful now
-  		that it uses malloc/free.
-
  **********************************************************************/
 
 #include "gaul/ga_bitstring.h"
 
+/*
+ * The kernels are small, and must be inlined into the variants
+ * compiled for particular instruction sets.
+ */
+#ifdef __GNUC__
+# define GA_BIT_INLINE		static inline __attribute__((always_inline))
+#else
+# define GA_BIT_INLINE		static
+#endif
+
+#define GA_BIT_WORDBITS		((int) (GA_BIT_WORDBYTES*BYTEBITS))
+
+/*
+ * Size of work space for bits in transit, in bytes.
+ */
+#define GA_BIT_BUFFER		256
+
 /**********************************************************************
   ga_bit_new()
   synopsis:	Create a new bitstring.
@@ -161,51 +175,6 @@ GAULFUNC void ga_bit_randomize( gaulbyte *bstr, int n )
   }
 
 
-/**********************************************************************
-  ga_bit_copy()
-  synopsis:	Copies a set of bits in a bitstring.
-		If dest and src are the same, overlapping sequences
-		of bits are safely handled.
- 
-		FIXME: Should use memcpy, when appropriate.
-  parameters:	gaulbyte	*dest	Destination bitstring.
-		gaulbyte	*src	Source bitstring
-		int	ndest	Initial bit index of destination bits.
-		int	nsrc	Initial bit index of source bits.
-		int	length	Number of bits to copy.
-  return:	none
-  last updated:	29 Jun 2003
- **********************************************************************/
-
-GAULFUNC void ga_bit_copy( gaulbyte *dest, gaulbyte *src, int ndest, int nsrc, int length )
-  {
-  int i;
-
-  if (dest != src || ndest < nsrc)
-    {
-    for ( i=0; i < length; ++i )
-      {
-      if ( ga_bit_get(src, nsrc+i) )
-        ga_bit_set( dest, ndest+i );
-      else
-        ga_bit_clear( dest, ndest+i );
-      }
-    }
-  else
-    {
-    for ( i = length-1 ; i >= 0; --i )
-      {
-      if ( ga_bit_get(src, nsrc+i) )
-        ga_bit_set( dest, ndest+i );
-      else
-        ga_bit_clear( dest, ndest+i );
-      }
-    }
-
-  return;
-  }
-
-
 /**********************************************************************
   ga_bit_sizeof()
   synopsis:	Return the size required for the given number of
@@ -243,178 +212,213 @@ GAULFUNC gaulbyte *ga_bit_clone( gaulbyte *dest, gaulbyte *src, int length )
 
 
 /**********************************************************************
-  ga_bit_decode_binary_uint()
-  synopsis:	Convert a binary-encoded bitstring into an unsigned int
-		starting at a given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  Bit manipulation kernels.
+
+  These operate on runs of bits a word at a time.  Words are
+  assembled from bytes explicitly, so that bit n of a word is always
+  bit n of the bitstring, whatever the byte order of the processor;
+  compilers reduce this to single loads and stores where possible.
  **********************************************************************/
 
-GAULFUNC unsigned int ga_bit_decode_binary_uint( gaulbyte *bstr, int n, int length )
+/**********************************************************************
+  gaul_bit_load()
+  synopsis:	Read a word from a bitstring at any byte.
+  parameters:	const gaulbyte	*bstr	First byte of word.
+  return:	ga_bit_word	The word.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE ga_bit_word gaul_bit_load( const gaulbyte *bstr )
   {
-  int		i;
-  unsigned int	value=0;	/* Decoded value. */
+  ga_bit_word	word=0;		/* The word. */
+  int		k;		/* Loop over bytes. */
 
-  for ( i=n; i < n+length; i++ )
-    {
-    value <<= 1;
-    value |= ga_bit_get(bstr, i);
-    }
+  for (k=(int)GA_BIT_WORDBYTES-1; k>=0; k--)
+    word = (word << BYTEBITS) | bstr[k];
 
-  return value;
+  return word;
   }
 
 
 /**********************************************************************
-  ga_bit_encode_binary_uint()
-  synopsis:	Convert an unsigned int into a binary-encoded bitstring
-		starting at a given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  gaul_bit_store()
+  synopsis:	Write a word to a bitstring at any byte.
+  parameters:	gaulbyte	*bstr	First byte of word.
+		ga_bit_word	word	The word.
+  return:	none
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-GAULFUNC void ga_bit_encode_binary_uint( gaulbyte *bstr, int n, int length, unsigned int value )
+GA_BIT_INLINE void gaul_bit_store( gaulbyte *bstr, ga_bit_word word )
   {
-  int i;
-
-  /* Set bits in _reverse_ order. */
-  for ( i = n+length-1; i >= n; i-- )
-    {
-    if ( value & 1 )
-      ga_bit_set( bstr, i );
-    else
-      ga_bit_clear( bstr, i );
+  int		k;		/* Loop over bytes. */
 
-    value >>= 1;
-    }
+  for (k=0; k<(int)GA_BIT_WORDBYTES; k++)
+    bstr[k] = (gaulbyte) (word >> (k*BYTEBITS));
 
   return;
   }
 
 
 /**********************************************************************
-  ga_bit_decode_binary_int()
-  synopsis:	Convert a binary-encoded bitstring into a signed int
-		starting at a given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  gaul_bit_copy_forward()
+  synopsis:	Copy a run of bits, lowest first.  Bits are copied
+		singly until the destination is byte aligned, then a
+		byte or word at a time, shifting the source as
+		required.  This is safe for overlapping runs within
+		a bitstring only if ndest <= nsrc.
+  parameters:	gaulbyte	*dest	Destination bitstring.
+		const gaulbyte	*src	Source bitstring.
+		int	ndest	Initial bit index of destination bits.
+		int	nsrc	Initial bit index of source bits.
+		int	length	Number of bits to copy.
+  return:	none
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-GAULFUNC int ga_bit_decode_binary_int( gaulbyte *bstr, int n, int length )
+static void gaul_bit_copy_forward( gaulbyte *dest, const gaulbyte *src,
+                                   int ndest, int nsrc, int length )
   {
-  if ( ga_bit_get( bstr, n ) )
-    return - (int) ga_bit_decode_binary_uint( bstr, n+1, length-1 );
-  else
-    return (int) ga_bit_decode_binary_uint( bstr, n+1, length-1 );
-  }
+  gaulbyte	*d;		/* Current destination byte. */
+  const gaulbyte *s;		/* Current source byte. */
+  int		shift;		/* Offset of source bits within bytes. */
+  ga_bit_word	word;		/* Bits in transit. */
+  gaulbyte	mask;		/* Bits of final byte to replace. */
 
+  while (length > 0 && ndest%BYTEBITS != 0)
+    {
+    if (src[nsrc/BYTEBITS] & (1 << (nsrc%BYTEBITS)))
+      dest[ndest/BYTEBITS] |= 1 << (ndest%BYTEBITS);
+    else
+      dest[ndest/BYTEBITS] &= ~(1 << (ndest%BYTEBITS));
+    ndest++;
+    nsrc++;
+    length--;
+    }
 
-/**********************************************************************
-  ga_bit_encode_binary_int()
-  synopsis:	Convert a signed int into a binary-encoded bitstring
-		starting at a given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
- **********************************************************************/
+  if (length <= 0) return;
 
-GAULFUNC void ga_bit_encode_binary_int( gaulbyte *bstr, int n, int length, int value )
-  {
-  if ( value < 0 )
+  d = &(dest[ndest/BYTEBITS]);
+  s = &(src[nsrc/BYTEBITS]);
+  shift = nsrc%BYTEBITS;
+
+  if (shift == 0)
     {
-    ga_bit_set( bstr, n );
-    value = -value;
+    memmove(d, s, length/BYTEBITS);
+    d += length/BYTEBITS;
+    s += length/BYTEBITS;
+    length %= BYTEBITS;
     }
   else
     {
-    ga_bit_clear( bstr, n );
+    for ( ; length >= GA_BIT_WORDBITS; length -= GA_BIT_WORDBITS)
+      {
+      word = (gaul_bit_load(s) >> shift) |
+             ((ga_bit_word) s[GA_BIT_WORDBYTES] << (GA_BIT_WORDBITS-shift));
+      gaul_bit_store(d, word);
+      d += GA_BIT_WORDBYTES;
+      s += GA_BIT_WORDBYTES;
+      }
+
+    for ( ; length >= BYTEBITS; length -= BYTEBITS)
+      {
+      *d = (gaulbyte) ((s[0] >> shift) | (s[1] << (BYTEBITS-shift)));
+      d++;
+      s++;
+      }
     }
 
-  ga_bit_encode_binary_uint( bstr, n+1, length-1, (unsigned int) value );
+/* Final, partial, byte.  Don't read beyond the source bits. */
+  if (length > 0)
+    {
+    word = s[0] >> shift;
+    if (shift+length > BYTEBITS) word |= (ga_bit_word) s[1] << (BYTEBITS-shift);
+    mask = (gaulbyte) ((1 << length) - 1);
+    *d = (gaulbyte) ((*d & ~mask) | (word & mask));
+    }
 
   return;
   }
 
 
 /**********************************************************************
-  gray_to_binary()
-  synopsis:	Convert a Gray-encoded bitstring into a binary-encoded
-		bitstring.
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  ga_bit_copy()
+  synopsis:	Copies a set of bits in a bitstring.
+		If dest and src are the same, overlapping sequences
+		of bits are safely handled.  Where a run must be
+		copied highest first, it is moved through a small
+		buffer, a section at a time.
+  parameters:	gaulbyte	*dest	Destination bitstring.
+		gaulbyte	*src	Source bitstring
+		int	ndest	Initial bit index of destination bits.
+		int	nsrc	Initial bit index of source bits.
+		int	length	Number of bits to copy.
+  return:	none
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-static void gray_to_binary( gaulbyte *gray_bstr, int n, gaulbyte *int_bstr, int length )
+GAULFUNC void ga_bit_copy( gaulbyte *dest, gaulbyte *src, int ndest, int nsrc, int length )
   {
-  boolean	bit;
-  int		i;
+  gaulbyte	buffer[GA_BIT_BUFFER];	/* Bits in transit. */
+  int		section;		/* Number of bits in transit. */
 
-  bit = ga_bit_get( gray_bstr, n );
-  if (bit)
-    ga_bit_set( int_bstr, 0 );
-  else
-    ga_bit_clear( int_bstr, 0 );
-
-  for ( i=1; i<length; i++ )
+  if (dest != src || ndest <= nsrc || ndest >= nsrc+length)
     {
-    if (bit)
-      bit = !ga_bit_get( gray_bstr, n+i );
-    else
-      bit = ga_bit_get( gray_bstr, n+i );
+    gaul_bit_copy_forward(dest, src, ndest, nsrc, length);
+    return;
+    }
 
-    if (bit)
-      ga_bit_set( int_bstr, i );
-    else
-      ga_bit_clear( int_bstr, i );
-    }  
+  while (length > 0)
+    {
+    section = MIN(length, GA_BIT_BUFFER*BYTEBITS);
+    length -= section;
+    gaul_bit_copy_forward(buffer, src, 0, nsrc+length, section);
+    gaul_bit_copy_forward(dest, buffer, ndest+length, 0, section);
+    }
 
   return;
   }
 
 
 /**********************************************************************
-  binary_to_gray()
-  synopsis:	Convert a binary-encoded bitstring into a gray-encoded
-		bitstring.
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  gaul_bit_fill()
+  synopsis:	Set or clear a run of bits.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+		boolean	value	The new state of the bits.
+  return:	none
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-static void binary_to_gray( gaulbyte *gray_bstr, int n, gaulbyte *int_bstr, int length )
+static void gaul_bit_fill( gaulbyte *bstr, int n, int length, boolean value )
   {
-  boolean	bit;
-  int		i;
+  gaulbyte	mask;		/* Bits of partial byte to change. */
+  int		num_bits;	/* Bits in partial byte. */
 
-  bit = ga_bit_get( int_bstr, 0 );
-  if (bit)
-    ga_bit_set( gray_bstr, n );
-  else
-    ga_bit_clear( gray_bstr, n );
+  if (length <= 0) return;
 
-  for ( i=1; i < length; i++ )
+  if (n%BYTEBITS != 0)
     {
+    num_bits = MIN(length, BYTEBITS-n%BYTEBITS);
+    mask = (gaulbyte) (((1 << num_bits) - 1) << (n%BYTEBITS));
+    if (value)
+      bstr[n/BYTEBITS] |= mask;
+    else
+      bstr[n/BYTEBITS] &= ~mask;
+    n += num_bits;
+    length -= num_bits;
+    }
 
-    if (bit)
-      {
-      bit = ga_bit_get( int_bstr, i );
-      if (bit)
-        ga_bit_clear( gray_bstr, n+i );
-      else
-        ga_bit_set( gray_bstr, n+i );
-      }
+  memset(&(bstr[n/BYTEBITS]), value?0xFF:0x00, length/BYTEBITS);
+
+  if (length%BYTEBITS)
+    {
+    mask = (gaulbyte) ((1 << (length%BYTEBITS)) - 1);
+    if (value)
+      bstr[(n+length)/BYTEBITS] |= mask;
     else
-      {
-      bit = ga_bit_get( int_bstr, i );
-      if (bit)
-        ga_bit_set( gray_bstr, n+i );
-      else
-        ga_bit_clear( gray_bstr, n+i );
-      }
+      bstr[(n+length)/BYTEBITS] &= ~mask;
     }
 
   return;
@@ -422,197 +426,1254 @@ static void binary_to_gray( gaulbyte *gray_bstr, int n, gaulbyte *int_bstr, int
 
 
 /**********************************************************************
-  ga_bit_decode_gray_int()
-  synopsis:	Convert a gray-encoded bitstring into a signed int
-		starting at a given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  ga_bit_set_range()
+  synopsis:	Sets a run of bits in a bitstring.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+  return:	none
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-GAULFUNC int ga_bit_decode_gray_int( gaulbyte *bstr, int n, int length )
+GAULFUNC void ga_bit_set_range( gaulbyte *bstr, int n, int length )
   {
-  gaulbyte		*int_bstr;
-  int		val;
+  gaul_bit_fill( bstr, n, length, TRUE );
 
-  if ( !(int_bstr = (gaulbyte *) s_malloc( ga_bit_sizeof( length ) )) )
-    die("Unable to allocate bitstring.");
+  return;
+  }
 
-  gray_to_binary( bstr, n, int_bstr, length );
 
-  val = ga_bit_decode_binary_int( int_bstr, 0, length );
+/**********************************************************************
+  ga_bit_clear_range()
+  synopsis:	Unsets a run of bits in a bitstring.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
 
-  s_free(int_bstr);
+GAULFUNC void ga_bit_clear_range( gaulbyte *bstr, int n, int length )
+  {
+  gaul_bit_fill( bstr, n, length, FALSE );
 
-  return val;
+  return;
   }
 
 
 /**********************************************************************
-  ga_bit_decode_gray_uint()
-  synopsis:	Convert a gray-encoded bitstring into an unsigned int
-		starting at a given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  ga_bit_randomize_range()
+  synopsis:	Randomly sets the state of a run of bits in a
+		bitstring.  Random bits are generated a word at a
+		time, using random_fill_bitmask(), and then copied
+		into place.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+  return:	none
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-GAULFUNC unsigned int ga_bit_decode_gray_uint( gaulbyte *bstr, int n, int length )
+GAULFUNC void ga_bit_randomize_range( gaulbyte *bstr, int n, int length )
   {
-  gaulbyte		*int_bstr;
-  unsigned int	val;
+  gaulbyte	buffer[GA_BIT_BUFFER];	/* Random bits. */
+  int		section;		/* Number of bits in buffer. */
 
-  if ( !(int_bstr = (gaulbyte *) s_malloc( ga_bit_sizeof( length ) )) )
-    die("Unable to allocate bitstring.");
+  while (length > 0)
+    {
+    section = MIN(length, GA_BIT_BUFFER*BYTEBITS);
+    random_fill_bitmask(buffer, section, 0.5);
+    gaul_bit_copy_forward(bstr, buffer, n, 0, section);
+    n += section;
+    length -= section;
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_bit_blend()
+  synopsis:	Combine two bitstrings under a mask.  Each bit of the
+		destination is taken from alpha where the mask is set,
+		and from beta otherwise.  This is the basis of uniform
+		crossover.  The destination may be either of the
+		sources.
+  parameters:	gaulbyte	*dest	Destination bitstring.
+		gaulbyte	*alpha	Bits where mask is set.
+		gaulbyte	*beta	Bits where mask is unset.
+		gaulbyte	*mask	The mask.
+		int	length	Number of bits in bitstrings.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
 
-  gray_to_binary( bstr, n, int_bstr, length );
+GAULFUNC void ga_bit_blend( gaulbyte *dest, gaulbyte *alpha, gaulbyte *beta,
+                            gaulbyte *mask, int length )
+  {
+  int		num_bytes=(int) ga_bit_sizeof(length);	/* Number of bytes. */
+  ga_bit_word	m;			/* Current word of mask. */
+  int		i;			/* Byte offset. */
 
-  val = ga_bit_decode_binary_uint( int_bstr, 0, length );
+  for (i=0; i+(int)GA_BIT_WORDBYTES <= num_bytes; i+=GA_BIT_WORDBYTES)
+    {
+    m = gaul_bit_load(&(mask[i]));
+    gaul_bit_store(&(dest[i]), (gaul_bit_load(&(alpha[i])) & m) |
+                               (gaul_bit_load(&(beta[i])) & ~m));
+    }
 
-  s_free(int_bstr);
+  for ( ; i<num_bytes; i++)
+    dest[i] = (gaulbyte) ((alpha[i] & mask[i]) | (beta[i] & ~mask[i]));
 
-  return val;
+  return;
   }
 
 
 /**********************************************************************
-  ga_bit_encode_gray_uint()
-  synopsis:	Convert an unsigned int into a gray-encoded bitstring
-		starting at a given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  Population count kernels.
+
+  These count the bits set in a bitstring, or in the combination of
+  two bitstrings, a word at a time.  On x86, when compiled with GCC,
+  the POPCNT, AVX2 or AVX-512 VPOPCNTDQ instructions are used if the
+  processor supports them.  Each kernel counts whole bytes only.
  **********************************************************************/
 
-GAULFUNC void ga_bit_encode_gray_uint( gaulbyte *bstr, int n, int length, unsigned int value )
+#ifdef GA_BIT_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+typedef enum ga_bit_op_t
   {
-  gaulbyte	*int_bstr;
+  GA_BIT_OP_NONE, GA_BIT_OP_AND, GA_BIT_OP_XOR
+  } ga_bit_op;
 
-  if ( !(int_bstr = (gaulbyte *) s_malloc( ga_bit_sizeof( length ) )) )
-    die("Unable to allocate bitstring.");
+#ifdef __GNUC__
+# define GA_BIT_POPCOUNT(x)	__builtin_popcountl(x)
+#else
+# define GA_BIT_POPCOUNT(x)	gaul_bit_popcount(x)
+#endif
 
-  ga_bit_encode_binary_uint( int_bstr, 0, length, value );
-  binary_to_gray( bstr, n, int_bstr, length );
+/**********************************************************************
+  gaul_bit_popcount()
+  synopsis:	Count the bits set in a word, in parallel within the
+		word.  This is used by compilers which don't provide
+		a popcount builtin.
+  parameters:	ga_bit_word	x	The word.
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
+ **********************************************************************/
 
-  s_free(int_bstr);
+#ifndef __GNUC__
+static int gaul_bit_popcount( ga_bit_word x )
+  {
+  x -= (x >> 1) & (~(ga_bit_word)0/3);
+  x = (x & (~(ga_bit_word)0/5)) + ((x >> 2) & (~(ga_bit_word)0/5));
+  x = (x + (x >> 4)) & (~(ga_bit_word)0/17);
 
-  return;
+  return (int) ((x * (~(ga_bit_word)0/255)) >> ((GA_BIT_WORDBYTES-1)*BYTEBITS));
   }
+#endif
 
 
 /**********************************************************************
-  ga_bit_encode_gray_int()
-  synopsis:	Convert an unsigned int into a gray-encoded bitstring
-		starting at a given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  gaul_bit_count_words()
+  synopsis:	Portable population count kernel.  Unaligned words
+		are read with memcpy(), which compilers reduce to a
+		single load.
+  parameters:	const gaulbyte	*alpha	First bitstring.
+		const gaulbyte	*beta	Second bitstring, unless op is GA_BIT_OP_NONE.
+		ga_bit_op	op	Combination of bitstrings.
+		int	num_bytes	Number of bytes to count.
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-GAULFUNC void ga_bit_encode_gray_int( gaulbyte *bstr, int n, int length, int value )
+GA_BIT_INLINE int gaul_bit_count_words( const gaulbyte *alpha, const gaulbyte *beta,
+                                        const ga_bit_op op, const int num_bytes )
   {
-  gaulbyte	*int_bstr;
-
-  if ( !(int_bstr = (gaulbyte *) s_malloc( ga_bit_sizeof( length ) )) )
-    die("Unable to allocate bitstring.");
+  ga_bit_word	a, b;		/* Current words. */
+  int		i;		/* Byte offset. */
+  int		count=0;	/* Number of bits set. */
 
-  ga_bit_encode_binary_int( int_bstr, 0, length, value );
-  binary_to_gray( bstr, n, int_bstr, length );
+  for (i=0; i+(int)GA_BIT_WORDBYTES <= num_bytes; i+=GA_BIT_WORDBYTES)
+    {
+    memcpy(&a, &(alpha[i]), GA_BIT_WORDBYTES);
+    if (op != GA_BIT_OP_NONE)
+      {
+      memcpy(&b, &(beta[i]), GA_BIT_WORDBYTES);
+      a = op==GA_BIT_OP_AND?a&b:a^b;
+      }
+    count += GA_BIT_POPCOUNT(a);
+    }
 
-  s_free(int_bstr);
+  for ( ; i<num_bytes; i++)
+    {
+    a = alpha[i];
+    if (op != GA_BIT_OP_NONE)
+      a = op==GA_BIT_OP_AND?a&beta[i]:a^beta[i];
+    count += GA_BIT_POPCOUNT(a);
+    }
 
-  return;
+  return count;
   }
 
 
 /**********************************************************************
-  ga_bit_decode_binary_real()
-  synopsis:	Convert a binary-encoded bitstring at a given offset
-		into a real. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  gaul_bit_count_generic()
+  synopsis:	Population count kernel for any processor.
+  parameters:	As gaul_bit_count_words().
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-GAULFUNC double ga_bit_decode_binary_real( gaulbyte *bstr, int n, int mantissa, int exponent )
+static int gaul_bit_count_generic( const gaulbyte *alpha, const gaulbyte *beta,
+                                   const ga_bit_op op, const int num_bytes )
   {
-  double	value;
-  int		int_mantissa, int_exponent;
+  return gaul_bit_count_words(alpha, beta, op, num_bytes);
+  }
 
-  int_mantissa = ga_bit_decode_binary_int( bstr, n, mantissa );
-  int_exponent = ga_bit_decode_binary_int( bstr, n+mantissa, exponent );
 
-  value = ((double)int_mantissa) / ((double)(1<<(mantissa-1)))
-          * pow( 2.0, (double) int_exponent );
+#ifdef GA_BIT_X86_DISPATCH
+/**********************************************************************
+  gaul_bit_count_popcnt()
+  synopsis:	Population count kernel using the POPCNT instruction.
+  parameters:	As gaul_bit_count_words().
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
+ **********************************************************************/
 
-  return value;        
+__attribute__((target("popcnt")))
+static int gaul_bit_count_popcnt( const gaulbyte *alpha, const gaulbyte *beta,
+                                  const ga_bit_op op, const int num_bytes )
+  {
+  return gaul_bit_count_words(alpha, beta, op, num_bytes);
   }
 
 
 /**********************************************************************
-  ga_bit_encode_binary_real()
-  synopsis:	Convert a real into a binary-encoded bitstring at a
-                given offset. 
-  parameters:
-  return:
-  last updated: 08 Jan 2003
+  gaul_bit_count_avx2()
+  synopsis:	Population count kernel using AVX2.  Each nibble is
+		counted by a table lookup with VPSHUFB, and the byte
+		counts are summed with VPSADBW, as described by Mula,
+		Kurz and Lemire.
+  parameters:	As gaul_bit_count_words().
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
+  references:	Mula W., Kurz N., Lemire D., "Faster Population Counts
+		Using AVX2 Instructions", Comput. J. 61:111-120 (2018)
  **********************************************************************/
 
-GAULFUNC void ga_bit_encode_binary_real( gaulbyte *bstr, int n, int mantissa, int exponent, double value )
+__attribute__((target("avx2,popcnt")))
+static int gaul_bit_count_avx2( const gaulbyte *alpha, const gaulbyte *beta,
+                                const ga_bit_op op, const int num_bytes )
   {
-  int int_mantissa, int_exponent;
+  const __m256i	table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i	low = _mm256_set1_epi8(0x0F);
+  __m256i	sum = _mm256_setzero_si256();	/* Counts in 64-bit lanes. */
+  __m256i	a, b;				/* Current blocks. */
+  __m256i	bytes;				/* Counts of each byte. */
+  long long	lanes[4];			/* Lanes of sum. */
+  int		i;				/* Byte offset. */
+
+  for (i=0; i+32 <= num_bytes; i+=32)
+    {
+    a = _mm256_loadu_si256((const __m256i *) &(alpha[i]));
+    if (op != GA_BIT_OP_NONE)
+      {
+      b = _mm256_loadu_si256((const __m256i *) &(beta[i]));
+      a = op==GA_BIT_OP_AND?_mm256_and_si256(a, b):_mm256_xor_si256(a, b);
+      }
+    bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(a, low)),
+                            _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(a, 4), low)));
+    sum = _mm256_add_epi64(sum, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+    }
 
-  int_mantissa = (int) floor(frexp( value, &int_exponent ) * (double)(1<<(mantissa-1)));
-  ga_bit_encode_binary_int( bstr, n, mantissa, int_mantissa );
-  ga_bit_encode_binary_int( bstr, n+mantissa, exponent, int_exponent );
+  _mm256_storeu_si256((__m256i *) lanes, sum);
 
-  return;
+  return (int) (lanes[0]+lanes[1]+lanes[2]+lanes[3]) +
+         gaul_bit_count_words(&(alpha[i]), op==GA_BIT_OP_NONE?NULL:&(beta[i]), op, num_bytes-i);
   }
 
 
 /**********************************************************************
-  ga_bit_decode_gray_real()
-  synopsis:	Convert a Gray-encoded bitstring at a given offset
-		into a real. 
-  parameters:
-  return:
-  last updated: 25 Jul 2003
+  gaul_bit_count_avx512()
+  synopsis:	Population count kernel using AVX-512 VPOPCNTQ.
+  parameters:	As gaul_bit_count_words().
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-GAULFUNC double ga_bit_decode_gray_real( gaulbyte *bstr, int n, int mantissa, int exponent )
+__attribute__((target("avx512f,avx512vpopcntdq,popcnt")))
+static int gaul_bit_count_avx512( const gaulbyte *alpha, const gaulbyte *beta,
+                                  const ga_bit_op op, const int num_bytes )
   {
-  double	value;
-  int		int_mantissa, int_exponent;
+  __m512i	sum = _mm512_setzero_si512();	/* Counts in 64-bit lanes. */
+  __m512i	a, b;				/* Current blocks. */
+  int		i;				/* Byte offset. */
+
+  for (i=0; i+64 <= num_bytes; i+=64)
+    {
+    a = _mm512_loadu_si512((const void *) &(alpha[i]));
+    if (op != GA_BIT_OP_NONE)
+      {
+      b = _mm512_loadu_si512((const void *) &(beta[i]));
+      a = op==GA_BIT_OP_AND?_mm512_and_si512(a, b):_mm512_xor_si512(a, b);
+      }
+    sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(a));
+    }
 
-  int_mantissa = ga_bit_decode_gray_int( bstr, n, mantissa );
-  int_exponent = ga_bit_decode_gray_int( bstr, n+mantissa, exponent );
+  return (int) _mm512_reduce_add_epi64(sum) +
+         gaul_bit_count_words(&(alpha[i]), op==GA_BIT_OP_NONE?NULL:&(beta[i]), op, num_bytes-i);
+  }
+#endif
+
+
+/**********************************************************************
+  gaul_bit_count_bytes()
+  synopsis:	Select the best population count kernel for this
+		processor.  The vector kernels are only worthwhile
+		for longer bitstrings.
+  parameters:	As gaul_bit_count_words().
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
+ **********************************************************************/
 
-  value = pow( 2.0, (double) int_exponent ) *
-          ((double)int_mantissa) / ((double)(1<<(mantissa-1)));
+static int gaul_bit_count_bytes( const gaulbyte *alpha, const gaulbyte *beta,
+                                 const ga_bit_op op, const int num_bytes )
+  {
+#ifdef GA_BIT_X86_DISPATCH
+  if (num_bytes >= 128)
+    {
+    if (__builtin_cpu_supports("avx512vpopcntdq"))
+      return gaul_bit_count_avx512(alpha, beta, op, num_bytes);
+    if (__builtin_cpu_supports("avx2"))
+      return gaul_bit_count_avx2(alpha, beta, op, num_bytes);
+    }
+  if (__builtin_cpu_supports("popcnt"))
+    return gaul_bit_count_popcnt(alpha, beta, op, num_bytes);
+#endif
 
-  return value;        
+  return gaul_bit_count_generic(alpha, beta, op, num_bytes);
   }
 
 
 /**********************************************************************
-  ga_bit_encode_gray_real()
-  synopsis:	Convert a real into a Gray-encoded bitstring at a
-                given offset. 
-  parameters:
-  return:
-  last updated: 25 Jul 2003
+  gaul_bit_count()
+  synopsis:	Count the bits set in a bitstring, or in the
+		combination of two bitstrings.  Any bits beyond the
+		given length, in the final byte, are ignored.
+  parameters:	As gaul_bit_count_words(), except:
+		int	length	Number of bits to count.
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-GAULFUNC void ga_bit_encode_gray_real( gaulbyte *bstr, int n, int mantissa, int exponent, double value )
+static int gaul_bit_count( const gaulbyte *alpha, const gaulbyte *beta,
+                           const ga_bit_op op, const int length )
   {
-  int int_mantissa, int_exponent;
+  int		num_bytes=length/BYTEBITS;	/* Number of whole bytes. */
+  int		count;				/* Number of bits set. */
+  gaulbyte	tail;				/* Final, partial, byte. */
+
+  count = gaul_bit_count_bytes(alpha, beta, op, num_bytes);
+
+  if (length%BYTEBITS)
+    {
+    tail = alpha[num_bytes];
+    if (op != GA_BIT_OP_NONE)
+      tail = op==GA_BIT_OP_AND?tail&beta[num_bytes]:tail^beta[num_bytes];
+    tail &= (1 << (length%BYTEBITS)) - 1;
+    count += gaul_bit_count_words(&tail, NULL, GA_BIT_OP_NONE, 1);
+    }
 
-  int_mantissa = (int) floor(frexp( value, &int_exponent ) * (double)(1<<(mantissa-1)));
+  return count;
+  }
 
-  ga_bit_encode_gray_int( bstr, n, mantissa, int_mantissa );
-  ga_bit_encode_gray_int( bstr, n+mantissa, exponent, int_exponent );
 
-  return;
+/**********************************************************************
+  ga_bit_count()
+  synopsis:	Count the bits set in a bitstring.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	length	Number of bits in bitstring.
+  return:	int	Number of bits set.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_count( gaulbyte *bstr, int length )
+  {
+  return gaul_bit_count(bstr, NULL, GA_BIT_OP_NONE, length);
+  }
+
+
+/**********************************************************************
+  ga_bit_count_and()
+  synopsis:	Count the bits set in both of two bitstrings.
+  parameters:	gaulbyte	*alpha	First bitstring.
+		gaulbyte	*beta	Second bitstring.
+		int	length	Number of bits in bitstrings.
+  return:	int	Number of bits set in both.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_count_and( gaulbyte *alpha, gaulbyte *beta, int length )
+  {
+  return gaul_bit_count(alpha, beta, GA_BIT_OP_AND, length);
+  }
+
+
+/**********************************************************************
+  ga_bit_count_xor()
+  synopsis:	Count the bits which differ between two bitstrings,
+		that is, their Hamming distance.
+  parameters:	gaulbyte	*alpha	First bitstring.
+		gaulbyte	*beta	Second bitstring.
+		int	length	Number of bits in bitstrings.
+  return:	int	Number of bits which differ.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_count_xor( gaulbyte *alpha, gaulbyte *beta, int length )
+  {
+  return gaul_bit_count(alpha, beta, GA_BIT_OP_XOR, length);
+  }
+
+
+/**********************************************************************
+  Conversion kernels.
+
+  Integers are stored most significant bit first, so a field is read
+  into an unsigned int with a single masked load and the order of
+  its bits reversed by table lookup.  The bulk conversions know the
+  extent of the bitstring, so may load whole words.  Gray decoding
+  is a prefix XOR over the field, which takes a handful of shifts of
+  the whole word; Gray encoding takes just one.  Fields wider than an unsigned int
+  contribute only their low bits to the value, as with the original
+  bit-by-bit conversions, but their high bits still contribute to
+  the parity of a Gray code.
+ **********************************************************************/
+
+#define GA_BIT_UINTBITS		((int) (sizeof(unsigned int)*BYTEBITS))
+#define GA_BIT_UINTMASK(l)	((l) < GA_BIT_UINTBITS ? (1U << (l)) - 1U : ~0U)
+
+/*
+ * Compilers don't reliably unroll the general loops below, so the
+ * usual case of a 32-bit unsigned int is written out.
+ */
+#if defined(UINT_MAX) && UINT_MAX == 0xFFFFFFFFU
+# define GA_BIT_UINT32
+#endif
+
+/*
+ * Byte values with their bits reversed.
+ */
+#define GA_BIT_R2(n)		n, n + 2*64, n + 1*64, n + 3*64
+#define GA_BIT_R4(n)		GA_BIT_R2(n), GA_BIT_R2(n + 2*16), GA_BIT_R2(n + 1*16), GA_BIT_R2(n + 3*16)
+#define GA_BIT_R6(n)		GA_BIT_R4(n), GA_BIT_R4(n + 2*4), GA_BIT_R4(n + 1*4), GA_BIT_R4(n + 3*4)
+
+static const gaulbyte gaul_bit_reversed[256] =
+  {
+  GA_BIT_R6(0), GA_BIT_R6(2), GA_BIT_R6(1), GA_BIT_R6(3)
+  };
+
+/**********************************************************************
+  gaul_bit_get_bits()
+  synopsis:	Read a run of bits into an unsigned int.  Bit n of the
+		bitstring becomes the lowest bit of the result.  A
+		whole word is loaded if the bitstring is known to be
+		long enough, otherwise only the bytes containing the
+		run are read.
+  parameters:	const gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits, 1 to GA_BIT_UINTBITS.
+		int	num_bytes	Size of bitstring, or zero if unknown.
+  return:	unsigned int	The bits.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE unsigned int gaul_bit_get_bits( const gaulbyte *bstr, int n,
+                                              int length, int num_bytes )
+  {
+  const gaulbyte *b=&(bstr[n/BYTEBITS]);	/* First byte of run. */
+  int		shift=n%BYTEBITS;	/* Offset of run within first byte. */
+  unsigned int	bits;		/* The bits. */
+  int		k;		/* Loop over bytes. */
+
+#ifdef GA_BIT_UINT32
+  if (n/BYTEBITS+5 <= num_bytes)
+    {
+    bits = ( (unsigned int) b[0] | (unsigned int) b[1] << 8 |
+             (unsigned int) b[2] << 16 | (unsigned int) b[3] << 24 ) >> shift;
+    if (shift != 0) bits |= (unsigned int) b[4] << (32-shift);
+    return bits & GA_BIT_UINTMASK(length);
+    }
+#else
+  if ( n/BYTEBITS+(int)GA_BIT_WORDBYTES <= num_bytes &&
+       shift+length <= GA_BIT_WORDBITS )
+    return (unsigned int) (gaul_bit_load(b) >> shift) & GA_BIT_UINTMASK(length);
+#endif
+
+  bits = b[0] >> shift;
+  for (k=1; k*BYTEBITS < shift+length; k++)
+    bits |= (unsigned int) b[k] << (k*BYTEBITS-shift);
+
+  return bits & GA_BIT_UINTMASK(length);
+  }
+
+
+/**********************************************************************
+  gaul_bit_put_bits()
+  synopsis:	Write a run of bits from an unsigned int, the inverse
+		of gaul_bit_get_bits().  Other bits are unchanged.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits, 1 to GA_BIT_UINTBITS.
+		unsigned int	bits	The bits.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE void gaul_bit_put_bits( gaulbyte *bstr, int n, int length, unsigned int bits )
+  {
+  gaulbyte	*b=&(bstr[n/BYTEBITS]);	/* First byte of run. */
+  int		shift=n%BYTEBITS;	/* Offset of run within first byte. */
+  unsigned int	mask=GA_BIT_UINTMASK(length);	/* Bits of run. */
+  int		k;		/* Loop over bytes. */
+
+  bits &= mask;
+  b[0] = (gaulbyte) ((b[0] & ~(mask << shift)) | (bits << shift));
+  for (k=1; k*BYTEBITS < shift+length; k++)
+    b[k] = (gaulbyte) ((b[k] & ~(mask >> (k*BYTEBITS-shift)))
+                       | (bits >> (k*BYTEBITS-shift)));
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_bit_reverse()
+  synopsis:	Reverse the order of the low bits of an unsigned int.
+  parameters:	unsigned int	bits	The bits.
+		int	length	Number of bits, 1 to GA_BIT_UINTBITS.
+  return:	unsigned int	The reversed bits.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE unsigned int gaul_bit_reverse( unsigned int bits, int length )
+  {
+  unsigned int	reversed=0;	/* Reversed bits. */
+#ifdef GA_BIT_UINT32
+  reversed = (unsigned int) gaul_bit_reversed[bits & 0xFF] << 24 |
+             (unsigned int) gaul_bit_reversed[(bits >> 8) & 0xFF] << 16 |
+             (unsigned int) gaul_bit_reversed[(bits >> 16) & 0xFF] << 8 |
+             (unsigned int) gaul_bit_reversed[bits >> 24];
+#else
+  int		k;		/* Loop over bytes. */
+
+  for (k=0; k<(int)sizeof(unsigned int); k++)
+    reversed = (reversed << BYTEBITS)
+               | gaul_bit_reversed[(bits >> (k*BYTEBITS)) & 0xFF];
+#endif
+
+  return reversed >> (GA_BIT_UINTBITS-length);
+  }
+
+
+/**********************************************************************
+  gaul_bit_parity()
+  synopsis:	Parity of a run of bits.
+  parameters:	const gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+  return:	unsigned int	Parity, in the lowest bit.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static unsigned int gaul_bit_parity( const gaulbyte *bstr, int n, int length )
+  {
+  unsigned int	parity=0;	/* Parity. */
+  int		num_bits;	/* Bits in current chunk. */
+
+  while (length > 0)
+    {
+    num_bits = MIN(length, GA_BIT_UINTBITS);
+    parity ^= GA_BIT_POPCOUNT(gaul_bit_get_bits(bstr, n, num_bits, 0));
+    n += num_bits;
+    length -= num_bits;
+    }
+
+  return parity;
+  }
+
+
+/**********************************************************************
+  gaul_bit_decode_uint()
+  synopsis:	Convert a binary or Gray-encoded field into an
+		unsigned int.  For Gray codes, parity gives the
+		decoded state of the bit preceding the field.
+  parameters:	const gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+		boolean	gray	Whether Gray encoded.
+		unsigned int	parity	Preceding decoded bit.
+		int	num_bytes	Size of bitstring, or zero if unknown.
+  return:	unsigned int	Decoded value.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE unsigned int gaul_bit_decode_uint( const gaulbyte *bstr, int n, int length,
+                                                 boolean gray, unsigned int parity,
+                                                 int num_bytes )
+  {
+  unsigned int	value;		/* Decoded value. */
+  int		lead;		/* Bits beyond those of an unsigned int. */
+#ifndef GA_BIT_UINT32
+  int		shift;		/* Prefix XOR stride. */
+#endif
+
+  if (length < 1) return 0;
+
+  if (length > GA_BIT_UINTBITS)
+    {
+    lead = length-GA_BIT_UINTBITS;
+    if (gray) parity ^= gaul_bit_parity(bstr, n, lead);
+    n += lead;
+    length -= lead;
+    }
+
+  value = gaul_bit_reverse(gaul_bit_get_bits(bstr, n, length, num_bytes), length);
+
+  if (gray)
+    {
+#ifdef GA_BIT_UINT32
+    value ^= value >> 1;
+    value ^= value >> 2;
+    value ^= value >> 4;
+    value ^= value >> 8;
+    value ^= value >> 16;
+#else
+    for (shift=1; shift<GA_BIT_UINTBITS; shift<<=1)
+      value ^= value >> shift;
+#endif
+    if (parity & 1) value ^= GA_BIT_UINTMASK(length);
+    }
+
+  return value;
+  }
+
+
+/**********************************************************************
+  gaul_bit_encode_uint()
+  synopsis:	Convert an unsigned int into a binary or Gray-encoded
+		field.  For Gray codes, prev gives the state of the
+		binary bit preceding the field.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+		unsigned int	value	Value to encode.
+		boolean	gray	Whether Gray encoded.
+		unsigned int	prev	Preceding binary bit.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_bit_encode_uint( gaulbyte *bstr, int n, int length,
+                                  unsigned int value, boolean gray, unsigned int prev )
+  {
+  int		lead;		/* Bits beyond those of an unsigned int. */
+
+  if (length < 1) return;
+
+  if (length > GA_BIT_UINTBITS)
+    {
+    lead = length-GA_BIT_UINTBITS;
+    gaul_bit_fill(bstr, n, lead, FALSE);
+    if (gray && prev)
+      bstr[n/BYTEBITS] |= 1 << (n%BYTEBITS);
+    n += lead;
+    length -= lead;
+    prev = 0;
+    }
+
+  value &= GA_BIT_UINTMASK(length);
+  if (gray)
+    {
+    value ^= value >> 1;
+    if (prev) value ^= 1U << (length-1);
+    }
+
+  gaul_bit_put_bits(bstr, n, length, gaul_bit_reverse(value, length));
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_bit_decode_int()
+  synopsis:	Convert a binary or Gray-encoded field into a signed
+		int.  The first bit is the sign.
+  parameters:	const gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+		boolean	gray	Whether Gray encoded.
+		int	num_bytes	Size of bitstring, or zero if unknown.
+  return:	int	Decoded value.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE int gaul_bit_decode_int( const gaulbyte *bstr, int n, int length,
+                                       boolean gray, int num_bytes )
+  {
+  unsigned int	sign;		/* Sign bit. */
+  unsigned int	value;		/* Magnitude. */
+
+  if (length < 1) return 0;
+
+  sign = (bstr[n/BYTEBITS] >> (n%BYTEBITS)) & 1;
+  value = gaul_bit_decode_uint(bstr, n+1, length-1, gray, sign, num_bytes);
+
+  return sign ? (int) (0U - value) : (int) value;
+  }
+
+
+/**********************************************************************
+  gaul_bit_encode_int()
+  synopsis:	Convert a signed int into a binary or Gray-encoded
+		field.  The first bit is the sign.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	length	Number of bits.
+		int	value	Value to encode.
+		boolean	gray	Whether Gray encoded.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_bit_encode_int( gaulbyte *bstr, int n, int length,
+                                 int value, boolean gray )
+  {
+  unsigned int	sign=0;		/* Sign bit. */
+  unsigned int	magnitude=(unsigned int) value;	/* Magnitude. */
+
+  if (length < 1) return;
+
+  if (value < 0)
+    {
+    sign = 1;
+    magnitude = 0U - magnitude;
+    bstr[n/BYTEBITS] |= 1 << (n%BYTEBITS);
+    }
+  else
+    {
+    bstr[n/BYTEBITS] &= ~(1 << (n%BYTEBITS));
+    }
+
+  gaul_bit_encode_uint(bstr, n+1, length-1, magnitude, gray, sign);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_bit_pow2()
+  synopsis:	Integral power of two.  Small powers are formed by
+		shifting a word, and others by ldexp().  Both are
+		exact and much cheaper than pow(), which is only
+		needed outside the range of normal and subnormal
+		doubles.
+  parameters:	int	exponent	The power.
+  return:	double	2^exponent.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE double gaul_bit_pow2( int exponent )
+  {
+  if (exponent >= 0 && exponent < GA_BIT_WORDBITS)
+    return (double) ((ga_bit_word) 1 << exponent);
+  if (exponent < 0 && exponent > -GA_BIT_WORDBITS)
+    return (double) ((ga_bit_word) 1 << (exponent+GA_BIT_WORDBITS-1))
+           / (double) ((ga_bit_word) 1 << (GA_BIT_WORDBITS-1));
+  if (exponent < -1074 || exponent > 1023)
+    return pow( 2.0, (double) exponent );
+
+  return ldexp( 1.0, exponent );
+  }
+
+
+/**********************************************************************
+  gaul_bit_scale()
+  synopsis:	Scale of a mantissa, or its reciprocal.  Mantissae
+		are held in an int, so wider fields have the same
+		scale as one of GA_BIT_UINTBITS bits.  Scaling by a
+		power of two is exact, so multiplying by the
+		reciprocal is identical to, and much cheaper than,
+		dividing by the scale.
+  parameters:	int	mantissa	Bits in mantissa.
+		boolean	reciprocal	Whether to return the reciprocal.
+  return:	double	Scale.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE double gaul_bit_scale( int mantissa, boolean reciprocal )
+  {
+  if (reciprocal)
+    return gaul_bit_pow2( 1-MIN(mantissa, GA_BIT_UINTBITS) );
+
+  return gaul_bit_pow2( MIN(mantissa, GA_BIT_UINTBITS)-1 );
+  }
+
+
+/**********************************************************************
+  gaul_bit_decode_real()
+  synopsis:	Convert a binary or Gray-encoded field at a given
+		offset into a real.
+  parameters:	const gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	mantissa	Bits in mantissa.
+		int	exponent	Bits in exponent.
+		boolean	gray	Whether Gray encoded.
+		int	num_bytes	Size of bitstring, or zero if unknown.
+  return:	double	Decoded value.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GA_BIT_INLINE double gaul_bit_decode_real( const gaulbyte *bstr, int n,
+                                           int mantissa, int exponent,
+                                           boolean gray, int num_bytes )
+  {
+  int		int_mantissa, int_exponent;
+
+  int_mantissa = gaul_bit_decode_int( bstr, n, mantissa, gray, num_bytes );
+  int_exponent = gaul_bit_decode_int( bstr, n+mantissa, exponent, gray, num_bytes );
+
+  if (gray)
+    return gaul_bit_pow2( int_exponent ) *
+           ((double)int_mantissa) * gaul_bit_scale( mantissa, TRUE );
+
+  return ((double)int_mantissa) * gaul_bit_scale( mantissa, TRUE )
+         * gaul_bit_pow2( int_exponent );
+  }
+
+
+/**********************************************************************
+  gaul_bit_encode_real()
+  synopsis:	Convert a real into a binary or Gray-encoded field at
+		a given offset.  Without an exponent field, the value
+		is held as a fixed-point mantissa.  Otherwise, values
+		too small for the exponent field are denormalized.
+		Either way, values beyond the range of the field
+		saturate.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		int	mantissa	Bits in mantissa.
+		int	exponent	Bits in exponent.
+		boolean	gray	Whether Gray encoded.
+		double	value	Value to encode.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_bit_encode_real( gaulbyte *bstr, int n, int mantissa,
+                                  int exponent, boolean gray, double value )
+  {
+  int		int_exponent=0;	/* Exponent. */
+  double	fraction=value;	/* Mantissa, as a fraction. */
+  double	scaled, limit;	/* Scaled mantissa and its range. */
+
+  if (exponent > 0)
+    {
+    limit = gaul_bit_scale( exponent, FALSE ) - 1.0;
+    fraction = frexp( value, &int_exponent );
+    if (int_exponent < -limit)
+      {
+      int_exponent = (int) -limit;
+      fraction = ldexp( value, -int_exponent );
+      }
+    else if (int_exponent > limit || !(value >= -DBL_MAX && value <= DBL_MAX))
+      {
+      int_exponent = (int) limit;
+      fraction = value < 0.0 ? -1.0 : 1.0;
+      }
+    }
+
+  scaled = floor(fraction * gaul_bit_scale( mantissa, FALSE ));
+  limit = mantissa < 1 ? 0.0 : gaul_bit_scale( mantissa, FALSE ) - 1.0;
+  if (scaled < -limit) scaled = -limit;
+  if (!(scaled <= limit)) scaled = limit;
+
+  gaul_bit_encode_int( bstr, n, mantissa, (int) scaled, gray );
+  gaul_bit_encode_int( bstr, n+mantissa, exponent, int_exponent, gray );
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_bit_decode_binary_uint()
+  synopsis:	Convert a binary-encoded bitstring into an unsigned int
+		starting at a given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC unsigned int ga_bit_decode_binary_uint( gaulbyte *bstr, int n, int length )
+  {
+  return gaul_bit_decode_uint( bstr, n, length, FALSE, 0, 0 );
+  }
+
+
+/**********************************************************************
+  ga_bit_encode_binary_uint()
+  synopsis:	Convert an unsigned int into a binary-encoded bitstring
+		starting at a given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_bit_encode_binary_uint( gaulbyte *bstr, int n, int length, unsigned int value )
+  {
+  gaul_bit_encode_uint( bstr, n, length, value, FALSE, 0 );
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_bit_decode_binary_int()
+  synopsis:	Convert a binary-encoded bitstring into a signed int
+		starting at a given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_decode_binary_int( gaulbyte *bstr, int n, int length )
+  {
+  return gaul_bit_decode_int( bstr, n, length, FALSE, 0 );
+  }
+
+
+/**********************************************************************
+  ga_bit_encode_binary_int()
+  synopsis:	Convert a signed int into a binary-encoded bitstring
+		starting at a given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_bit_encode_binary_int( gaulbyte *bstr, int n, int length, int value )
+  {
+  gaul_bit_encode_int( bstr, n, length, value, FALSE );
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_bit_decode_gray_int()
+  synopsis:	Convert a gray-encoded bitstring into a signed int
+		starting at a given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_decode_gray_int( gaulbyte *bstr, int n, int length )
+  {
+  return gaul_bit_decode_int( bstr, n, length, TRUE, 0 );
+  }
+
+
+/**********************************************************************
+  ga_bit_decode_gray_uint()
+  synopsis:	Convert a gray-encoded bitstring into an unsigned int
+		starting at a given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC unsigned int ga_bit_decode_gray_uint( gaulbyte *bstr, int n, int length )
+  {
+  return gaul_bit_decode_uint( bstr, n, length, TRUE, 0, 0 );
+  }
+
+
+/**********************************************************************
+  ga_bit_encode_gray_uint()
+  synopsis:	Convert an unsigned int into a gray-encoded bitstring
+		starting at a given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_bit_encode_gray_uint( gaulbyte *bstr, int n, int length, unsigned int value )
+  {
+  gaul_bit_encode_uint( bstr, n, length, value, TRUE, 0 );
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_bit_encode_gray_int()
+  synopsis:	Convert an unsigned int into a gray-encoded bitstring
+		starting at a given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_bit_encode_gray_int( gaulbyte *bstr, int n, int length, int value )
+  {
+  gaul_bit_encode_int( bstr, n, length, value, TRUE );
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_bit_decode_binary_real()
+  synopsis:	Convert a binary-encoded bitstring at a given offset
+		into a real. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC double ga_bit_decode_binary_real( gaulbyte *bstr, int n, int mantissa, int exponent )
+  {
+  return gaul_bit_decode_real( bstr, n, mantissa, exponent, FALSE, 0 );
+  }
+
+
+/**********************************************************************
+  ga_bit_encode_binary_real()
+  synopsis:	Convert a real into a binary-encoded bitstring at a
+                given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_bit_encode_binary_real( gaulbyte *bstr, int n, int mantissa, int exponent, double value )
+  {
+  gaul_bit_encode_real( bstr, n, mantissa, exponent, FALSE, value );
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_bit_decode_gray_real()
+  synopsis:	Convert a Gray-encoded bitstring at a given offset
+		into a real. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC double ga_bit_decode_gray_real( gaulbyte *bstr, int n, int mantissa, int exponent )
+  {
+  return gaul_bit_decode_real( bstr, n, mantissa, exponent, TRUE, 0 );
+  }
+
+
+/**********************************************************************
+  ga_bit_encode_gray_real()
+  synopsis:	Convert a real into a Gray-encoded bitstring at a
+                given offset. 
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_bit_encode_gray_real( gaulbyte *bstr, int n, int mantissa, int exponent, double value )
+  {
+  gaul_bit_encode_real( bstr, n, mantissa, exponent, TRUE, value );
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_bit_check_layout()
+  synopsis:	Check the layout of an encoded chromosome, and find
+		its length.
+  parameters:	const ga_bit_field	*layout	Layout of fields.
+		int	num_fields	Number of fields.
+		boolean	exponents	Whether fields may have exponents.
+  return:	int	Total number of bits.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_bit_check_layout( const ga_bit_field *layout, int num_fields,
+                                  boolean exponents )
+  {
+  int		i;		/* Loop over fields. */
+  int		length=0;	/* Total number of bits. */
+
+  if (!layout && num_fields > 0) die("Null pointer to layout passed.");
+
+  for (i=0; i<num_fields; i++)
+    {
+    if (layout[i].mantissa < 1 || layout[i].exponent < 0)
+      dief("Invalid width of field %d.", i);
+    if (!exponents && layout[i].exponent != 0)
+      dief("Field %d of integer layout has an exponent.", i);
+    length += layout[i].mantissa + layout[i].exponent;
+    }
+
+  return length;
+  }
+
+
+/**********************************************************************
+  ga_bit_decode_real_array()
+  synopsis:	Convert a whole encoded chromosome into reals, one per
+		field of the given layout.  Fields are consecutive,
+		starting at the given offset.  Each value is identical
+		to that from ga_bit_decode_binary_real() or
+		ga_bit_decode_gray_real(), but the conversion is much
+		faster.  Fields without an exponent have an exponent
+		of zero.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		const ga_bit_field	*layout	Layout of fields.
+		int	num_fields	Number of fields.
+		double	*value	Returns decoded values.
+  return:	int	Number of bits decoded.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_decode_real_array( gaulbyte *bstr, int n,
+                                       const ga_bit_field *layout, int num_fields,
+                                       double *value )
+  {
+  int		i;		/* Loop over fields. */
+  int		length;		/* Total number of bits. */
+  int		num_bytes;	/* Size of bitstring. */
+
+  length = gaul_bit_check_layout(layout, num_fields, TRUE);
+  num_bytes = (int) ga_bit_sizeof(n+length);
+
+  for (i=0; i<num_fields; i++)
+    {
+    value[i] = gaul_bit_decode_real(bstr, n, layout[i].mantissa,
+                                    layout[i].exponent, layout[i].gray,
+                                    num_bytes);
+    n += layout[i].mantissa + layout[i].exponent;
+    }
+
+  return length;
+  }
+
+
+/**********************************************************************
+  ga_bit_encode_real_array()
+  synopsis:	Convert an array of reals into a whole encoded
+		chromosome, one per field of the given layout.  This
+		is the inverse of ga_bit_decode_real_array(), and is
+		intended for seeding.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		const ga_bit_field	*layout	Layout of fields.
+		int	num_fields	Number of fields.
+		const double	*value	Values to encode.
+  return:	int	Number of bits encoded.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_encode_real_array( gaulbyte *bstr, int n,
+                                       const ga_bit_field *layout, int num_fields,
+                                       const double *value )
+  {
+  int		i;		/* Loop over fields. */
+  int		length;		/* Total number of bits. */
+
+  length = gaul_bit_check_layout(layout, num_fields, TRUE);
+
+  for (i=0; i<num_fields; i++)
+    {
+    gaul_bit_encode_real(bstr, n, layout[i].mantissa,
+                         layout[i].exponent, layout[i].gray, value[i]);
+    n += layout[i].mantissa + layout[i].exponent;
+    }
+
+  return length;
+  }
+
+
+/**********************************************************************
+  ga_bit_decode_int_array()
+  synopsis:	Convert a whole encoded chromosome into signed ints,
+		one per field of the given layout.  Fields must not
+		have exponents.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		const ga_bit_field	*layout	Layout of fields.
+		int	num_fields	Number of fields.
+		int	*value	Returns decoded values.
+  return:	int	Number of bits decoded.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_decode_int_array( gaulbyte *bstr, int n,
+                                      const ga_bit_field *layout, int num_fields,
+                                      int *value )
+  {
+  int		i;		/* Loop over fields. */
+  int		length;		/* Total number of bits. */
+  int		num_bytes;	/* Size of bitstring. */
+
+  length = gaul_bit_check_layout(layout, num_fields, FALSE);
+  num_bytes = (int) ga_bit_sizeof(n+length);
+
+  for (i=0; i<num_fields; i++)
+    {
+    value[i] = gaul_bit_decode_int(bstr, n, layout[i].mantissa, layout[i].gray,
+                                   num_bytes);
+    n += layout[i].mantissa;
+    }
+
+  return length;
+  }
+
+
+/**********************************************************************
+  ga_bit_encode_int_array()
+  synopsis:	Convert an array of signed ints into a whole encoded
+		chromosome, one per field of the given layout.  Fields
+		must not have exponents.
+  parameters:	gaulbyte	*bstr	Bitstring.
+		int	n	Initial bit index.
+		const ga_bit_field	*layout	Layout of fields.
+		int	num_fields	Number of fields.
+		const int	*value	Values to encode.
+  return:	int	Number of bits encoded.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_bit_encode_int_array( gaulbyte *bstr, int n,
+                                      const ga_bit_field *layout, int num_fields,
+                                      const int *value )
+  {
+  int		i;		/* Loop over fields. */
+  int		length;		/* Total number of bits. */
+
+  length = gaul_bit_check_layout(layout, num_fields, FALSE);
+
+  for (i=0; i<num_fields; i++)
+    {
+    gaul_bit_encode_int(bstr, n, layout[i].mantissa, value[i], layout[i].gray);
+    n += layout[i].mantissa;
+    }
+
+  return length;
   }
 
 
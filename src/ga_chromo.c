@@ -51,6 +51,104 @@
 
 #include "gaul/ga_chromo.h"
 
+/**********************************************************************
+  gaul_chromosome_gather()
+  synopsis:	Convert the fixed size chromosomes of an entity to
+		contiguous form.  Normally, an entity's chromosomes
+		are a single block which is returned directly.  In a
+		chromosome arena each chromosome is a row of its own
+		matrix, so with more than one chromosome they are
+		copied into a buffer.  If *max_bytes is zero, *bytes
+		is not ours, so a new buffer is allocated, otherwise
+		*bytes is reallocated as needed.
+  parameters:	const population *pop
+		entity *joe
+		const size_t allele_size	Bytes per allele.
+		gaulbyte **bytes
+		unsigned int *max_bytes
+  return:	Number of bytes processed.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static unsigned int gaul_chromosome_gather(const population *pop, entity *joe,
+                                     const size_t allele_size,
+                                     gaulbyte **bytes, unsigned int *max_bytes)
+  {
+  size_t	row_bytes;	/* Size of one chromosome. */
+  unsigned int	num_bytes;	/* Actual size of genes. */
+  int		i;		/* Loop over chromosomes. */
+
+  row_bytes = pop->len_chromosomes * allele_size;
+  num_bytes = (unsigned int) (row_bytes * pop->num_chromosomes);
+
+  if (pop->arena_row_stride == 0 || pop->num_chromosomes == 1)
+    {
+    if (*max_bytes!=0) die("Internal error.");
+
+    if (!joe->chromosome)
+      {
+      *bytes = (gaulbyte *)"\0";
+      return 0;
+      }
+
+    *bytes = (gaulbyte *)joe->chromosome[0];
+
+    return num_bytes;
+    }
+
+  if (!joe->chromosome) return 0;
+
+  if (*max_bytes == 0)
+    {
+    *max_bytes = num_bytes;
+    if ( !(*bytes = s_malloc(*max_bytes*sizeof(gaulbyte))) )
+      die("Unable to allocate memory");
+    }
+  else if (num_bytes > *max_bytes)
+    {
+    *max_bytes = num_bytes;
+    if ( !(*bytes = s_realloc(*bytes, *max_bytes*sizeof(gaulbyte))) )
+      die("Unable to allocate memory");
+    }
+
+  for (i=0; i<pop->num_chromosomes; i++)
+    memcpy(*bytes+i*row_bytes, joe->chromosome[i], row_bytes);
+
+  return num_bytes;
+  }
+
+
+/**********************************************************************
+  gaul_chromosome_scatter()
+  synopsis:	Convert fixed size chromosomes from contiguous form.
+		Each chromosome is copied separately, because in a
+		chromosome arena an entity's chromosomes are not
+		adjacent.
+  parameters:	const population *pop
+		entity *joe
+		const size_t allele_size	Bytes per allele.
+		gaulbyte *bytes
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void gaul_chromosome_scatter(const population *pop, entity *joe,
+                                     const size_t allele_size, gaulbyte *bytes)
+  {
+  size_t	row_bytes;	/* Size of one chromosome. */
+  int		i;		/* Loop over chromosomes. */
+
+  if (!joe->chromosome) die("Entity has no chromsomes.");
+
+  row_bytes = pop->len_chromosomes * allele_size;
+
+  for (i=0; i<pop->num_chromosomes; i++)
+    memcpy(joe->chromosome[i], bytes+i*row_bytes, row_bytes);
+
+  return;
+  }
+
+
 /**********************************************************************
   ga_chromosome_integer_allocate()
   synopsis:	Allocate the chromosomes for an entity.  Initial
@@ -166,45 +264,31 @@ GAULFUNC void ga_chromosome_integer_replicate( const population *pop,
 
 /**********************************************************************
   ga_chromosome_integer_to_bytes()
-  synopsis:	Convert to contiguous form.  In this case, a trivial
-		process.
+  synopsis:	Convert to contiguous form.  See
+		gaul_chromosome_gather().
   parameters:
   return:	Number of bytes processed.
-  last updated: 1 Feb 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC unsigned int ga_chromosome_integer_to_bytes(const population *pop, entity *joe,
                                      gaulbyte **bytes, unsigned int *max_bytes)
   {
-  int		num_bytes;	/* Actual size of genes. */
 
   if (!pop) die("Null pointer to population structure passed.");
   if (!joe) die("Null pointer to entity structure passed.");
 
-  if (*max_bytes!=0) die("Internal error.");
-
-  if (!joe->chromosome)
-    {
-    *bytes = (gaulbyte *)"\0";
-    return 0;
-    }
-
-  num_bytes = pop->len_chromosomes * pop->num_chromosomes *
-              sizeof(int);
-
-  *bytes = (gaulbyte *)joe->chromosome[0];
-
-  return num_bytes;
+  return gaul_chromosome_gather(pop, joe, sizeof(int), bytes, max_bytes);
   }
 
 
 /**********************************************************************
   ga_chromosome_integer_from_bytes()
-  synopsis:	Convert from contiguous form.  In this case, a trivial
-		process.
+  synopsis:	Convert from contiguous form.  See
+		gaul_chromosome_scatter().
   parameters:
   return:
-  last updated: 1 Feb 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_chromosome_integer_from_bytes(const population *pop, entity *joe, gaulbyte *bytes)
@@ -213,10 +297,7 @@ GAULFUNC void ga_chromosome_integer_from_bytes(const population *pop, entity *jo
   if (!pop) die("Null pointer to population structure passed.");
   if (!joe) die("Null pointer to entity structure passed.");
 
-  if (!joe->chromosome) die("Entity has no chromsomes.");
-
-  memcpy(joe->chromosome[0], bytes,
-         pop->len_chromosomes * pop->num_chromosomes * sizeof(int));
+  gaul_chromosome_scatter(pop, joe, sizeof(int), bytes);
 
   return;
   }
@@ -376,47 +457,33 @@ GAULFUNC void ga_chromosome_boolean_replicate( const population *pop,
 
 /**********************************************************************
   ga_chromosome_boolean_to_bytes()
-  synopsis:	Convert to contiguous form.  In this case, a trivial
-		process.  (Note that we could compress the data at this
+  synopsis:	Convert to contiguous form.  See
+		gaul_chromosome_gather().  (Note that we could compress the data at this
 		point but CPU time is currenty more important to me
 		than memory or bandwidth)
   parameters:
   return:
-  last updated: 1 Feb 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC unsigned int ga_chromosome_boolean_to_bytes(const population *pop, entity *joe,
                                     gaulbyte **bytes, unsigned int *max_bytes)
   {
-  int		num_bytes;	/* Actual size of genes. */
 
   if (!pop) die("Null pointer to population structure passed.");
   if (!joe) die("Null pointer to entity structure passed.");
 
-  if (*max_bytes!=0) die("Internal error.");
-
-  if (!joe->chromosome)
-    {
-    *bytes = (gaulbyte *)"\0";
-    return 0;
-    }
-
-  num_bytes = pop->len_chromosomes * pop->num_chromosomes *
-              sizeof(boolean);
-
-  *bytes = (gaulbyte *)joe->chromosome[0];
-
-  return num_bytes;
+  return gaul_chromosome_gather(pop, joe, sizeof(boolean), bytes, max_bytes);
   }
 
 
 /**********************************************************************
   ga_chromosome_boolean_from_bytes()
-  synopsis:	Convert from contiguous form.  In this case, a trivial
-		process.
+  synopsis:	Convert from contiguous form.  See
+		gaul_chromosome_scatter().
   parameters:
   return:
-  last updated: 1 Feb 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_chromosome_boolean_from_bytes(const population *pop, entity *joe, gaulbyte *bytes)
@@ -425,10 +492,7 @@ GAULFUNC void ga_chromosome_boolean_from_bytes(const population *pop, entity *jo
   if (!pop) die("Null pointer to population structure passed.");
   if (!joe) die("Null pointer to entity structure passed.");
 
-  if (!joe->chromosome) die("Entity has no chromsomes.");
-
-  memcpy(joe->chromosome[0], bytes,
-         pop->len_chromosomes * pop->num_chromosomes * sizeof(boolean));
+  gaul_chromosome_scatter(pop, joe, sizeof(boolean), bytes);
 
   return;
   }
@@ -562,47 +626,33 @@ GAULFUNC void ga_chromosome_double_replicate( const population *pop,
 
 /**********************************************************************
   ga_chromosome_double_to_bytes()
-  synopsis:	Convert to contiguous form.  In this case, a trivial
-		process.  (Note that we could compress the data at this
+  synopsis:	Convert to contiguous form.  See
+		gaul_chromosome_gather().  (Note that we could compress the data at this
 		point but CPU time is currenty more important to me
 		than memory or bandwidth)
   parameters:
   return:
-  last updated: 1 Feb 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC unsigned int ga_chromosome_double_to_bytes(const population *pop, entity *joe,
                                     gaulbyte **bytes, unsigned int *max_bytes)
   {
-  int		num_bytes;	/* Actual size of genes. */
 
   if (!pop) die("Null pointer to population structure passed.");
   if (!joe) die("Null pointer to entity structure passed.");
 
-  if (*max_bytes!=0) die("Internal error.");
-
-  if (!joe->chromosome)
-    {
-    *bytes = (gaulbyte *)"\0";
-    return 0;
-    }
-
-  num_bytes = pop->len_chromosomes * pop->num_chromosomes *
-              sizeof(double);
-
-  *bytes = (gaulbyte *)joe->chromosome[0];
-
-  return num_bytes;
+  return gaul_chromosome_gather(pop, joe, sizeof(double), bytes, max_bytes);
   }
 
 
 /**********************************************************************
   ga_chromosome_double_from_bytes()
-  synopsis:	Convert from contiguous form.  In this case, a trivial
-		process.
+  synopsis:	Convert from contiguous form.  See
+		gaul_chromosome_scatter().
   parameters:
   return:
-  last updated: 1 Feb 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_chromosome_double_from_bytes(const population *pop, entity *joe, gaulbyte *bytes)
@@ -611,10 +661,7 @@ GAULFUNC void ga_chromosome_double_from_bytes(const population *pop, entity *joe
   if (!pop) die("Null pointer to population structure passed.");
   if (!joe) die("Null pointer to entity structure passed.");
 
-  if (!joe->chromosome) die("Entity has no chromsomes.");
-
-  memcpy(joe->chromosome[0], bytes,
-         pop->len_chromosomes * pop->num_chromosomes * sizeof(double));
+  gaul_chromosome_scatter(pop, joe, sizeof(double), bytes);
 
   return;
   }
@@ -774,40 +821,27 @@ GAULFUNC void ga_chromosome_char_replicate( const population *pop,
 		trivial process.
   parameters:
   return:
-  last updated: 1 Feb 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC unsigned int ga_chromosome_char_to_bytes(const population *pop, entity *joe,
                                     gaulbyte **bytes, unsigned int *max_bytes)
   {
-  int		num_bytes;	/* Actual size of genes. */
 
   if (!pop) die("Null pointer to population structure passed.");
   if (!joe) die("Null pointer to entity structure passed.");
 
-  if (*max_bytes!=0) die("Internal error.");
-
-  if (!joe->chromosome)
-    {
-    *bytes = (gaulbyte *)"\0";
-    return 0;
-    }
-
-  num_bytes = pop->len_chromosomes * pop->num_chromosomes * sizeof(char);
-
-  *bytes = (gaulbyte *)joe->chromosome[0];
-
-  return num_bytes;
+  return gaul_chromosome_gather(pop, joe, sizeof(char), bytes, max_bytes);
   }
 
 
 /**********************************************************************
   ga_chromosome_char_from_bytes()
-  synopsis:	Convert from contiguous form.  In this case, a trivial
-		process.
+  synopsis:	Convert from contiguous form.  See
+		gaul_chromosome_scatter().
   parameters:
   return:
-  last updated: 1 Feb 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_chromosome_char_from_bytes(const population *pop, entity *joe, gaulbyte *bytes)
@@ -816,10 +850,7 @@ GAULFUNC void ga_chromosome_char_from_bytes(const population *pop, entity *joe,
   if (!pop) die("Null pointer to population structure passed.");
   if (!joe) die("Null pointer to entity structure passed.");
 
-  if (!joe->chromosome) die("Entity has no chromsomes.");
-
-  memcpy(joe->chromosome[0], bytes,
-         pop->len_chromosomes * pop->num_chromosomes * sizeof(char));
+  gaul_chromosome_scatter(pop, joe, sizeof(char), bytes);
 
   return;
   }
@@ -830,7 +861,7 @@ GAULFUNC void ga_chromosome_char_from_bytes(const population *pop, entity *joe,
   synopsis:	Convert genetic data into human readable form.
   parameters:
   return:
-  last updated: 19 Aug 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC char *ga_chromosome_char_to_string(
@@ -857,7 +888,7 @@ GAULFUNC char *ga_chromosome_char_to_string(
     {
     for(i=0; i<pop->num_chromosomes; i++)
       {
-      memcpy(&(text[k]), joe->chromosome[0],
+      memcpy(&(text[k]), joe->chromosome[i],
          pop->len_chromosomes * sizeof(char));
       k += pop->len_chromosomes;
       }
@@ -1243,4 +1274,372 @@ GAULFUNC char *ga_chromosome_list_to_string(
   }
 
 
+/**********************************************************************
+  ga_chromosome_fixed_size()
+  synopsis:	Number of bytes needed to hold one chromosome of the
+		population's built-in chromosome type, or 0 if the
+		chromosomes are not of a fixed-size built-in type.
+  parameters:	population *pop
+  return:	size_t
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static size_t ga_chromosome_fixed_size(population *pop)
+  {
+  if (pop->chromosome_constructor == ga_chromosome_integer_allocate)
+    return pop->len_chromosomes*sizeof(int);
+  if (pop->chromosome_constructor == ga_chromosome_boolean_allocate)
+    return pop->len_chromosomes*sizeof(boolean);
+  if (pop->chromosome_constructor == ga_chromosome_double_allocate)
+    return pop->len_chromosomes*sizeof(double);
+  if (pop->chromosome_constructor == ga_chromosome_char_allocate)
+    return pop->len_chromosomes*sizeof(char);
+  if (pop->chromosome_constructor == ga_chromosome_bitstring_allocate)
+    return ga_bit_sizeof(pop->len_chromosomes);
+
+  return 0;
+  }
+
+
+/**********************************************************************
+  ga_population_set_chromosome_arena()
+  synopsis:	Select whether the population's chromosomes are
+		allocated individually, by the chromosome constructor,
+		or stored together in an arena.  In the arena, each
+		chromosome is a matrix with one aligned row per entity
+		id, so operators and evaluation stream through
+		contiguous memory.  The usual entity->chromosome[]
+		pointers remain valid, and refer into the arena, but
+		an entity's chromosomes are no longer adjacent, so
+		code which treats entity->chromosome[0] as a single
+		block holding every chromosome must index each
+		chromosome separately instead.  Only the integer,
+		boolean, double, char and bitstring chromosome types
+		may use an arena, and the population must be empty
+		when this is changed.
+  parameters:	population *pop
+		const boolean use_arena
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_population_set_chromosome_arena(population *pop, const boolean use_arena)
+  {
+  size_t	size=0;		/* Bytes per chromosome. */
+
+  if (!pop) die("Null pointer to population structure passed.");
+
+  if (pop->size > 0)
+    die("Chromosome storage may only be changed for an empty population.");
+
+  if (use_arena && (size = ga_chromosome_fixed_size(pop)) == 0)
+    die("Chromosome arena requires one of the built-in chromosome types.");
+
+  plog(LOG_VERBOSE, "Population's chromosome arena = %s", use_arena?"TRUE":"FALSE");
+
+  gaul_chromosome_arena_free(pop);
+
+  pop->arena_chromosome_size = size;
+  pop->arena_row_stride = (size+GA_ARENA_ALIGNMENT-1) & ~((size_t)GA_ARENA_ALIGNMENT-1);
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_population_get_chromosome_arena()
+  synopsis:	Get the matrix holding one of the chromosomes for
+		the entities with ids 0 to (num_ids-1).  The row for
+		an entity is found from ga_get_entity_id().  Entities
+		with higher ids, created when the population outgrew
+		its original allocation, are held elsewhere.
+  parameters:	population *pop
+		const int chromosome	Index of chromosome.
+		int *num_ids		Returns number of rows.
+		size_t *row_stride	Returns bytes between rows.
+  return:	Start of the matrix, or NULL if no arena is in use.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC vpointer ga_population_get_chromosome_arena(population *pop, const int chromosome, int *num_ids, size_t *row_stride)
+  {
+  ga_arena_segment	*segment;	/* First segment of arena. */
+
+  if (!pop) die("Null pointer to population structure passed.");
+  if (chromosome < 0 || chromosome >= pop->num_chromosomes)
+    die("Invalid chromosome index.");
+
+  if (!(segment = pop->arena)) return NULL;
+
+  if (num_ids) *num_ids = segment->num_ids;
+  if (row_stride) *row_stride = pop->arena_row_stride;
+
+  return segment->alleles + (size_t)chromosome*segment->num_ids*pop->arena_row_stride;
+  }
+
+
+/**********************************************************************
+  gaul_chromosome_arena_attach()
+  synopsis:	Find the chromosomes in the arena for the entity with
+		the given id, extending the arena if the population
+		has grown beyond it.  Existing segments are never
+		moved, so chromosome pointers held elsewhere stay
+		valid.  The population's lock must be held.
+  parameters:	population *pop
+		const int id		Entity's index in entity_array.
+  return:	Chromosome pointers for the entity.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+vpointer *gaul_chromosome_arena_attach(population *pop, const int id)
+  {
+  ga_arena_segment	*segment, **last=&(pop->arena);	/* Arena segments. */
+  int			first_id=0;	/* First id not yet in arena. */
+  int			i, k;		/* Loop over rows and chromosomes. */
+
+  for (segment=pop->arena; segment; segment=segment->next)
+    {
+    if (id >= segment->first_id && id < segment->first_id+segment->num_ids)
+      return &(segment->views[(id-segment->first_id)*pop->num_chromosomes]);
+    first_id = segment->first_id+segment->num_ids;
+    last = &(segment->next);
+    }
+
+  if (id < first_id || id >= pop->max_size)
+    die("Entity id outside of population.");
+
+  if ( !(segment = s_malloc(sizeof(ga_arena_segment))) )
+    die("Unable to allocate memory");
+
+  segment->first_id = first_id;
+  segment->num_ids = pop->max_size-first_id;
+  segment->next = NULL;
+
+  if ( !(segment->block = s_malloc(pop->num_chromosomes*segment->num_ids*pop->arena_row_stride+GA_ARENA_ALIGNMENT)) )
+    die("Unable to allocate memory");
+  if ( !(segment->views = s_malloc(pop->num_chromosomes*segment->num_ids*sizeof(vpointer))) )
+    die("Unable to allocate memory");
+
+  segment->alleles = (gaulbyte *)(((size_t)segment->block+GA_ARENA_ALIGNMENT-1) & ~((size_t)GA_ARENA_ALIGNMENT-1));
+
+  for (i=0; i<segment->num_ids; i++)
+    for (k=0; k<pop->num_chromosomes; k++)
+      segment->views[i*pop->num_chromosomes+k] =
+        segment->alleles + ((size_t)k*segment->num_ids+i)*pop->arena_row_stride;
+
+  *last = segment;
+
+  return &(segment->views[(id-first_id)*pop->num_chromosomes]);
+  }
+
+
+/**********************************************************************
+  gaul_chromosome_arena_free()
+  synopsis:	Release the population's chromosome arena, if any.
+  parameters:	population *pop
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_chromosome_arena_free(population *pop)
+  {
+  ga_arena_segment	*segment;	/* Segment to free. */
+
+  while ((segment = pop->arena))
+    {
+    pop->arena = segment->next;
+    s_free(segment->block);
+    s_free(segment->views);
+    s_free(segment);
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_chromosome_pool_trim()
+  synopsis:	Free spare chromosome buffers until at most keep
+		remain.  The population's lock must be held.
+  parameters:	population *pop
+		const int keep
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void ga_chromosome_pool_trim(population *pop, const int keep)
+  {
+  entity	husk;		/* Temporary holder for chromosomes. */
+
+  while (pop->chromosome_pool_size > keep && pop->chromosome_pool_size > 0)
+    {
+    husk.chromosome = pop->chromosome_pool[--pop->chromosome_pool_size];
+    pop->chromosome_pool_destructor(pop, &husk);
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_population_set_chromosome_pool_size()
+  synopsis:	Set the maximum number of spare chromosome buffers
+		a population keeps.  When an entity is dereferenced,
+		its chromosomes are kept in this pool, rather than
+		freed, and handed to the next new entity.  Only the
+		integer, boolean, double, char and bitstring types
+		are pooled.  A size of 0 disables the pool.  Excess
+		spare buffers are freed.
+  parameters:	population *pop
+		const int max_buffers	Maximum spare buffers.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_population_set_chromosome_pool_size(population *pop, const int max_buffers)
+  {
+
+  if (!pop) die("Null pointer to population structure passed.");
+  if (max_buffers < 0) die("Negative chromosome pool size requested.");
+
+  plog(LOG_VERBOSE, "Population's chromosome pool size = %d", max_buffers);
+
+  THREAD_LOCK(pop->lock);
+
+  ga_chromosome_pool_trim(pop, max_buffers);
+
+  if (max_buffers == 0)
+    {
+    if (pop->chromosome_pool) s_free(pop->chromosome_pool);
+    pop->chromosome_pool = NULL;
+    }
+  else if (pop->chromosome_pool)
+    {
+    pop->chromosome_pool = s_realloc(pop->chromosome_pool, max_buffers*sizeof(vpointer));
+    }
+
+  pop->chromosome_pool_max = max_buffers;
+
+  THREAD_UNLOCK(pop->lock);
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_population_trim_chromosome_pool()
+  synopsis:	Free spare chromosome buffers held by a population,
+		until at most the given number remain.
+  parameters:	population *pop
+		const int keep		Spare buffers to keep.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_population_trim_chromosome_pool(population *pop, const int keep)
+  {
+
+  if (!pop) die("Null pointer to population structure passed.");
+
+  THREAD_LOCK(pop->lock);
+  ga_chromosome_pool_trim(pop, keep);
+  THREAD_UNLOCK(pop->lock);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_chromosome_recycle()
+  synopsis:	Place a dying entity's chromosomes in the population's
+		pool of spare buffers, if there is room and they are
+		of a suitable type.  The population's lock must be
+		held.
+  parameters:	population *pop
+		entity *corpse
+  return:	TRUE if the chromosomes were taken, otherwise the
+		caller should deallocate them.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+boolean gaul_chromosome_recycle(population *pop, entity *corpse)
+  {
+
+  if (pop->chromosome_pool_size >= pop->chromosome_pool_max)
+    return FALSE;
+
+/* Buffers from a different constructor are useless. */
+  if (pop->chromosome_pool_constructor != pop->chromosome_constructor)
+    {
+    ga_chromosome_pool_trim(pop, 0);
+    if (ga_chromosome_fixed_size(pop) == 0) return FALSE;
+    pop->chromosome_pool_constructor = pop->chromosome_constructor;
+    pop->chromosome_pool_destructor = pop->chromosome_destructor;
+    }
+
+  if (!pop->chromosome_pool)
+    {
+    if ( !(pop->chromosome_pool = s_malloc(pop->chromosome_pool_max*sizeof(vpointer))) )
+      die("Unable to allocate memory");
+    }
+
+  pop->chromosome_pool[pop->chromosome_pool_size++] = corpse->chromosome;
+  corpse->chromosome = NULL;
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  gaul_chromosome_reuse()
+  synopsis:	Give a new entity spare chromosomes from the
+		population's pool, if any are available.  Contents are
+		garbage, as for a freshly allocated chromosome.  The
+		population's lock must be held.
+  parameters:	population *pop
+		entity *embryo
+  return:	TRUE if the entity received chromosomes, otherwise
+		the caller should allocate them.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+boolean gaul_chromosome_reuse(population *pop, entity *embryo)
+  {
+
+  if (pop->chromosome_pool_size == 0) return FALSE;
+
+  if (pop->chromosome_pool_constructor != pop->chromosome_constructor)
+    {
+    ga_chromosome_pool_trim(pop, 0);
+    return FALSE;
+    }
+
+  embryo->chromosome = pop->chromosome_pool[--pop->chromosome_pool_size];
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  gaul_chromosome_pool_free()
+  synopsis:	Release the population's spare chromosome buffers.
+  parameters:	population *pop
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_chromosome_pool_free(population *pop)
+  {
+
+  ga_chromosome_pool_trim(pop, 0);
+
+  if (pop->chromosome_pool)
+    {
+    s_free(pop->chromosome_pool);
+    pop->chromosome_pool = NULL;
+    }
+
+  return;
+  }
+
 
@@ -330,12 +330,12 @@ GAULFUNC double ga_compare_boolean_euclidean(population *pop, entity *alpha, ent
 		entity *alpha	Test entity.
 		entity *beta	Test entity.
   return:	Returns Hamming distance between two entities' genomes.
-  last updated:	25 Aug 2004
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC double ga_compare_bitstring_hamming(population *pop, entity *alpha, entity *beta)
   {
-  int		i,j;		/* Loop variable over all chromosomes, alleles. */
+  int		i;		/* Loop variable over all chromosomes. */
   int		dist=0;		/* Genomic distance. */
   gaulbyte		*a, *b;		/* Pointers to chromosomes. */
 
@@ -347,10 +347,7 @@ GAULFUNC double ga_compare_bitstring_hamming(population *pop, entity *alpha, ent
     a = (gaulbyte *)(alpha->chromosome[i]);
     b = (gaulbyte *)(beta->chromosome[i]);
 
-    for (j=0; j<pop->len_chromosomes; j++)
-      {
-      dist += (ga_bit_get(a,j)!=ga_bit_get(b,j));
-      }
+    dist += ga_bit_count_xor(a, b, pop->len_chromosomes);
     }
 
   return (double) dist;
@@ -366,12 +363,12 @@ GAULFUNC double ga_compare_bitstring_hamming(population *pop, entity *alpha, ent
 		entity *alpha	Test entity.
 		entity *beta	Test entity.
   return:	Returns Euclidean distance between two entities' genomes.
-  last updated:	25 Aug 2004
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC double ga_compare_bitstring_euclidean(population *pop, entity *alpha, entity *beta)
   {
-  int		i,j;			/* Loop variable over all chromosomes, alleles. */
+  int		i;			/* Loop variable over all chromosomes. */
   double	sqdistsum=0.0;		/* Genomic distance. */
   gaulbyte		*a, *b;			/* Pointers to chromosomes. */
 
@@ -383,10 +380,7 @@ GAULFUNC double ga_compare_bitstring_euclidean(population *pop, entity *alpha, e
     a = (gaulbyte *)(alpha->chromosome[i]);
     b = (gaulbyte *)(beta->chromosome[i]);
 
-    for (j=0; j<pop->len_chromosomes; j++)
-      {
-      sqdistsum += (ga_bit_get(a,j)!=ga_bit_get(b,j));
-      }
+    sqdistsum += ga_bit_count_xor(a, b, pop->len_chromosomes);
     }
 
   return sqrt(sqdistsum);
@@ -66,6 +66,15 @@ THREAD_LOCK_DEFINE_STATIC(pop_table_lock);
 static boolean gaul_openmp_initialised = FALSE;
 #endif
 
+/*
+ * Entity magazines.  Each thread holds at most one, for the
+ * population it is currently working on.  The epoch identifies the
+ * magazine phase, so that stale magazines are never used.
+ */
+static int			magazine_epoch_counter=0;	/* Protected by pop_table_lock. */
+static THREAD_LOCAL ga_magazine	*thread_magazine=NULL;		/* This thread's magazine. */
+static THREAD_LOCAL int		thread_magazine_epoch=0;	/* Phase of this thread's magazine. */
+
 /*
  * Lookup table for functions.
  *
@@ -192,6 +201,8 @@ static struct func_lookup lookup[]={
 	{ "ga_chromosome_list_to_bytes",               (void *) ga_chromosome_list_to_bytes },
 	{ "ga_chromosome_list_from_bytes",             (void *) ga_chromosome_list_from_bytes },
 	{ "ga_chromosome_list_to_string",              (void *) ga_chromosome_list_to_string },
+	{ "ga_rank_pareto",                            (void *) ga_rank_pareto },
+	{ "ga_replace_by_hypervolume",                 (void *) ga_replace_by_hypervolume },
 	{ NULL, NULL } };
 
 
@@ -304,6 +315,30 @@ GAULFUNC population *ga_population_new(	const int stable_size,
   newpop->elitism = GA_ELITISM_PARENTS_SURVIVE;
 
   newpop->allele_mutation_prob = GA_DEFAULT_ALLELE_MUTATION_PROB;
+  newpop->reproducible = FALSE;
+  newpop->sort_type = GA_SORT_AUTO;
+  newpop->archive = NULL;
+  newpop->hypervolume_reference = NULL;
+  newpop->arena_chromosome_size = 0;
+  newpop->chromosome_pool_max = stable_size;
+  newpop->arena_row_stride = 0;
+  newpop->arena = NULL;
+  newpop->chromosome_pool = NULL;
+  newpop->chromosome_pool_size = 0;
+  newpop->chromosome_pool_constructor = NULL;
+  newpop->chromosome_pool_destructor = NULL;
+  newpop->magazines = NULL;
+  newpop->magazine_size = GA_DEFAULT_MAGAZINE_SIZE;
+  newpop->magazine_epoch = 0;
+  newpop->num_reserved = 0;
+  newpop->replace_heap = NULL;
+  newpop->replace_heap_size = 0;
+  newpop->replace_heap_births = 0;
+  newpop->unsorted = 0;
+  newpop->selectdata.permutation = NULL;
+  newpop->selectdata.alias_prob = NULL;
+  newpop->selectdata.alias_index = NULL;
+  newpop->selectdata.alias_max = 0;
   newpop->allele_min_integer = 0;
   newpop->allele_max_integer = RAND_MAX-1;	/* this may seem like an odd choice, but it is to maintain compatiability with older versions. */
   newpop->allele_min_double = DBL_MIN;
@@ -365,6 +400,8 @@ GAULFUNC population *ga_population_new(	const int stable_size,
   newpop->chromosome_to_string = NULL;
 
   newpop->evaluate = NULL;
+  newpop->evaluate_batch = NULL;
+  newpop->evaluate_batch_size = 0;
   newpop->seed = NULL;
   newpop->adapt = NULL;
   newpop->select_one = NULL;
@@ -446,6 +483,30 @@ GAULFUNC population *ga_population_clone_empty(population *pop)
   newpop->elitism = pop->elitism;
 
   newpop->allele_mutation_prob = pop->allele_mutation_prob;
+  newpop->reproducible = pop->reproducible;
+  newpop->sort_type = pop->sort_type;
+  newpop->archive = NULL;
+  newpop->hypervolume_reference = NULL;
+  newpop->arena_chromosome_size = pop->arena_chromosome_size;
+  newpop->chromosome_pool_max = pop->chromosome_pool_max;
+  newpop->arena_row_stride = pop->arena_row_stride;
+  newpop->arena = NULL;
+  newpop->chromosome_pool = NULL;
+  newpop->chromosome_pool_size = 0;
+  newpop->chromosome_pool_constructor = NULL;
+  newpop->chromosome_pool_destructor = NULL;
+  newpop->magazines = NULL;
+  newpop->magazine_size = GA_DEFAULT_MAGAZINE_SIZE;
+  newpop->magazine_epoch = 0;
+  newpop->num_reserved = 0;
+  newpop->replace_heap = NULL;
+  newpop->replace_heap_size = 0;
+  newpop->replace_heap_births = 0;
+  newpop->unsorted = 0;
+  newpop->selectdata.permutation = NULL;
+  newpop->selectdata.alias_prob = NULL;
+  newpop->selectdata.alias_index = NULL;
+  newpop->selectdata.alias_max = 0;
   newpop->allele_min_integer = newpop->allele_min_integer;
   newpop->allele_max_integer = newpop->allele_max_integer;
   newpop->allele_min_double = newpop->allele_min_double;
@@ -476,6 +537,8 @@ GAULFUNC population *ga_population_clone_empty(population *pop)
   newpop->chromosome_to_string = pop->chromosome_to_string;
 
   newpop->evaluate = pop->evaluate;
+  newpop->evaluate_batch = pop->evaluate_batch;
+  newpop->evaluate_batch_size = pop->evaluate_batch_size;
   newpop->seed = pop->seed;
   newpop->adapt = pop->adapt;
   newpop->select_one = pop->select_one;
@@ -622,7 +685,7 @@ GAULFUNC population *ga_population_clone_empty(population *pop)
     newpop->de_params->weighting_max = pop->de_params->weighting_max;
     }
 
-  if (newpop->sampling_params == NULL)
+  if (pop->sampling_params == NULL)
     {
     newpop->sampling_params = NULL;
     }
@@ -1045,6 +1108,147 @@ GAULFUNC double ga_entity_evaluate(population *pop, entity *this_entity)
   }
 
 
+/**********************************************************************
+  ga_entity_evaluate_batch()
+  synopsis:	Score an array of entities.  If the population has
+		a batch evaluation callback, the entities are passed
+		to it in chunks of at most evaluate_batch_size
+		entities.  If that callback returns FALSE, every
+		entity in the chunk is given the minimum fitness.
+		Otherwise, each entity is passed to the usual
+		evaluation callback in turn.
+  parameters:	population *pop
+		entity **entities	Entities to evaluate.
+		const int num		Number of entities.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_entity_evaluate_batch(population *pop, entity **entities, const int num)
+  {
+  int		i, j;		/* Loop over entities. */
+  int		chunk;		/* Size of current chunk. */
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+  if ( num > 0 && !entities ) die("Null pointer to entity array passed.");
+
+  if ( pop->evaluate_batch )
+    {
+    for (i=0; i<num; i+=chunk)
+      {
+      chunk = num-i;
+      if (pop->evaluate_batch_size > 0 && chunk > pop->evaluate_batch_size)
+        chunk = pop->evaluate_batch_size;
+
+      if (pop->evaluate_batch(pop, &(entities[i]), chunk) == FALSE)
+        {
+        for (j=i; j<i+chunk; j++)
+          entities[j]->fitness = GA_MIN_FITNESS;
+        }
+      }
+    }
+  else
+    {
+    if ( !pop->evaluate ) die("Evaluation callback not defined.");
+
+    for (i=0; i<num; i++)
+      {
+      if (pop->evaluate(pop, entities[i]) == FALSE)
+        entities[i]->fitness = GA_MIN_FITNESS;
+      }
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_population_evaluate_ranks()
+  synopsis:	Score the entities with rank in the range
+		[first, end), using the batch evaluation callback
+		if one is defined.
+  parameters:	population *pop
+		const int first
+		const int end
+		const boolean skip_evaluated	Whether to skip entities that already have a fitness.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_population_evaluate_ranks(population *pop, const int first, const int end,
+                                    const boolean skip_evaluated)
+  {
+  entity	**entities;	/* Entities to evaluate. */
+  int		num=0;		/* Number of entities to evaluate. */
+  int		i;		/* Loop over ranks. */
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+
+  if (first >= end) return;
+
+  if ( !pop->evaluate_batch )
+    {	/* Avoid the copy in the common case. */
+    if ( !pop->evaluate ) die("Evaluation callback not defined.");
+
+#pragma omp parallel for \
+   shared(pop) private(i) \
+   schedule(static)
+    for (i=first; i<end; i++)
+      {
+      if ( !skip_evaluated || pop->entity_iarray[i]->fitness == GA_MIN_FITNESS )
+        {
+        if ( pop->evaluate(pop, pop->entity_iarray[i]) == FALSE )
+          pop->entity_iarray[i]->fitness = GA_MIN_FITNESS;
+        }
+      }
+
+    return;
+    }
+
+  if ( !(entities = s_malloc(sizeof(entity *)*(end-first))) )
+    die("Unable to allocate memory");
+
+  for (i=first; i<end; i++)
+    {
+    if ( !skip_evaluated || pop->entity_iarray[i]->fitness == GA_MIN_FITNESS )
+      entities[num++] = pop->entity_iarray[i];
+    }
+
+  ga_entity_evaluate_batch(pop, entities, num);
+
+  s_free(entities);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_random_counter_init()
+  synopsis:	Prepare a counter-based source of random numbers for
+		work on the given entity index in the current
+		generation, keyed by the master seed.  The island and
+		purpose select independent sequences.
+  parameters:	population *pop
+		random_counter *rc
+		const int index
+		const int purpose	One of GA_COUNTER_*.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_random_counter_init(population *pop, random_counter *rc,
+                              const int index, const int purpose)
+  {
+
+  random_counter_init( rc, random_get_seed(),
+                       (unsigned int) pop->generation,
+                       (unsigned int) index,
+                       (unsigned int) (pop->island*GA_NUM_COUNTER_PURPOSES + purpose) );
+
+  return;
+  }
+
+
 /**********************************************************************
   ga_population_score_and_sort()
   synopsis:	Score and sort entire population.  This is probably
@@ -1074,22 +1278,29 @@ GAULFUNC boolean ga_population_score_and_sort(population *pop)
  * Each chromosome is decoded separately, whereas originally many
  * degenerate chromosomes would share their userdata elements.
  */
+  if ( pop->evaluate_batch )
+    {
+    gaul_population_evaluate_ranks(pop, 0, pop->size, FALSE);
+    }
+  else
+    {
 #pragma omp parallel for \
    shared(pop) private(i) \
    schedule(static)
-  for (i=0; i<pop->size; i++)
-    {
+    for (i=0; i<pop->size; i++)
+      {
 #if GA_DEBUG>2
-    origfitness = pop->entity_iarray[i]->fitness;
+      origfitness = pop->entity_iarray[i]->fitness;
 #endif
-    pop->evaluate(pop, pop->entity_iarray[i]);
+      pop->evaluate(pop, pop->entity_iarray[i]);
 
 #if GA_DEBUG>2
-    if (origfitness != pop->entity_iarray[i]->fitness)
-      plog(LOG_NORMAL,
-           "Recalculated fitness %f doesn't match stored fitness %f for entity %d.",
-           pop->entity_iarray[i]->fitness, origfitness, i);
+      if (origfitness != pop->entity_iarray[i]->fitness)
+        plog(LOG_NORMAL,
+             "Recalculated fitness %f doesn't match stored fitness %f for entity %d.",
+             pop->entity_iarray[i]->fitness, origfitness, i);
 #endif
+      }
     }
 
   sort_population(pop);
@@ -1121,6 +1332,31 @@ GAULFUNC boolean ga_population_sort(population *pop)
   }
 
 
+/**********************************************************************
+  ga_population_sort_best()
+  synopsis:	Sorts the fittest entities of a population to the
+		front, in order.  The order of the remaining entities
+		is arbitrary.  This is considerably faster than a full
+		sort when few entities are required from a large
+		population.
+  parameters:	population *pop
+		const int num_best	Number of entities to sort.
+  return:	TRUE
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC boolean ga_population_sort_best(population *pop, const int num_best)
+  {
+
+/* Checks. */
+  if ( !pop ) die("Null pointer to population structure passed.");
+
+  sort_population_best(pop, num_best);
+
+  return TRUE;
+  }
+
+
 #if 0
 FIXME: The following 3 functions need to be fixed for the new absracted chromosome types.
 /**********************************************************************
@@ -1226,27 +1462,103 @@ GAULFUNC void ga_population_convergence_alleles( population *pop )
 #endif
 
 
+/**********************************************************************
+  gaul_population_update_ranks()
+  synopsis:	Record the current ranks of the entities with ranks
+		in the range [first, end).  Must be called after
+		entity_iarray[] is reordered, for ga_get_entity_rank()
+		to remain a constant time operation.
+  parameters:	population *pop
+		const int first
+		const int end
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_population_update_ranks(population *pop, const int first, const int end)
+  {
+  int	rank;		/* Loop over ranks. */
+
+  for (rank=first; rank<end; rank++)
+    pop->entity_iarray[rank]->rank = rank;
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_entity_swap_rank()
+  synopsis:	Swap the ranks of a pair of entities.
+  parameters:	population *pop
+		const int rank1
+		const int rank2
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+void gaul_entity_swap_rank(population *pop, const int rank1, const int rank2)
+  {
+  entity	*tmp;		/* Swapped entity. */
+
+  tmp = pop->entity_iarray[rank1];
+  pop->entity_iarray[rank1] = pop->entity_iarray[rank2];
+  pop->entity_iarray[rank2] = tmp;
+
+  pop->entity_iarray[rank1]->rank = rank1;
+  pop->entity_iarray[rank2]->rank = rank2;
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_entity_position()
+  synopsis:	Gets an entity's current subscript into entity_iarray
+		of the population.  Unlike ga_get_entity_rank(), this
+		never sorts the population.
+		The rank recorded in the entity is used if it is
+		still current.  Otherwise, entity_iarray has been
+		reordered behind our back, so all of the recorded
+		ranks are refreshed.
+  parameters:	population *pop
+		entity *e
+  return:	Subscript, or -1 if the entity isn't in the array.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+int gaul_entity_position(population *pop, entity *e)
+  {
+
+  if (e->rank >= 0 && e->rank < pop->size && pop->entity_iarray[e->rank] == e)
+    return e->rank;
+
+  gaul_population_update_ranks(pop, 0, pop->size);
+
+  if (e->rank >= 0 && e->rank < pop->size && pop->entity_iarray[e->rank] == e)
+    return e->rank;
+
+  return -1;
+  }
+
+
 /**********************************************************************
   ga_get_entity_rank()
   synopsis:	Gets an entity's rank (subscript into entity_iarray of
 		the population).  This is not necessarily the fitness
-		rank unless the population has been sorted.
+		rank unless the population has been sorted.  During
+		a steady-state run, the established entities are
+		sorted on demand.
   parameters:
   return:
-  last updated: 22/01/01
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_get_entity_rank(population *pop, entity *e)
   {
-  int	rank=0;		/* The rank. */
 
-  while (rank < pop->size)
-    {
-    if (pop->entity_iarray[rank] == e) return rank;
-    rank++;
-    }
+  sort_population_on_demand(pop);
 
-  return -1;
+  return gaul_entity_position(pop, e);
   }
 
 
@@ -1257,20 +1569,15 @@ GAULFUNC int ga_get_entity_rank(population *pop, entity *e)
 		rank unless the population has been sorted.
   parameters:
   return:
-  last updated: 18 Mar 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_get_entity_rank_from_id(population *pop, int id)
   {
-  int	rank=0;		/* The rank. */
 
-  while (rank < pop->size)
-    {
-    if (pop->entity_iarray[rank] == pop->entity_array[id]) return rank;
-    rank++;
-    }
+  if (id < 0 || id >= pop->max_size || !pop->entity_array[id]) return -1;
 
-  return -1;
+  return ga_get_entity_rank(pop, pop->entity_array[id]);
   }
 
 
@@ -1279,44 +1586,39 @@ GAULFUNC int ga_get_entity_rank_from_id(population *pop, int id)
   synopsis:	Gets an entity's id from its rank.
   parameters:
   return:
-  last updated: 18 Mar 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_get_entity_id_from_rank(population *pop, int rank)
   {
-  int	id=0;		/* The entity's index. */
 
-  while (id < pop->max_size)
-    {
-    if (pop->entity_array[id] == pop->entity_iarray[rank]) return id;
-    id++;
-    }
+  if (rank < 0 || rank >= pop->size) return -1;
 
-  return -1;
+  sort_population_on_demand(pop);
+
+  return ga_get_entity_id(pop, pop->entity_iarray[rank]);
   }
 
 
 /**********************************************************************
   ga_get_entity_id()
-  synopsis:	Gets an entity's internal index.
+  synopsis:	Gets an entity's internal index.  This is recorded in
+		the entity, and never changes.
   parameters:	population *pop
 		entity *e
-  return:	entity id
-  last updated: 18 Mar 2002
+  return:	entity id, or -1 if the entity is not in this
+		population.
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_get_entity_id(population *pop, entity *e)
   {
-  int	id=0;	/* The index. */
 
   if ( !pop ) die("Null pointer to population structure passed.");
   if ( !e ) die("Null pointer to entity structure passed.");
 
-  while (id < pop->max_size)
-    {
-    if (pop->entity_array[id] == e) return id;
-    id++;
-    }
+  if (e->id >= 0 && e->id < pop->max_size && pop->entity_array[e->id] == e)
+    return e->id;
 
   return -1;
   }
@@ -1335,76 +1637,446 @@ GAULFUNC entity *ga_get_entity_from_id(population *pop, const unsigned int id)
   {
   if ( !pop ) die("Null pointer to population structure passed.");
 
-  if ( (int) id>pop->max_size ) return NULL;
+  if ( (int) id>pop->max_size ) return NULL;
+
+  return pop->entity_array[id];
+  }
+
+
+/**********************************************************************
+  ga_get_entity_from_rank()
+  synopsis:	Gets a pointer to an entity from it's internal rank.
+		(subscript into the entity_iarray buffer).
+		Note that this only relates to fitness ranking if
+		the population has been properly sorted.  During a
+		steady-state run, the established entities are
+		sorted on demand.
+  parameters:
+  return:
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC entity *ga_get_entity_from_rank(population *pop, const unsigned int rank)
+  {
+  if ( !pop ) die("Null pointer to population structure passed.");
+
+  if ( rank > (unsigned) pop->size ) return NULL;
+
+  sort_population_on_demand(pop);
+
+  return pop->entity_iarray[rank];
+  }
+
+
+/**********************************************************************
+  ga_entity_setup_chromosomes()
+  synopsis:	Gives a pre-allocated entity structure its
+		chromosomes.  These are allocated, taken from the
+		population's pool of spare buffers, or found in its
+		chromosome arena, but will contain garbage.  The
+		population's lock must be held.
+  parameters:	population *pop
+		entity *joe
+		const int id	Entity's index in entity_array.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void ga_entity_setup_chromosomes(population *pop, entity *joe, const int id)
+  {
+
+  if (!joe)
+    die("Null pointer to entity structure passed.");
+
+  joe->id = id;
+  joe->chromosome = NULL;
+
+  if (pop->arena_chromosome_size > 0)
+    {
+    joe->chromosome = gaul_chromosome_arena_attach(pop, id);
+    }
+  else
+    {
+    if (!pop->chromosome_constructor)
+      die("Chromosome constructor not defined.");
+
+    if (!gaul_chromosome_reuse(pop, joe))
+      pop->chromosome_constructor(pop, joe);
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_entity_setup_fields()
+  synopsis:	Clears the data and fitness of an entity structure
+		which already has its chromosomes.  The population's
+		lock need not be held.
+  parameters:	population *pop
+		entity *joe
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void ga_entity_setup_fields(population *pop, entity *joe)
+  {
+  int	i;	/* Loop variable over the fitness vector. */
+
+/* Physical characteristics currently undefined. */
+  joe->data=NULL;
+
+/* Not ranked yet. */
+  joe->rank = -1;
+  joe->heap_pos = -1;
+
+/* No fitness evaluated yet. */
+  joe->fitness = GA_MIN_FITNESS;
+
+  if ( pop->fitness_dimensions > 0 )
+    { /* This population is being used for multiobjective optimisation. */
+    if ( !(joe->fitvector = s_malloc(sizeof(double)*pop->fitness_dimensions)) )
+      die("Unable to allocate memory");
+
+    /* Clear multiobjective fitness vector. */
+    for (i=0; i<pop->fitness_dimensions; i++)
+      joe->fitvector[i] = GA_MIN_FITNESS;
+    }
+  else
+    {
+    joe->fitvector = NULL;
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_entity_setup()
+  synopsis:	Prepares a pre-allocated entity structure for use.
+		Chromosomes are allocated, taken from the population's
+		pool of spare buffers, or found in its chromosome
+		arena, but will contain garbage.
+  parameters:	population *pop
+		entity *joe
+		const int id	Entity's index in entity_array.
+  return:
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static boolean ga_entity_setup(population *pop, entity *joe, const int id)
+  {
+
+  ga_entity_setup_chromosomes(pop, joe, id);
+  ga_entity_setup_fields(pop, joe);
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  gaul_magazine_get()
+  synopsis:	Find the calling thread's entity magazine for the
+		current magazine phase of a population, creating a
+		new, empty, magazine if necessary.
+  parameters:	population *pop
+  return:	The magazine.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static ga_magazine *gaul_magazine_get(population *pop)
+  {
+  ga_magazine	*magazine;	/* This thread's magazine. */
+
+  if (thread_magazine_epoch == pop->magazine_epoch)
+    return thread_magazine;
+
+  if ( !(magazine = s_malloc(sizeof(ga_magazine))) )
+    die("Unable to allocate memory");
+
+  magazine->num_spare = 0;
+  magazine->num_fresh = 0;
+  magazine->max_entities = 0;
+  magazine->spare = NULL;
+  magazine->spare_id = NULL;
+  magazine->fresh = NULL;
+  magazine->fresh_id = NULL;
+
+  THREAD_LOCK(pop->lock);
+  magazine->next = pop->magazines;
+  pop->magazines = magazine;
+  THREAD_UNLOCK(pop->lock);
+
+  thread_magazine = magazine;
+  thread_magazine_epoch = pop->magazine_epoch;
+
+  return magazine;
+  }
+
+
+/**********************************************************************
+  gaul_magazine_refill()
+  synopsis:	Reserve a batch of entity structures, with their
+		chromosomes, for a magazine.  This is the only time
+		that the population's lock is taken while a thread
+		obtains entities from its magazine.
+  parameters:	population *pop
+		ga_magazine *magazine
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void gaul_magazine_refill(population *pop, ga_magazine *magazine)
+  {
+  int		num=pop->magazine_size;	/* Number of entities to reserve. */
+  int		new_max_size;		/* Increased maximum number of entities. */
+  int		i;			/* Loop variable. */
+  entity	*joe;			/* Reserved entity structure. */
+
+  THREAD_LOCK(pop->lock);
+
+/*
+ * Do we have room for all of the new structures?
+ */
+  if (pop->max_size <= pop->size+pop->num_reserved+num)
+    {
+    new_max_size = (pop->max_size * 3)/2 + 1;
+    if (new_max_size <= pop->size+pop->num_reserved+num)
+      new_max_size = pop->size+pop->num_reserved+num+1;
+    pop->entity_array = s_realloc(pop->entity_array, new_max_size*sizeof(entity*));
+    pop->entity_iarray = s_realloc(pop->entity_iarray, new_max_size*sizeof(entity*));
+
+    for (i=pop->max_size; i<new_max_size; i++)
+      {
+      pop->entity_array[i] = NULL;
+      pop->entity_iarray[i] = NULL;
+      }
+
+    pop->max_size = new_max_size;
+    pop->free_index = new_max_size-1;
+    }
+
+  if (magazine->num_spare+magazine->num_fresh+num > magazine->max_entities)
+    {
+    magazine->max_entities = magazine->max_entities*2+num;
+    magazine->spare = s_realloc(magazine->spare, magazine->max_entities*sizeof(entity*));
+    magazine->spare_id = s_realloc(magazine->spare_id, magazine->max_entities*sizeof(int));
+    magazine->fresh = s_realloc(magazine->fresh, magazine->max_entities*sizeof(entity*));
+    magazine->fresh_id = s_realloc(magazine->fresh_id, magazine->max_entities*sizeof(int));
+    }
+
+  for (i=0; i<num; i++)
+    {
+    while (pop->entity_array[pop->free_index]!=NULL)
+      {
+      if (pop->free_index == 0) pop->free_index=pop->max_size;
+      pop->free_index--;
+      }
+
+    joe = (entity *)mem_chunk_alloc(pop->entity_chunk);
+    pop->entity_array[pop->free_index] = joe;
+    ga_entity_setup_chromosomes(pop, joe, pop->free_index);
+
+    magazine->spare[magazine->num_spare] = joe;
+    magazine->spare_id[magazine->num_spare] = pop->free_index;
+    magazine->num_spare++;
+    }
+
+  pop->num_reserved += num;
+
+  THREAD_UNLOCK(pop->lock);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_magazine_take()
+  synopsis:	Obtain an entity from the calling thread's magazine.
+		It is not ranked until the magazine phase ends.
+  parameters:	population *pop
+  return:	The entity.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static entity *gaul_magazine_take(population *pop)
+  {
+  ga_magazine	*magazine=gaul_magazine_get(pop);	/* This thread's magazine. */
+  entity	*fresh;					/* Entity handed out. */
+
+  if (magazine->num_spare == 0)
+    gaul_magazine_refill(pop, magazine);
+
+  magazine->num_spare--;
+  fresh = magazine->spare[magazine->num_spare];
+  magazine->fresh[magazine->num_fresh] = fresh;
+  magazine->fresh_id[magazine->num_fresh] = magazine->spare_id[magazine->num_spare];
+  magazine->num_fresh++;
+
+  ga_entity_setup_fields(pop, fresh);
+
+  return fresh;
+  }
+
+
+/**********************************************************************
+  gaul_magazine_return()
+  synopsis:	Return an entity to the calling thread's magazine, if
+		it was obtained from there during the current phase.
+  parameters:	population *pop
+		entity *dying
+  return:	TRUE if the entity was returned, FALSE otherwise.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static boolean gaul_magazine_return(population *pop, entity *dying)
+  {
+  ga_magazine	*magazine;	/* This thread's magazine. */
+  int		i;		/* Index of entity in magazine. */
+  int		id;		/* Entity's id. */
+
+  if (thread_magazine_epoch != pop->magazine_epoch) return FALSE;
+
+  magazine = thread_magazine;
+
+/* Most recently obtained entities are the most likely to be returned. */
+  for (i=magazine->num_fresh-1; i>=0 && magazine->fresh[i]!=dying; i--);
+
+  if (i < 0) return FALSE;
+
+  id = magazine->fresh_id[i];
+  magazine->num_fresh--;
+  memmove(&(magazine->fresh[i]), &(magazine->fresh[i+1]), (magazine->num_fresh-i)*sizeof(entity*));
+  memmove(&(magazine->fresh_id[i]), &(magazine->fresh_id[i+1]), (magazine->num_fresh-i)*sizeof(int));
+
+/* Clear user data. */
+  if (dying->data)
+    {
+    destruct_list(pop, dying->data);
+    dying->data=NULL;
+    }
+
+/* Free multiobjective fitness vector. */
+  if ( dying->fitvector != NULL )
+    s_free(dying->fitvector);
 
-  return pop->entity_array[id];
+/* Chromosomes are kept with the entity. */
+  magazine->spare[magazine->num_spare] = dying;
+  magazine->spare_id[magazine->num_spare] = id;
+  magazine->num_spare++;
+
+  return TRUE;
   }
 
 
 /**********************************************************************
-  ga_get_entity_from_rank()
-  synopsis:	Gets a pointer to an entity from it's internal rank.
-		(subscript into the entity_iarray buffer).
-		Note that this only relates to fitness ranking if
-		the population has been properly sorted.
-  parameters:
-  return:
-  last updated: 29 Apr 2004
+  ga_population_begin_magazines()
+  synopsis:	Start a magazine phase.  Until
+		ga_population_end_magazines() is called, each thread
+		that calls ga_get_free_entity() on this population is
+		given a private magazine of entity structures, refilled
+		in batches of the given size.  These entities are not
+		added to entity_iarray[] (and so have no rank, and are
+		not counted in the population's size) until the phase
+		ends, but they may be dereferenced by the same thread
+		without taking the population's lock.
+
+		Entities obtained in other ways, or with ranks, may not
+		be dereferenced concurrently with other work on the
+		population.  A thread should only use magazines for one
+		population at a time.
+
+		If the compiler does not support thread-local storage,
+		this does nothing.
+  parameters:	population *pop
+		const int size	Entities reserved per refill, or 0
+				for the default.
+  return:	none
+  last updated: 17 Oct 2026
  **********************************************************************/
 
-GAULFUNC entity *ga_get_entity_from_rank(population *pop, const unsigned int rank)
+GAULFUNC void ga_population_begin_magazines(population *pop, const int size)
   {
-  if ( !pop ) die("Null pointer to population structure passed.");
 
-  if ( rank > (unsigned) pop->size ) return NULL;
+  if (!pop) die("Null pointer to population structure passed.");
+  if (pop->magazine_epoch != 0) die("Population is already in a magazine phase.");
 
-  return pop->entity_iarray[rank];
+#if HAVE_THREAD_LOCAL==1
+  pop->magazine_size = size>0?size:GA_DEFAULT_MAGAZINE_SIZE;
+
+  THREAD_LOCK(pop_table_lock);
+  magazine_epoch_counter++;
+  if (magazine_epoch_counter <= 0) magazine_epoch_counter = 1;
+  pop->magazine_epoch = magazine_epoch_counter;
+  THREAD_UNLOCK(pop_table_lock);
+#endif
+
+  return;
   }
 
 
 /**********************************************************************
-  ga_entity_setup()
-  synopsis:	Prepares a pre-allocated entity structure for use.
-		Chromosomes are allocated, but will contain garbage.
-  parameters:
-  return:
-  last updated: 24 Apr 2005
+  ga_population_end_magazines()
+  synopsis:	End a magazine phase.  The entities handed out from
+		each thread's magazine are appended to entity_iarray[],
+		one magazine after another, and the unused entity
+		structures are released.  This must not be called
+		while other threads are using the population.
+  parameters:	population *pop
+  return:	none
+  last updated: 17 Oct 2026
  **********************************************************************/
 
-static boolean ga_entity_setup(population *pop, entity *joe)
+GAULFUNC void ga_population_end_magazines(population *pop)
   {
-  int	i;	/* Loop variable over the fitness vector. */
-
-  if (!joe)
-    die("Null pointer to entity structure passed.");
-  if (!pop->chromosome_constructor)
-    die("Chromosome constructor not defined.");
+  ga_magazine	*magazine;	/* Magazine being emptied. */
+  entity	*spare;		/* Unused entity. */
+  int		i;		/* Loop over entities in magazine. */
 
-/* Allocate chromosome structures. */
-  joe->chromosome = NULL;
-  pop->chromosome_constructor(pop, joe);
+  if (!pop) die("Null pointer to population structure passed.");
 
-/* Physical characteristics currently undefined. */
-  joe->data=NULL;
+  if (pop->magazine_epoch == 0) return;
 
-/* No fitness evaluated yet. */
-  joe->fitness = GA_MIN_FITNESS;
+  THREAD_LOCK(pop->lock);
 
-  if ( pop->fitness_dimensions > 0 )
-    { /* This population is being used for multiobjective optimisation. */
-    if ( !(joe->fitvector = s_malloc(sizeof(double)*pop->fitness_dimensions)) )
-      die("Unable to allocate memory");
+  pop->magazine_epoch = 0;
 
-    /* Clear multiobjective fitness vector. */
-    for (i=0; i<pop->fitness_dimensions; i++)
-      joe->fitvector[i] = GA_MIN_FITNESS;
-    }
-  else
+  while ( (magazine = pop->magazines) )
     {
-    joe->fitvector = NULL;
+    pop->magazines = magazine->next;
+
+    for (i=0; i<magazine->num_fresh; i++)
+      {
+      pop->entity_iarray[pop->size] = magazine->fresh[i];
+      magazine->fresh[i]->rank = pop->size;
+      pop->size++;
+      }
+
+    for (i=0; i<magazine->num_spare; i++)
+      {
+      spare = magazine->spare[i];
+
+      if (pop->arena_chromosome_size > 0)
+        spare->chromosome = NULL;
+      else if (!gaul_chromosome_recycle(pop, spare))
+        pop->chromosome_destructor(pop, spare);
+
+      pop->entity_array[magazine->spare_id[i]] = NULL;
+      mem_chunk_free(pop->entity_chunk, spare);
+      }
+
+    pop->num_reserved -= magazine->num_fresh+magazine->num_spare;
+
+    if (magazine->spare) s_free(magazine->spare);
+    if (magazine->spare_id) s_free(magazine->spare_id);
+    if (magazine->fresh) s_free(magazine->fresh);
+    if (magazine->fresh_id) s_free(magazine->fresh_id);
+    s_free(magazine);
     }
 
-  return TRUE;
+  THREAD_UNLOCK(pop->lock);
+
+  return;
   }
 
 
@@ -1419,7 +2091,7 @@ static boolean ga_entity_setup(population *pop, entity *joe)
 		Note, no error checking in the interests of speed.
   parameters:
   return:
-  last updated:	19 Mar 2002
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_entity_dereference_by_rank(population *pop, int rank)
@@ -1442,21 +2114,33 @@ GAULFUNC boolean ga_entity_dereference_by_rank(population *pop, int rank)
 
   THREAD_LOCK(pop->lock);
 
+/* Leave the steady-state replacement heap. */
+  if (dying->heap_pos >= 0)
+    gaul_replace_heap_remove(pop, dying);
+
 /* Population size is one less now! */
   pop->size--;
 
-/* Deallocate chromosomes. */
-  if (dying->chromosome) pop->chromosome_destructor(pop, dying);
+/* Deallocate chromosomes.  Those in an arena or the pool are kept for re-use. */
+  if (dying->chromosome)
+    {
+    if (pop->arena_chromosome_size > 0)
+      dying->chromosome = NULL;
+    else if (!gaul_chromosome_recycle(pop, dying))
+      pop->chromosome_destructor(pop, dying);
+    }
 
 /* Update entity_iarray[], so there are no gaps! */
   for (i=rank; i<pop->size; i++)
+    {
     pop->entity_iarray[i] = pop->entity_iarray[i+1];
+    pop->entity_iarray[i]->rank = i;
+    }
 
   pop->entity_iarray[pop->size] = NULL;
 
 /* Release index. */
-  i = ga_get_entity_id(pop, dying);
-  pop->entity_array[ga_get_entity_id(pop, dying)] = NULL;
+  pop->entity_array[dying->id] = NULL;
 
   THREAD_UNLOCK(pop->lock);
 
@@ -1478,10 +2162,12 @@ GAULFUNC boolean ga_entity_dereference_by_rank(population *pop, int rank)
 		If rank is known, this is much quicker than the plain
 		ga_entity_dereference() function, while this index
 		based version is still almost as fast.
+		During a magazine phase, entities obtained from the
+		calling thread's magazine are returned to it.
 		Note, no error checking in the interests of speed.
   parameters:
   return:
-  last updated:	19 Mar 2002
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_entity_dereference_by_id(population *pop, int id)
@@ -1491,6 +2177,9 @@ GAULFUNC boolean ga_entity_dereference_by_id(population *pop, int id)
 
   if (!dying) die("Invalid entity index");
 
+  if (pop->magazine_epoch != 0 && gaul_magazine_return(pop, dying))
+    return TRUE;
+
 /* Clear user data. */
   if (dying->data)
     {
@@ -1504,18 +2193,30 @@ GAULFUNC boolean ga_entity_dereference_by_id(population *pop, int id)
 
   THREAD_LOCK(pop->lock);
 
+/* Leave the steady-state replacement heap. */
+  if (dying->heap_pos >= 0)
+    gaul_replace_heap_remove(pop, dying);
+
 /* Update entity_iarray[], so there are no gaps! */
-  for (i=ga_get_entity_rank(pop, dying); i<pop->size; i++)
+  for (i=gaul_entity_position(pop, dying); i<pop->size; i++)
+    {
     pop->entity_iarray[i] = pop->entity_iarray[i+1];
+    if (pop->entity_iarray[i]) pop->entity_iarray[i]->rank = i;
+    }
 
 /* Population size is one less now! */
   pop->size--;
 
   pop->entity_iarray[pop->size] = NULL;
 
-/* Deallocate chromosomes. */
+/* Deallocate chromosomes.  Those in an arena or the pool are kept for re-use. */
   if (dying->chromosome)
-    pop->chromosome_destructor(pop, dying);
+    {
+    if (pop->arena_chromosome_size > 0)
+      dying->chromosome = NULL;
+    else if (!gaul_chromosome_recycle(pop, dying))
+      pop->chromosome_destructor(pop, dying);
+    }
 
   THREAD_UNLOCK(pop->lock);
 
@@ -1540,15 +2241,163 @@ GAULFUNC boolean ga_entity_dereference_by_id(population *pop, int id)
 		If rank is known, the above
 		ga_entity_dereference_by_rank() or
 		ga_entity_dereference_by_id() functions are much
-		faster.
+		faster.  During a magazine phase, entities obtained
+		from the calling thread's magazine are returned to it.
   parameters:
   return:
-  last updated:	16/03/01
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_entity_dereference(population *pop, entity *dying)
   {
-  return ga_entity_dereference_by_rank(pop, ga_get_entity_rank(pop, dying));
+
+  if (pop->magazine_epoch != 0 && gaul_magazine_return(pop, dying))
+    return TRUE;
+
+  return ga_entity_dereference_by_rank(pop, gaul_entity_position(pop, dying));
+  }
+
+
+/**********************************************************************
+  gaul_entity_dereference_bulk()
+  synopsis:	Marks many entity structures as unused in a single
+		pass.  An entity dies if its rank is within
+		[first, end), or if it is flagged in the optional
+		mask.  entity_iarray[] is compacted once, preserving
+		the order of the survivors, rather than being shifted
+		for every dead entity.
+  parameters:	population *pop
+		const boolean *mask	Flags, indexed by rank, or NULL.
+		const int first		First rank to kill.
+		const int end		One past the last rank to kill.
+  return:	Number of entities dereferenced.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_entity_dereference_bulk(population *pop, const boolean *mask,
+                                        const int first, const int end)
+  {
+  int		i;		/* Loop variable over the indexed array. */
+  int		num_alive=0;	/* Number of survivors so far. */
+  int		num_dead;	/* Number of dereferenced entities. */
+  entity	*dying;		/* Current entity. */
+
+/* Clear user data and multiobjective fitness vectors. */
+  for (i=0; i<pop->size; i++)
+    {
+    if ( (i>=first && i<end) || (mask && mask[i]) )
+      {
+      dying = pop->entity_iarray[i];
+
+      if (!dying) die("Invalid entity rank");
+
+      if (dying->data)
+        {
+        destruct_list(pop, dying->data);
+        dying->data=NULL;
+        }
+
+      if ( dying->fitvector != NULL )
+        {
+        s_free(dying->fitvector);
+        dying->fitvector = NULL;
+        }
+      }
+    }
+
+  THREAD_LOCK(pop->lock);
+
+  for (i=0; i<pop->size; i++)
+    {
+    dying = pop->entity_iarray[i];
+
+    if ( (i>=first && i<end) || (mask && mask[i]) )
+      {
+/* Leave the steady-state replacement heap. */
+      if (dying->heap_pos >= 0)
+        gaul_replace_heap_remove(pop, dying);
+
+/* Deallocate chromosomes.  Those in an arena or the pool are kept for re-use. */
+      if (dying->chromosome)
+        {
+        if (pop->arena_chromosome_size > 0)
+          dying->chromosome = NULL;
+        else if (!gaul_chromosome_recycle(pop, dying))
+          pop->chromosome_destructor(pop, dying);
+        }
+
+/* Release index and memory. */
+      pop->entity_array[dying->id] = NULL;
+      mem_chunk_free(pop->entity_chunk, dying);
+      }
+    else
+      {
+/* Survivors slide down, so there are no gaps! */
+      pop->entity_iarray[num_alive] = dying;
+      dying->rank = num_alive;
+      num_alive++;
+      }
+    }
+
+  for (i=num_alive; i<pop->size; i++)
+    pop->entity_iarray[i] = NULL;
+
+  num_dead = pop->size-num_alive;
+  pop->size = num_alive;
+
+  THREAD_UNLOCK(pop->lock);
+
+  return num_dead;
+  }
+
+
+/**********************************************************************
+  ga_entity_dereference_by_mask()
+  synopsis:	Marks all entities flagged in the mask as unused.
+		The mask is indexed by rank and should contain
+		pop->size elements.  This is much faster than
+		dereferencing the entities individually, since the
+		ranked array is compacted just once.  The relative
+		order of the surviving entities is unchanged.
+  parameters:	population *pop
+		const boolean *mask	TRUE for each rank to kill.
+  return:	Number of entities dereferenced.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_entity_dereference_by_mask(population *pop, const boolean *mask)
+  {
+
+  if (!pop) die("Null pointer to population structure passed.");
+  if (!mask) die("Null pointer to mask passed.");
+
+  return gaul_entity_dereference_bulk(pop, mask, 0, 0);
+  }
+
+
+/**********************************************************************
+  ga_entity_dereference_by_rank_range()
+  synopsis:	Marks all entities with ranks within [first, end) as
+		unused, in a single pass.  The relative order of the
+		surviving entities is unchanged.  An empty range is
+		allowed.
+  parameters:	population *pop
+		int first	First rank to kill.
+		int end		One past the last rank to kill.
+  return:	Number of entities dereferenced.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_entity_dereference_by_rank_range(population *pop, int first, int end)
+  {
+
+  if (!pop) die("Null pointer to population structure passed.");
+
+  if (first < 0) first = 0;
+  if (end > pop->size) end = pop->size;
+  if (first >= end) return 0;
+
+  return gaul_entity_dereference_bulk(pop, NULL, first, end);
   }
 
 
@@ -1619,10 +2468,13 @@ GAULFUNC void ga_entity_blank(population *p, entity *this_entity)
   ga_get_free_entity()
   synopsis:	Returns pointer to an unused entity structure from the
 		population's entity pool.  Increments population size
-		too.
+		too.  During a magazine phase, the entity is instead
+		taken from the calling thread's magazine, and is not
+		ranked until the phase ends.  See
+		ga_population_begin_magazines().
   parameters:	population *pop
   return:	entity *this_entity
-  last updated: 18 Mar 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC entity *ga_get_free_entity(population *pop)
@@ -1631,6 +2483,12 @@ GAULFUNC entity *ga_get_free_entity(population *pop)
   int		i;
   entity	*fresh;		/* Unused entity structure. */
 
+/*
+ * During a magazine phase, the calling thread's magazine is used.
+ */
+  if (pop->magazine_epoch != 0)
+    return gaul_magazine_take(pop);
+
 /*
   plog(LOG_DEBUG, "Locating free entity structure.");
 */
@@ -1639,7 +2497,7 @@ GAULFUNC entity *ga_get_free_entity(population *pop)
 /*
  * Do we have room for any new structures?
  */
-  if (pop->max_size == (pop->size+1))
+  if (pop->max_size <= pop->size+pop->num_reserved+1)
     {	/* No, so allocate some more space. */
     plog(LOG_VERBOSE, "No unused entities available -- allocating additional structures.");
 
@@ -1668,10 +2526,11 @@ GAULFUNC entity *ga_get_free_entity(population *pop)
   fresh = (entity *)mem_chunk_alloc(pop->entity_chunk);
 
   pop->entity_array[pop->free_index] = fresh;
-  ga_entity_setup(pop, fresh);
+  ga_entity_setup(pop, fresh, pop->free_index);
 
 /* Store in lowest free slot in entity_iarray */
   pop->entity_iarray[pop->size] = fresh;
+  fresh->rank = pop->size;
 
 /* Population is bigger now! */
   pop->size++;
@@ -1684,6 +2543,78 @@ GAULFUNC entity *ga_get_free_entity(population *pop)
   }
 
 
+/**********************************************************************
+  ga_get_free_entities()
+  synopsis:	Like ga_get_free_entity(), but obtains num unused
+		entity structures at once.  The population's lock is
+		taken, and its arrays grown, only once.  The entities
+		occupy consecutive ranks, in the order they are
+		returned.
+  parameters:	population *pop
+		const int num		Number of entities required.
+		entity **fresh		Array to receive the entities.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_get_free_entities(population *pop, const int num, entity **fresh)
+  {
+  int		new_max_size;	/* Increased maximum number of entities. */
+  int		i;
+
+  if (num < 1) return;
+
+  THREAD_LOCK(pop->lock);
+
+/*
+ * Do we have room for all of the new structures?
+ */
+  if (pop->max_size <= pop->size+pop->num_reserved+num)
+    {	/* No, so allocate some more space. */
+    plog(LOG_VERBOSE, "Insufficient unused entities available -- allocating additional structures.");
+
+    new_max_size = (pop->max_size * 3)/2 + 1;
+    if (new_max_size <= pop->size+pop->num_reserved+num)
+      new_max_size = pop->size+pop->num_reserved+num+1;
+    pop->entity_array = s_realloc(pop->entity_array, new_max_size*sizeof(entity*));
+    pop->entity_iarray = s_realloc(pop->entity_iarray, new_max_size*sizeof(entity*));
+
+    for (i=pop->max_size; i<new_max_size; i++)
+      {
+      pop->entity_array[i] = NULL;
+      pop->entity_iarray[i] = NULL;
+      }
+
+    pop->max_size = new_max_size;
+    pop->free_index = new_max_size-1;
+    }
+
+  for (i=0; i<num; i++)
+    {
+/* Find unused entity index. */
+    while (pop->entity_array[pop->free_index]!=NULL)
+      {
+      if (pop->free_index == 0) pop->free_index=pop->max_size;
+      pop->free_index--;
+      }
+
+/* Prepare it. */
+    fresh[i] = (entity *)mem_chunk_alloc(pop->entity_chunk);
+
+    pop->entity_array[pop->free_index] = fresh[i];
+    ga_entity_setup(pop, fresh[i], pop->free_index);
+
+    pop->entity_iarray[pop->size] = fresh[i];
+    fresh[i]->rank = pop->size;
+    pop->size++;
+    }
+
+  THREAD_UNLOCK(pop->lock);
+
+  return;
+  }
+
+
 /**********************************************************************
   ga_copy_data()
   synopsis:	Copy one chromosome's portion of the data field of an
@@ -2599,6 +3530,69 @@ GAULFUNC void ga_population_set_allele_mutation_prob(	population	*pop,
   }
 
 
+/**********************************************************************
+  ga_population_set_reproducible()
+  synopsis:	Sets whether a population's parallel optimisation
+		routines use counter-based random numbers.  When set,
+		random numbers drawn while breeding or evaluating an
+		entity in ga_evolution_threaded(),
+		ga_evolution_archipelago_threaded() and
+		ga_differentialevolution() are keyed by the seed, the
+		generation, the island and the entity's index.  The
+		results are then identical whatever the number of
+		threads.
+  parameters:	population *pop
+		const boolean reproducible
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_population_set_reproducible(	population	*pop,
+					const boolean	reproducible)
+  {
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+
+  plog( LOG_VERBOSE, "Population's reproducible flag = %s", reproducible?"TRUE":"FALSE");
+
+  pop->reproducible = reproducible;
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_population_set_sort_type()
+  synopsis:	Sets the method used to sort a population by fitness.
+		GA_SORT_AUTO, the default, radix sorts populations of
+		at least 64 entities, and where only the survivors
+		need ordering those are first isolated by a radix
+		top-k selection.  Smaller populations are shuffle
+		sorted.  GA_SORT_SHUFFLE always uses the shuffle sort,
+		and GA_SORT_RADIX always radix sorts the entire
+		population.  Every method gives the same ordering of
+		the surviving entities.  Populations with a custom
+		ranking function are always shuffle sorted.
+  parameters:	population *pop
+		const ga_sort_type sort_type
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_population_set_sort_type(	population	*pop,
+					const ga_sort_type	sort_type)
+  {
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+
+  plog( LOG_VERBOSE, "Population's sort type = %d", (int) sort_type);
+
+  pop->sort_type = sort_type;
+
+  return;
+  }
+
+
 /**********************************************************************
   ga_population_set_allele_min_integer()
   synopsis:	Sets the minimum value for an integer allele for a
@@ -2756,7 +3750,7 @@ GAULFUNC unsigned int ga_resurect(population *pop)
 		specified value.
   parameters:
   return:
-  last updated:	22 Aug 2002
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_genocide(population *pop, int target_size)
@@ -2771,12 +3765,7 @@ GAULFUNC boolean ga_genocide(population *pop, int target_size)
  * Dereference the structures relating to the least
  * fit population members until the desired population size in reached. 
  */
-  while (pop->size>target_size)
-    {
-/*printf("Dereferencing entity with rank %d (fitness = %d)\n",
-         pop->size-1, pop->entity_iarray[pop->size-1]->fitness);*/
-    ga_entity_dereference_by_rank(pop, pop->size-1);
-    }
+  ga_entity_dereference_by_rank_range(pop, target_size, pop->size);
 
   return TRUE;
   }
@@ -2788,11 +3777,13 @@ GAULFUNC boolean ga_genocide(population *pop, int target_size)
 		specified value.
   parameters:
   return:
-  last updated:	01 Jul 2004
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_genocide_by_fitness(population *pop, double target_fitness)
   {
+  int	first;	/* First rank to kill. */
+
   if ( !pop ) return FALSE;
 
   plog(LOG_VERBOSE,
@@ -2800,16 +3791,15 @@ GAULFUNC boolean ga_genocide_by_fitness(population *pop, double target_fitness)
             pop->size, target_fitness);
 
 /*
- * Dereference the structures relating to the least
- * fit population members until the desired population size in reached. 
+ * Find the first of the trailing, least fit, population members
+ * below the fitness threshold, then dereference them all at once.
  */
-  while ( pop->size>0 &&
-          pop->entity_iarray[pop->size-1]->fitness<target_fitness )
-    {
-/*printf("Dereferencing entity with rank %d (fitness = %d)\n",
-         pop->size-1, pop->entity_iarray[pop->size-1]->fitness);*/
-    ga_entity_dereference_by_rank(pop, pop->size-1);
-    }
+  first = pop->size;
+  while ( first>0 &&
+          pop->entity_iarray[first-1]->fitness<target_fitness )
+    first--;
+
+  ga_entity_dereference_by_rank_range(pop, first, pop->size);
 
   return TRUE;
   }
@@ -2821,7 +3811,7 @@ GAULFUNC boolean ga_genocide_by_fitness(population *pop, double target_fitness)
 		it from the population table.
   parameters:
   return:
-  last updated:	15 Aug 2002
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_extinction(population *extinct)
@@ -2856,6 +3846,8 @@ GAULFUNC boolean ga_extinction(population *extinct)
 /*
  * Dereference/free everyting.
  */
+  ga_population_end_magazines(extinct);
+
   if (!ga_genocide(extinct, 0))
     {
     plog(LOG_NORMAL, "This population is already extinct!");
@@ -2865,6 +3857,12 @@ GAULFUNC boolean ga_extinction(population *extinct)
     s_free(extinct->entity_array);
     s_free(extinct->entity_iarray);
     mem_chunk_destroy(extinct->entity_chunk);
+    gaul_chromosome_arena_free(extinct);
+    gaul_chromosome_pool_free(extinct);
+    gaul_replace_heap_free(extinct);
+    gaul_select_free(extinct);
+    gaul_archive_free(extinct);
+    if (extinct->hypervolume_reference) s_free(extinct->hypervolume_reference);
 
 #ifdef USE_CHROMO_CHUNKS
     mem_chunk_destroy(extinct->chromo_chunk);
@@ -3187,6 +4185,37 @@ GAULFUNC boolean ga_population_set_fitness_dimensions(population *pop, int num)
   }
 
 
+/**********************************************************************
+  ga_population_set_evaluate_batch()
+  synopsis:	Set an optional callback which evaluates several
+		entities at once.  Where the optimisation routines
+		have a number of entities to evaluate, they pass
+		them to this callback in chunks of at most
+		batch_size entities.  A batch_size of zero means
+		that all available entities are passed together.
+		Pass a NULL callback to revert to one-at-a-time
+		evaluation.
+  parameters:	population *pop
+		GAevaluate_batch evaluate_batch
+		const int batch_size
+  return:	success
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC boolean ga_population_set_evaluate_batch(population *pop,
+                            GAevaluate_batch evaluate_batch,
+                            const int batch_size)
+  {
+  if ( !pop ) return FALSE;
+  if ( batch_size < 0 ) return FALSE;
+
+  pop->evaluate_batch = evaluate_batch;
+  pop->evaluate_batch_size = batch_size;
+
+  return TRUE;
+  }
+
+
 /**********************************************************************
   ga_population_get_crossover()
   synopsis:	Gets the crossover rate of a population.
@@ -3359,6 +4388,23 @@ GAULFUNC ga_elitism_type ga_population_get_elitism(population	*pop)
   }
 
 
+/**********************************************************************
+  ga_population_get_sort_type()
+  synopsis:	Gets the method used to sort a population.
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC ga_sort_type ga_population_get_sort_type(population	*pop)
+  {
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+
+  return pop->sort_type;
+  }
+
+
 /**********************************************************************
   ga_init_openmp()
   synopsis:	Initialises OpenMP code.
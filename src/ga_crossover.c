@@ -987,52 +987,39 @@ GAULFUNC void ga_crossover_bitstring_mixing(population *pop, entity *father, ent
 		alleles.
 		Keeps no chromosomes intact, and therefore will
 		need to recreate all structural data.
+		A random mask is drawn for each chromosome, and the
+		children are blended from the parents under it, a
+		word at a time.
   parameters:
   return:
-  last updated: 30/06/01
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_crossover_bitstring_allele_mixing( population *pop,
                                  entity *father, entity *mother,
                                  entity *son, entity *daughter )
   {
-  int		i, j;		/* Loop over all chromosomes, alleles. */
+  int		i;		/* Loop over all chromosomes. */
+  gaulbyte	*mask;		/* Alleles which the son takes from the father. */
 
   /* Checks. */
   if (!father || !mother || !son || !daughter)
     die("Null pointer to entity structure passed.");
 
+  mask = ga_bit_new(pop->len_chromosomes);
+
   for (i=0; i<pop->num_chromosomes; i++)
     {
-    for (j=0; j<pop->len_chromosomes; j++)
-      {
-      if (random_boolean())
-        {
-        if (ga_bit_get(father->chromosome[i],j))
-          ga_bit_set(son->chromosome[i],j);
-        else
-          ga_bit_clear(son->chromosome[i],j);
-
-        if (ga_bit_get(mother->chromosome[i],j))
-          ga_bit_set(daughter->chromosome[i],j);
-        else
-          ga_bit_clear(daughter->chromosome[i],j);
-        }
-      else
-        {
-        if (ga_bit_get(father->chromosome[i],j))
-          ga_bit_set(daughter->chromosome[i],j);
-        else
-          ga_bit_clear(daughter->chromosome[i],j);
-
-        if (ga_bit_get(mother->chromosome[i],j))
-          ga_bit_set(son->chromosome[i],j);
-        else
-          ga_bit_clear(son->chromosome[i],j);
-        }
-      }
+    random_fill_bitmask(mask, pop->len_chromosomes, 0.5);
+
+    ga_bit_blend(son->chromosome[i], father->chromosome[i],
+                 mother->chromosome[i], mask, pop->len_chromosomes);
+    ga_bit_blend(daughter->chromosome[i], mother->chromosome[i],
+                 father->chromosome[i], mask, pop->len_chromosomes);
     }
 
+  ga_bit_free(mask);
+
   return;
   }
 
@@ -107,13 +107,54 @@ static void _gaul_pick_random_entities(int *permutation, int num, int size, int
   return;
   }
 
+/*
+ * Pick a number of distinct random entities, other than avoid, without
+ * reference to any shared state.  Used for reproducible populations.
+ * num is small, so rejection is cheap.
+ */
+
+static void _gaul_pick_distinct_entities(int *picked, int num, int size, int avoid)
+  {
+  int		j, k;		/* Loop variables over picked numbers. */
+
+  for (j=0; j<num; j++)
+    {
+    do
+      {
+      picked[j] = random_int(size);
+      for (k=0; k<j && picked[k]!=picked[j]; k++);
+      } while (picked[j] == avoid || k<j);
+    }
+
+  return;
+  }
+
+static void _gaul_pick_entities(population *pop, int *picks, int num, int size, int avoid)
+  {
+
+  if (pop->reproducible)
+    _gaul_pick_distinct_entities(picks, num, size, avoid);
+  else
+    _gaul_pick_random_entities(picks, num, size, avoid);
+
+  return;
+  }
+
 
 /**********************************************************************
   ga_differentialevolution()
   synopsis:	Performs differential evolution.
+		If the population is reproducible (see
+		ga_population_set_reproducible()), each trial uses
+		counter-based random numbers and, under OpenMP, trials
+		are constructed in parallel with results that do not
+		depend on the number of threads.  If the population
+		has a batch evaluation callback (see
+		ga_population_set_evaluate_batch()), each generation's
+		trials are evaluated together.
   parameters:
   return:
-  last updated:	12 Apr 2005
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_differentialevolution(	population		*pop,
@@ -123,7 +164,12 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
   int		i;			/* Loop variable over entities. */
   int		best;			/* Index of best entity. */
   int		*permutation;		/* Permutation array for random selections. */
+  int		picked[7];		/* Random selections for reproducible populations. */
+  int		*picks;			/* Random selections for current trial. */
+  entity	**trials;		/* New entities. */
   entity	*tmpentity;		/* New entity. */
+  random_counter	counter;		/* Counter-based PRNG for current trial. */
+  random_counter	*previous_counter=NULL;	/* PRNG counter to restore. */
   int		L, n;			/* Allele indices. */
   double	weighting_factor;	/* Weighting multiplier. */
 
@@ -150,17 +196,7 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
   if (pop->size < pop->stable_size)
     gaul_population_fill(pop, pop->stable_size - pop->size);
 
-  if (pop->entity_iarray[0]->fitness == GA_MIN_FITNESS)
-    pop->evaluate(pop, pop->entity_iarray[0]);
-
-#pragma omp parallel for \
-   shared(pop) private(i) \
-   schedule(static)
-  for (i=0; i<pop->size; i++)
-    {
-    if (pop->entity_iarray[i]->fitness == GA_MIN_FITNESS)
-      pop->evaluate(pop, pop->entity_iarray[i]);
-    }
+  gaul_population_evaluate_ranks(pop, 0, pop->size, TRUE);
 
 /*
  * Prepare arrays to store permutations.
@@ -227,14 +263,42 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
               "Best fitness is %f at start of generation %d",
               pop->entity_iarray[best]->fitness, generation );
 
+/*
+ * Create all trial entities up front, so that their order does not
+ * depend on scheduling.
+ */
+    if ( !(trials = s_malloc(sizeof(entity *)*pop->orig_size)) )
+      die("Unable to allocate memory");
+
+    for (i=0; i<pop->orig_size; i++)
+      trials[i] = ga_entity_clone(pop, pop->entity_iarray[i]);
+
+/*
+ * For a reproducible population, every trial draws random numbers from
+ * its own counter-based sequence and picks entities independently.
+ * The trials may then safely be constructed in parallel.  Otherwise,
+ * picks are made from a shared permutation, so this loop is serial.
+ */
 #pragma omp parallel for \
-   if (GAUL_DETERMINISTIC_OPENMP==0) \
-   shared(pop) private(i) \
+   if (pop->reproducible) \
+   shared(pop, trials, permutation, best, weighting_factor, generation) \
+   private(i, tmpentity, n, L, picks, picked, counter, previous_counter) \
    schedule(static)
     for (i=0; i<pop->orig_size; i++)
       {
 
-      tmpentity = ga_entity_clone(pop, pop->entity_iarray[i]);
+      if (pop->reproducible)
+        {
+        gaul_random_counter_init(pop, &counter, i, GA_COUNTER_DE);
+        previous_counter = random_set_thread_counter(&counter);
+        picks = picked;
+        }
+      else
+        {
+        picks = permutation;
+        }
+
+      tmpentity = trials[i];
       n = random_int(pop->len_chromosomes);
 
 /*
@@ -251,20 +315,20 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           if (pop->de_params->num_perturbed == 1)
             { /* DE/best/1/bin */
 
-            _gaul_pick_random_entities(permutation, 2, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 2, pop->orig_size, i);
 
             ((double *)tmpentity->chromosome[0])[n] =
               ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-              + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]);
+              + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]);
 
             for (L=1; L<pop->len_chromosomes; L++)
               {
               if ( random_boolean() )
                 ((double *)tmpentity->chromosome[0])[n] =
                   ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-                  + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]);
+                  + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               }
@@ -273,24 +337,24 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           else if (pop->de_params->num_perturbed == 2)
             { /* DE/best/2/bin */
 
-            _gaul_pick_random_entities(permutation, 4, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 4, pop->orig_size, i);
 
             ((double *)tmpentity->chromosome[0])[n] =
               ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-              + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]);
+              + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]);
 
             for (L=1; L<pop->len_chromosomes; L++)
               {
               if ( random_boolean() )
                 ((double *)tmpentity->chromosome[0])[n] =
                   ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-                  + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                    + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]);
+                  + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                    + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               }
@@ -299,28 +363,28 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           else if (pop->de_params->num_perturbed == 3)
             { /* DE/best/3/exp */
 
-            _gaul_pick_random_entities(permutation, 6, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 6, pop->orig_size, i);
 
             ((double *)tmpentity->chromosome[0])[n] =
               ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-              + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[5]]->chromosome[0])[n]);
+              + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[5]]->chromosome[0])[n]);
 
             for (L=1; L<pop->len_chromosomes; L++)
               {
               if ( random_boolean() )
                 ((double *)tmpentity->chromosome[0])[n] =
                   ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-                  + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                    + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                    + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[5]]->chromosome[0])[n]);
+                  + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                    + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                    + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[5]]->chromosome[0])[n]);
 
 
               n = (n+1)%pop->len_chromosomes;
@@ -336,20 +400,20 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           {
           if (pop->de_params->num_perturbed == 1)
             { /* DE/rand/1/bin */
-            _gaul_pick_random_entities(permutation, 3, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 3, pop->orig_size, i);
 
             ((double *)tmpentity->chromosome[0])[n] =
-              ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-              + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]);
+              ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+              + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]);
 
             for (L=1; L<pop->len_chromosomes; L++)
               {
               if ( random_boolean() )
                 ((double *)tmpentity->chromosome[0])[n] =
-                  ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                  + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]);
+                  ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                  + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               }
@@ -357,24 +421,24 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
             }
           else if (pop->de_params->num_perturbed == 2)
             { /* DE/rand/2/bin */
-            _gaul_pick_random_entities(permutation, 5, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 5, pop->orig_size, i);
 
             ((double *)tmpentity->chromosome[0])[n] =
-              ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-              + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]);
+              ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+              + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]);
 
             for (L=1; L<pop->len_chromosomes; L++)
               {
               if ( random_boolean() )
                 ((double *)tmpentity->chromosome[0])[n] =
-                  ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                  + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                    + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]);
+                  ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                  + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                    + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               }
@@ -382,28 +446,28 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
             }
           else if (pop->de_params->num_perturbed == 3)
             { /* DE/rand/3/bin */
-            _gaul_pick_random_entities(permutation, 7, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 7, pop->orig_size, i);
 
             ((double *)tmpentity->chromosome[0])[n] =
-              ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-              + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[5]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[6]]->chromosome[0])[n]);
+              ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+              + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                + ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[5]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[6]]->chromosome[0])[n]);
 
             for (L=1; L<pop->len_chromosomes; L++)
               {
               if ( random_boolean() )
                 ((double *)tmpentity->chromosome[0])[n] =
-                  ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                  + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                    + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                    + ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[5]]->chromosome[0])[n]
-                                    - ((double *)pop->entity_iarray[permutation[6]]->chromosome[0])[n]);
+                  ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                  + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                    + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                    + ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[5]]->chromosome[0])[n]
+                                    - ((double *)pop->entity_iarray[picks[6]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               }
@@ -418,13 +482,13 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           {
           if (pop->de_params->num_perturbed == 1)
             { /* DE/rand-to-best/1/bin */
-            _gaul_pick_random_entities(permutation, 2, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 2, pop->orig_size, i);
 
             ((double *)tmpentity->chromosome[0])[n] +=
               weighting_factor*(((double *)pop->entity_iarray[best]->chromosome[0])[n]
                               - ((double *)tmpentity->chromosome[0])[n]
-                              + ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                              - ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]);
+                              + ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                              - ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]);
 
             for (L=1; L<pop->len_chromosomes; L++)
               {
@@ -432,8 +496,8 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
                 ((double *)tmpentity->chromosome[0])[n] +=
                   weighting_factor*(((double *)pop->entity_iarray[best]->chromosome[0])[n]
                                   - ((double *)tmpentity->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]);
+                                  + ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               }
@@ -441,15 +505,15 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
             }
           else if (pop->de_params->num_perturbed == 2)
             { /* DE/rand-to-best/2/bin */
-            _gaul_pick_random_entities(permutation, 4, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 4, pop->orig_size, i);
 
             ((double *)tmpentity->chromosome[0])[n] +=
               weighting_factor*(((double *)pop->entity_iarray[best]->chromosome[0])[n]
                               - ((double *)tmpentity->chromosome[0])[n]
-                              + ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                              + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                              - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                              - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]);
+                              + ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                              + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                              - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                              - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]);
 
             for (L=1; L<pop->len_chromosomes; L++)
               {
@@ -457,10 +521,10 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
                 ((double *)tmpentity->chromosome[0])[n] +=
                   weighting_factor*(((double *)pop->entity_iarray[best]->chromosome[0])[n]
                                   - ((double *)tmpentity->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]);
+                                  + ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                  + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               }
@@ -484,15 +548,15 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           if (pop->de_params->num_perturbed == 1)
             { /* DE/best/1/exp */
 
-            _gaul_pick_random_entities(permutation, 2, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 2, pop->orig_size, i);
 
             L = 0;
             do
               {
               ((double *)tmpentity->chromosome[0])[n] =
                 ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-                + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]);
+                + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               L++;
@@ -502,17 +566,17 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           else if (pop->de_params->num_perturbed == 2)
             { /* DE/best/2/exp */
 
-            _gaul_pick_random_entities(permutation, 4, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 4, pop->orig_size, i);
 
             L = 0;
             do
               {
               ((double *)tmpentity->chromosome[0])[n] =
                 ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-                + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]);
+                + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                  + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               L++;
@@ -521,19 +585,19 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           else if (pop->de_params->num_perturbed == 3)
             { /* DE/best/3/exp */
 
-            _gaul_pick_random_entities(permutation, 6, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 6, pop->orig_size, i);
 
             L = 0;
             do
               {
               ((double *)tmpentity->chromosome[0])[n] =
                 ((double *)pop->entity_iarray[best]->chromosome[0])[n]
-                + weighting_factor*(((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[5]]->chromosome[0])[n]);
+                + weighting_factor*(((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                  + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                  + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[5]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               L++;
@@ -550,15 +614,15 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           if (pop->de_params->num_perturbed == 1)
             { /* DE/rand/1/exp (DE1) */
 
-            _gaul_pick_random_entities(permutation, 3, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 3, pop->orig_size, i);
 
             L = 0;
             do
               {
               ((double *)tmpentity->chromosome[0])[n] =
-                ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]);
+                ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               L++;
@@ -568,17 +632,17 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           else if (pop->de_params->num_perturbed == 2)
             { /* DE/rand/2/exp */
 
-            _gaul_pick_random_entities(permutation, 5, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 5, pop->orig_size, i);
 
             L = 0;
             do
               {
               ((double *)tmpentity->chromosome[0])[n] =
-                ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]);
+                ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                  + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               L++;
@@ -588,19 +652,19 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           else if (pop->de_params->num_perturbed == 3)
             { /* DE/rand/3/exp */
 
-            _gaul_pick_random_entities(permutation, 7, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 7, pop->orig_size, i);
 
             L = 0;
             do
               {
               ((double *)tmpentity->chromosome[0])[n] =
-                ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                + weighting_factor*(((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                  + ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[4]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[5]]->chromosome[0])[n]
-                                  - ((double *)pop->entity_iarray[permutation[6]]->chromosome[0])[n]);
+                ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                + weighting_factor*(((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                  + ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                  + ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[4]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[5]]->chromosome[0])[n]
+                                  - ((double *)pop->entity_iarray[picks[6]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               L++;
@@ -618,7 +682,7 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           if (pop->de_params->num_perturbed == 1)
             { /* DE/rand-to-best/1/exp */
 
-            _gaul_pick_random_entities(permutation, 2, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 2, pop->orig_size, i);
 
             L = 0;
             do
@@ -626,8 +690,8 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
               ((double *)tmpentity->chromosome[0])[n] +=
                 weighting_factor*(((double *)pop->entity_iarray[best]->chromosome[0])[n]
                                 - ((double *)tmpentity->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]);
+                                + ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               L++;
@@ -637,7 +701,7 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
           else if (pop->de_params->num_perturbed == 2)
             { /* DE/rand-to-best/2/exp */
 
-            _gaul_pick_random_entities(permutation, 4, pop->orig_size, i);
+            _gaul_pick_entities(pop, picks, 4, pop->orig_size, i);
 
             L = 0;
             do
@@ -645,10 +709,10 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
               ((double *)tmpentity->chromosome[0])[n] +=
                 weighting_factor*(((double *)pop->entity_iarray[best]->chromosome[0])[n]
                                 - ((double *)tmpentity->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[0]]->chromosome[0])[n]
-                                + ((double *)pop->entity_iarray[permutation[1]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[2]]->chromosome[0])[n]
-                                - ((double *)pop->entity_iarray[permutation[3]]->chromosome[0])[n]);
+                                + ((double *)pop->entity_iarray[picks[0]]->chromosome[0])[n]
+                                + ((double *)pop->entity_iarray[picks[1]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[2]]->chromosome[0])[n]
+                                - ((double *)pop->entity_iarray[picks[3]]->chromosome[0])[n]);
 
               n = (n+1)%pop->len_chromosomes;
               L++;
@@ -669,29 +733,52 @@ GAULFUNC int ga_differentialevolution(	population		*pop,
         }
 
 /*
- * Evaluate new solution and restore the former chromosome values
- * if this new solution is not an improvement.
+ * Without a batch evaluation callback, evaluate the new solution
+ * straight away, as part of this parallel loop.
  */
-      if ( !pop->evaluate(pop, tmpentity) ||
-         ( pop->rank == ga_rank_fitness && pop->entity_iarray[i]->fitness > tmpentity->fitness ) ||
-         ( pop->rank != ga_rank_fitness && pop->rank(pop, tmpentity, pop, pop->entity_iarray[i]) < 0 ) )
-        {
-/*printf("DEBUG: old = %f > new = %f\n", pop->entity_iarray[i]->fitness, tmpentity->fitness);*/
-        ga_entity_blank(pop, tmpentity);
-        ga_entity_copy(pop, tmpentity, pop->entity_iarray[i]);
-        }
+      if ( !pop->evaluate_batch && !pop->evaluate(pop, tmpentity) )
+        tmpentity->fitness = GA_MIN_FITNESS;
+
+      if (pop->reproducible)
+        random_set_thread_counter(previous_counter);
 
       }
 
 /*
- * Eliminate the original population members.
+ * Otherwise, the trials only depend upon the original population
+ * members, so they may all be evaluated together.
+ */
+    if ( pop->evaluate_batch )
+      ga_entity_evaluate_batch(pop, trials, pop->orig_size);
+
+/*
+ * Restore the former chromosome values if the new solution failed to
+ * evaluate or is not an improvement.
  */
-    while (pop->orig_size > 0)
+#pragma omp parallel for \
+   if (pop->reproducible) \
+   shared(pop, trials) private(i) \
+   schedule(static)
+    for (i=0; i<pop->orig_size; i++)
       {
-      pop->orig_size--;
-      ga_entity_dereference_by_rank(pop, pop->orig_size);
+      if ( trials[i]->fitness == GA_MIN_FITNESS ||
+         ( pop->rank == ga_rank_fitness && pop->entity_iarray[i]->fitness > trials[i]->fitness ) ||
+         ( pop->rank != ga_rank_fitness && pop->rank(pop, trials[i], pop, pop->entity_iarray[i]) < 0 ) )
+        {
+/*printf("DEBUG: old = %f > new = %f\n", pop->entity_iarray[i]->fitness, trials[i]->fitness);*/
+        ga_entity_blank(pop, trials[i]);
+        ga_entity_copy(pop, trials[i], pop->entity_iarray[i]);
+        }
       }
 
+    s_free(trials);
+
+/*
+ * Eliminate the original population members.
+ */
+    ga_entity_dereference_by_rank_range(pop, 0, pop->orig_size);
+    pop->orig_size = 0;
+
 /*
  * End of generation.
  */
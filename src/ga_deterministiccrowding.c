@@ -90,6 +90,7 @@ GAULFUNC int ga_deterministiccrowding(	population		*pop,
   int		*permutation, *ordered;	/* Arrays of entities. */
   entity	*mother, *father;	/* Current entities. */
   entity	*son, *daughter, *this_entity;	/* Current entities. */
+  entity	*brood[2];		/* Children, for evaluation. */
   int		i;			/* Loop variable over entities. */
   double	dist1, dist2;		/* Genetic or phenomic distances. */
   int		rank;			/* Rank of entity in population. */
@@ -116,11 +117,7 @@ GAULFUNC int ga_deterministiccrowding(	population		*pop,
   if (pop->size < pop->stable_size)
     gaul_population_fill(pop, pop->stable_size - pop->size);
 
-  for (i=0; i<pop->size; i++)
-    {
-    if (pop->entity_iarray[i]->fitness == GA_MIN_FITNESS)
-      pop->evaluate(pop, pop->entity_iarray[i]);
-    }
+  gaul_population_evaluate_ranks(pop, 0, pop->size, TRUE);
 
   sort_population(pop);
   ga_genocide_by_fitness(pop, GA_MIN_FITNESS);
@@ -212,8 +209,9 @@ GAULFUNC int ga_deterministiccrowding(	population		*pop,
  * Apply environmental adaptations, score entities, sort entities, etc.
  * FIXME: Currently no adaptation.
  */
-      pop->evaluate(pop, daughter);
-      pop->evaluate(pop, son);
+      brood[0] = daughter;
+      brood[1] = son;
+      ga_entity_evaluate_batch(pop, brood, 2);
 
 /*
  * Evaluate similarities.
@@ -229,18 +227,14 @@ GAULFUNC int ga_deterministiccrowding(	population		*pop,
         rank = ga_get_entity_rank(pop, daughter);
         if (daughter->fitness < mother->fitness)
           {
-          this_entity = pop->entity_iarray[i];
-          pop->entity_iarray[i] = pop->entity_iarray[rank];
-          pop->entity_iarray[rank] = this_entity;
+          gaul_entity_swap_rank(pop, i, rank);
           }
         ga_entity_dereference_by_rank(pop, rank);
 
         rank = ga_get_entity_rank(pop, son);
         if (son->fitness < father->fitness)
           {
-          this_entity = pop->entity_iarray[permutation[i]];
-          pop->entity_iarray[permutation[i]] = pop->entity_iarray[rank];
-          pop->entity_iarray[rank] = this_entity;
+          gaul_entity_swap_rank(pop, permutation[i], rank);
           }
         ga_entity_dereference_by_rank(pop, rank);
         }
@@ -249,18 +243,14 @@ GAULFUNC int ga_deterministiccrowding(	population		*pop,
         rank = ga_get_entity_rank(pop, son);
         if (son->fitness < mother->fitness)
           {
-          this_entity = pop->entity_iarray[i];
-          pop->entity_iarray[i] = pop->entity_iarray[rank];
-          pop->entity_iarray[rank] = this_entity;
+          gaul_entity_swap_rank(pop, i, rank);
           }
         ga_entity_dereference_by_rank(pop, rank);
 
         rank = ga_get_entity_rank(pop, daughter);
         if (daughter->fitness < father->fitness)
           {
-          this_entity = pop->entity_iarray[permutation[i]];
-          pop->entity_iarray[permutation[i]] = pop->entity_iarray[rank];
-          pop->entity_iarray[rank] = this_entity;
+          gaul_entity_swap_rank(pop, permutation[i], rank);
           }
         ga_entity_dereference_by_rank(pop, rank);
         }
@@ -1349,13 +1349,15 @@ GAULFUNC boolean ga_intrinsic_sladd(void)
                             GA_SCHEME_BALDWIN_PARENTS,
                             GA_SCHEME_BALDWIN_CHILDREN,
                             GA_SCHEME_BALDWIN_ALL};
-  static int	elitism[7]={GA_ELITISM_UNKNOWN,
+  static int	elitism[9]={GA_ELITISM_UNKNOWN,
                             GA_ELITISM_PARENTS_SURVIVE,
                             GA_ELITISM_ONE_PARENT_SURVIVES,
                             GA_ELITISM_PARENTS_DIE,
                             GA_ELITISM_BEST_SET_SURVIVE,
                             GA_ELITISM_PARETO_SET_SURVIVE,
-                            GA_ELITISM_RESCORE_PARENTS};
+                            GA_ELITISM_RESCORE_PARENTS,
+                            GA_ELITISM_PARETO_FRONTS_SURVIVE,
+                            GA_ELITISM_HYPERVOLUME_SURVIVE};
 
   if (  SLadd_intrinsic_variable("GA_SCHEME_DARWIN", &(schemes[0]), SLANG_INT_TYPE, TRUE)
      || SLadd_intrinsic_variable("GA_SCHEME_LAMARCK_PARENTS", &(schemes[1]), SLANG_INT_TYPE, TRUE)
@@ -1371,6 +1373,8 @@ GAULFUNC boolean ga_intrinsic_sladd(void)
      || SLadd_intrinsic_variable("GA_ELITISM_BEST_SET_SURVIVE", &(elitism[4]), SLANG_INT_TYPE, TRUE)
      || SLadd_intrinsic_variable("GA_ELITISM_PARETO_SET_SURVIVE", &(elitism[5]), SLANG_INT_TYPE, TRUE)
      || SLadd_intrinsic_variable("GA_ELITISM_RESCORE_PARENTS", &(elitism[6]), SLANG_INT_TYPE, TRUE)
+     || SLadd_intrinsic_variable("GA_ELITISM_PARETO_FRONTS_SURVIVE", &(elitism[7]), SLANG_INT_TYPE, TRUE)
+     || SLadd_intrinsic_variable("GA_ELITISM_HYPERVOLUME_SURVIVE", &(elitism[8]), SLANG_INT_TYPE, TRUE)
      || SLadd_intrinsic_variable("GA_FITNESS_MIN", &fitnessmin, SLANG_DOUBLE_TYPE, TRUE)
      ) return FALSE;
 
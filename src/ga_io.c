@@ -75,7 +75,7 @@ static void gaul_write_entity_posix(FILE *fp, population *pop, entity *this_enti
 		any of the userdata.
   parameters:
   return:
-  last updated: 29 May 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 #ifdef USE_WINDOWS_H
@@ -92,6 +92,12 @@ static void gaul_write_entity_win32(HANDLE file,
   len = (int) pop->chromosome_to_bytes(pop, this_entity, &bufptr, &max_len);
   memcpy(buffer+sizeof(double), &len, sizeof(int));
 
+  if (max_len!=0)
+    {	/* Chromosomes were gathered into a new buffer. */
+    memcpy(buffer+sizeof(double)+sizeof(int), bufptr, len);
+    s_free(bufptr);
+    }
+
   if ( WriteFile(file, buffer, len+sizeof(double)+sizeof(int), &nwrote, NULL)==0 )
     dief("Error writing %d\n", GetLastError());
 
@@ -34,6 +34,47 @@
 
 #include "gaul/ga_core.h"
 
+/*
+ * Number of random values drawn at a time by the allpoint mutation
+ * operators.
+ */
+#define GA_MUTATE_CHUNK	256
+
+/**********************************************************************
+  ga_mutate_next_point()
+  synopsis:	Find the next allele to mutate, after the given one,
+		for the multipoint mutation operators.  Rather than
+		testing every allele against allele_mutation_prob,
+		the gap to the next mutated allele is sampled from
+		the geometric distribution directly, so the cost is
+		proportional to the number of mutations rather than
+		the length of the chromosome.  The alleles mutated
+		are distributed exactly as before.
+  parameters:	population *pop
+		const int point		Previous mutated allele, or -1.
+		const double log_q	log(1-allele_mutation_prob).
+  return:	Index of the next allele to mutate, or
+		len_chromosomes if there are no more.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static int ga_mutate_next_point(population *pop, const int point, const double log_q)
+  {
+  double	u;		/* Uniform deviate in range 0.0<u<=1.0 */
+  double	skip;		/* Number of alleles left untouched. */
+
+  if (pop->allele_mutation_prob <= 0.0) return pop->len_chromosomes;
+  if (pop->allele_mutation_prob >= 1.0) return point+1;
+
+  u = ((double)random_rand()+1.0)/((double)RANDOM_RAND_MAX+1.0);
+  skip = floor(log(u)/log_q);
+
+  if (skip >= (double)(pop->len_chromosomes-point-1))
+    return pop->len_chromosomes;
+
+  return point+1+(int)skip;
+  }
+
 /**********************************************************************
   ga_mutate_integer_singlepoint_drift()
   synopsis:	Cause a single mutation event in which a single
@@ -137,7 +178,7 @@ GAULFUNC void ga_mutate_integer_singlepoint_randomize( population *pop,
 		to the more common 'bit-drift' mutation.
   parameters:
   return:
-  last updated: 17 Feb 2005
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_integer_multipoint(population *pop, entity *father, entity *son)
@@ -145,6 +186,7 @@ GAULFUNC void ga_mutate_integer_multipoint(population *pop, entity *father, enti
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  double	log_q=log(1.0-pop->allele_mutation_prob);	/* For skipping alleles. */
   int		dir=random_boolean()?-1:1;	/* The direction of drift. */
 
 /* Checks */
@@ -161,17 +203,16 @@ GAULFUNC void ga_mutate_integer_multipoint(population *pop, entity *father, enti
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for ( point=ga_mutate_next_point(pop, -1, log_q);
+          point<pop->len_chromosomes;
+          point=ga_mutate_next_point(pop, point, log_q) )
       {
-      if (random_boolean_prob(pop->allele_mutation_prob))
-        {
-        ((int *)son->chromosome[chromo])[point] += dir;
+      ((int *)son->chromosome[chromo])[point] += dir;
 
-        if (((int *)son->chromosome[chromo])[point] > pop->allele_max_integer)
-          ((int *)son->chromosome[chromo])[point] = pop->allele_min_integer;
-        if (((int *)son->chromosome[chromo])[point] < pop->allele_min_integer)
-          ((int *)son->chromosome[chromo])[point] = pop->allele_max_integer;
-        }
+      if (((int *)son->chromosome[chromo])[point] > pop->allele_max_integer)
+        ((int *)son->chromosome[chromo])[point] = pop->allele_min_integer;
+      if (((int *)son->chromosome[chromo])[point] < pop->allele_min_integer)
+        ((int *)son->chromosome[chromo])[point] = pop->allele_max_integer;
       }
     }
 
@@ -186,7 +227,7 @@ GAULFUNC void ga_mutate_integer_multipoint(population *pop, entity *father, enti
 		remaining the same.
   parameters:
   return:
-  last updated: 17 Feb 2005
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_integer_allpoint(population *pop, entity *father, entity *son)
@@ -194,6 +235,8 @@ GAULFUNC void ga_mutate_integer_allpoint(population *pop, entity *father, entity
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  int		j, num;		/* Loop over chunk of alleles */
+  int		moves[GA_MUTATE_CHUNK];	/* Increment, decrement or neither */
 
 /* Checks */
   if (!father || !son) die("Null pointer to entity structure passed");
@@ -209,29 +252,34 @@ GAULFUNC void ga_mutate_integer_allpoint(population *pop, entity *father, entity
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for (point=0; point<pop->len_chromosomes; point+=GA_MUTATE_CHUNK)
       {
-      switch (random_int(3))
+      num = MIN(GA_MUTATE_CHUNK, pop->len_chromosomes-point);
+      random_fill_int_range(moves, num, 0, 3);
+      for (j=0; j<num; j++)
         {
-        case (1):
-          (((int *)son->chromosome[chromo])[point])++;
+        switch (moves[j])
+          {
+          case (1):
+            (((int *)son->chromosome[chromo])[point+j])++;
 
-          if (((int *)son->chromosome[chromo])[point] > pop->allele_max_integer)
-            ((int *)son->chromosome[chromo])[point] = pop->allele_min_integer;
+            if (((int *)son->chromosome[chromo])[point+j] > pop->allele_max_integer)
+              ((int *)son->chromosome[chromo])[point+j] = pop->allele_min_integer;
 
-          break;
+            break;
 
-        case (2):
-          (((int *)son->chromosome[chromo])[point])--;
+          case (2):
+            (((int *)son->chromosome[chromo])[point+j])--;
 
-          if (((int *)son->chromosome[chromo])[point] < pop->allele_min_integer)
-            ((int *)son->chromosome[chromo])[point] = pop->allele_max_integer;
+            if (((int *)son->chromosome[chromo])[point+j] < pop->allele_min_integer)
+              ((int *)son->chromosome[chromo])[point+j] = pop->allele_max_integer;
 
-          break;
+            break;
 
-        default:
-          /* Do nothing. */
-          break;
+          default:
+            /* Do nothing. */
+            break;
+          }
         }
       }
     }
@@ -287,7 +335,7 @@ GAULFUNC void ga_mutate_boolean_singlepoint(population *pop, entity *father, ent
   synopsis:	Cause a number of mutation events.
   parameters:
   return:
-  last updated: 16 Feb 2005
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_boolean_multipoint(population *pop, entity *father, entity *son)
@@ -295,6 +343,7 @@ GAULFUNC void ga_mutate_boolean_multipoint(population *pop, entity *father, enti
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  double	log_q=log(1.0-pop->allele_mutation_prob);	/* For skipping alleles. */
 
 /* Checks */
   if (!father || !son) die("Null pointer to entity structure passed");
@@ -310,12 +359,11 @@ GAULFUNC void ga_mutate_boolean_multipoint(population *pop, entity *father, enti
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for ( point=ga_mutate_next_point(pop, -1, log_q);
+          point<pop->len_chromosomes;
+          point=ga_mutate_next_point(pop, point, log_q) )
       {
-      if (random_boolean_prob(pop->allele_mutation_prob))
-        {
-        ((boolean *)son->chromosome[chromo])[point] = !((boolean *)son->chromosome[chromo])[point];
-        }
+      ((boolean *)son->chromosome[chromo])[point] = !((boolean *)son->chromosome[chromo])[point];
       }
     }
 
@@ -386,7 +434,7 @@ GAULFUNC void ga_mutate_char_singlepoint_drift( population *pop,
 		remaining the same.
   parameters:
   return:
-  last updated: 03 Jun 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_char_allpoint(population *pop, entity *father, entity *son)
@@ -394,6 +442,8 @@ GAULFUNC void ga_mutate_char_allpoint(population *pop, entity *father, entity *s
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  int		j, num;		/* Loop over chunk of alleles */
+  int		moves[GA_MUTATE_CHUNK];	/* Increment, decrement or neither */
 
 /* Checks */
   if (!father || !son) die("Null pointer to entity structure passed");
@@ -401,7 +451,7 @@ GAULFUNC void ga_mutate_char_allpoint(population *pop, entity *father, entity *s
 /* Copy chromosomes of parent to offspring. */
   for (i=0; i<pop->num_chromosomes; i++)
     {
-    memcpy(son->chromosome[i], father->chromosome[i], pop->len_chromosomes*sizeof(int));
+    memcpy(son->chromosome[i], father->chromosome[i], pop->len_chromosomes*sizeof(char));
     }
 
 /*
@@ -409,23 +459,28 @@ GAULFUNC void ga_mutate_char_allpoint(population *pop, entity *father, entity *s
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for (point=0; point<pop->len_chromosomes; point+=GA_MUTATE_CHUNK)
       {
-      switch (random_int(3))
+      num = MIN(GA_MUTATE_CHUNK, pop->len_chromosomes-point);
+      random_fill_int_range(moves, num, 0, 3);
+      for (j=0; j<num; j++)
         {
-        case (1):
-          (((char *)son->chromosome[chromo])[point])++;
+        switch (moves[j])
+          {
+          case (1):
+            (((char *)son->chromosome[chromo])[point+j])++;
 
-          break;
+            break;
 
-        case (2):
-          (((char *)son->chromosome[chromo])[point])--;
+          case (2):
+            (((char *)son->chromosome[chromo])[point+j])--;
 
-          break;
+            break;
 
-        default:
-          /* Do nothing. */
-          break;
+          default:
+            /* Do nothing. */
+            break;
+          }
         }
       }
     }
@@ -484,7 +539,7 @@ GAULFUNC void ga_mutate_char_singlepoint_randomize( population *pop,
 		to the more common 'bit-drift' mutation.
   parameters:
   return:
-  last updated: 16 Feb 2005
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_char_multipoint(population *pop, entity *father, entity *son)
@@ -492,6 +547,7 @@ GAULFUNC void ga_mutate_char_multipoint(population *pop, entity *father, entity
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  double	log_q=log(1.0-pop->allele_mutation_prob);	/* For skipping alleles. */
   int		dir=random_boolean()?-1:1;	/* The direction of drift. */
 
 /* Checks */
@@ -508,19 +564,18 @@ GAULFUNC void ga_mutate_char_multipoint(population *pop, entity *father, entity
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for ( point=ga_mutate_next_point(pop, -1, log_q);
+          point<pop->len_chromosomes;
+          point=ga_mutate_next_point(pop, point, log_q) )
       {
-      if (random_boolean_prob(pop->allele_mutation_prob))
-        {
-        ((char *)son->chromosome[chromo])[point] += (char)dir;
+      ((char *)son->chromosome[chromo])[point] += (char)dir;
 
 /* Don't need these because char's **should** wrap safely.
-        if (((char *)son->chromosome[chromo])[point]>CHAR_MAX)
-          ((char *)son->chromosome[chromo])[point]=CHAR_MIN;
-        if (((char *)son->chromosome[chromo])[point]<CHAR_MIN)
-          ((char *)son->chromosome[chromo])[point]=CHAR_MAX;
+      if (((char *)son->chromosome[chromo])[point]>CHAR_MAX)
+        ((char *)son->chromosome[chromo])[point]=CHAR_MIN;
+      if (((char *)son->chromosome[chromo])[point]<CHAR_MIN)
+        ((char *)son->chromosome[chromo])[point]=CHAR_MAX;
 */
-        }
       }
     }
 
@@ -631,7 +686,7 @@ GAULFUNC void ga_mutate_printable_singlepoint_randomize( population *pop,
 		to the more common 'bit-drift' mutation.
   parameters:
   return:
-  last updated: 16 Feb 2005
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_printable_multipoint(population *pop, entity *father, entity *son)
@@ -639,6 +694,7 @@ GAULFUNC void ga_mutate_printable_multipoint(population *pop, entity *father, en
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  double	log_q=log(1.0-pop->allele_mutation_prob);	/* For skipping alleles. */
   int		dir=random_boolean()?-1:1;	/* The direction of drift. */
 
 /* Checks */
@@ -655,17 +711,16 @@ GAULFUNC void ga_mutate_printable_multipoint(population *pop, entity *father, en
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for ( point=ga_mutate_next_point(pop, -1, log_q);
+          point<pop->len_chromosomes;
+          point=ga_mutate_next_point(pop, point, log_q) )
       {
-      if (random_boolean_prob(pop->allele_mutation_prob))
-        {
-        ((char *)son->chromosome[chromo])[point] += (char)dir;
+      ((char *)son->chromosome[chromo])[point] += (char)dir;
 
-        if (((char *)son->chromosome[chromo])[point]>'~')
-          ((char *)son->chromosome[chromo])[point]=' ';
-        if (((char *)son->chromosome[chromo])[point]<' ')
-          ((char *)son->chromosome[chromo])[point]='~';
-        }
+      if (((char *)son->chromosome[chromo])[point]>'~')
+        ((char *)son->chromosome[chromo])[point]=' ';
+      if (((char *)son->chromosome[chromo])[point]<' ')
+        ((char *)son->chromosome[chromo])[point]='~';
       }
     }
 
@@ -680,7 +735,7 @@ GAULFUNC void ga_mutate_printable_multipoint(population *pop, entity *father, en
 		remaining the same.
   parameters:
   return:
-  last updated: 10 Sep 2003
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_printable_allpoint(population *pop, entity *father, entity *son)
@@ -688,6 +743,8 @@ GAULFUNC void ga_mutate_printable_allpoint(population *pop, entity *father, enti
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  int		j, num;		/* Loop over chunk of alleles */
+  int		moves[GA_MUTATE_CHUNK];	/* Increment, decrement or neither */
 
 /* Checks */
   if (!father || !son) die("Null pointer to entity structure passed");
@@ -703,29 +760,34 @@ GAULFUNC void ga_mutate_printable_allpoint(population *pop, entity *father, enti
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for (point=0; point<pop->len_chromosomes; point+=GA_MUTATE_CHUNK)
       {
-      switch (random_int(3))
+      num = MIN(GA_MUTATE_CHUNK, pop->len_chromosomes-point);
+      random_fill_int_range(moves, num, 0, 3);
+      for (j=0; j<num; j++)
         {
-        case (1):
-          (((char *)son->chromosome[chromo])[point])++;
+        switch (moves[j])
+          {
+          case (1):
+            (((char *)son->chromosome[chromo])[point+j])++;
 
-          if (((char *)son->chromosome[chromo])[point]>'~')
-            ((char *)son->chromosome[chromo])[point]=' ';
+            if (((char *)son->chromosome[chromo])[point+j]>'~')
+              ((char *)son->chromosome[chromo])[point+j]=' ';
 
-          break;
+            break;
 
-        case (2):
-          (((char *)son->chromosome[chromo])[point])--;
+          case (2):
+            (((char *)son->chromosome[chromo])[point+j])--;
 
-          if (((char *)son->chromosome[chromo])[point]<' ')
-            ((char *)son->chromosome[chromo])[point]='~';
+            if (((char *)son->chromosome[chromo])[point+j]<' ')
+              ((char *)son->chromosome[chromo])[point+j]='~';
 
-          break;
+            break;
 
-        default:
-          /* Do nothing. */
-          break;
+          default:
+            /* Do nothing. */
+            break;
+          }
         }
       }
     }
@@ -784,7 +846,7 @@ GAULFUNC void ga_mutate_bitstring_singlepoint( population *pop,
   synopsis:	Cause a number of mutation events.
   parameters:
   return:
-  last updated: 16 Feb 2005
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_bitstring_multipoint(population *pop, entity *father, entity *son)
@@ -792,6 +854,7 @@ GAULFUNC void ga_mutate_bitstring_multipoint(population *pop, entity *father, en
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  double	log_q=log(1.0-pop->allele_mutation_prob);	/* For skipping alleles. */
 
 /* Checks */
   if (!father || !son) die("Null pointer to entity structure passed");
@@ -807,12 +870,11 @@ GAULFUNC void ga_mutate_bitstring_multipoint(population *pop, entity *father, en
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for ( point=ga_mutate_next_point(pop, -1, log_q);
+          point<pop->len_chromosomes;
+          point=ga_mutate_next_point(pop, point, log_q) )
       {
-      if (random_boolean_prob(pop->allele_mutation_prob))
-        {
-        ga_bit_invert(son->chromosome[chromo],point);
-        }
+      ga_bit_invert(son->chromosome[chromo],point);
       }
     }
 
@@ -924,7 +986,7 @@ GAULFUNC void ga_mutate_double_singlepoint_randomize( population *pop,
 		(Unit Gaussian distribution.)
   parameters:
   return:
-  last updated: 17 Feb 2005
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_double_multipoint(population *pop, entity *father, entity *son)
@@ -932,6 +994,7 @@ GAULFUNC void ga_mutate_double_multipoint(population *pop, entity *father, entit
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  double	log_q=log(1.0-pop->allele_mutation_prob);	/* For skipping alleles. */
 
 /* Checks */
   if (!father || !son) die("Null pointer to entity structure passed");
@@ -947,17 +1010,16 @@ GAULFUNC void ga_mutate_double_multipoint(population *pop, entity *father, entit
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for ( point=ga_mutate_next_point(pop, -1, log_q);
+          point<pop->len_chromosomes;
+          point=ga_mutate_next_point(pop, point, log_q) )
       {
-      if (random_boolean_prob(pop->allele_mutation_prob))
-        {
-        ((double *)son->chromosome[chromo])[point] += random_unit_gaussian();
+      ((double *)son->chromosome[chromo])[point] += random_unit_gaussian();
 
-        if (((double *)son->chromosome[chromo])[point] > pop->allele_max_double)
-          ((double *)son->chromosome[chromo])[point] -= (pop->allele_max_double-pop->allele_min_double);
-        if (((double *)son->chromosome[chromo])[point] < pop->allele_min_double)
-          ((double *)son->chromosome[chromo])[point] += (pop->allele_max_double-pop->allele_min_double);
-        }
+      if (((double *)son->chromosome[chromo])[point] > pop->allele_max_double)
+        ((double *)son->chromosome[chromo])[point] -= (pop->allele_max_double-pop->allele_min_double);
+      if (((double *)son->chromosome[chromo])[point] < pop->allele_min_double)
+        ((double *)son->chromosome[chromo])[point] += (pop->allele_max_double-pop->allele_min_double);
       }
     }
 
@@ -972,7 +1034,7 @@ GAULFUNC void ga_mutate_double_multipoint(population *pop, entity *father, entit
 		(Unit Gaussian distribution.)
   parameters:
   return:
-  last updated: 17 Feb 2005
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_mutate_double_allpoint(population *pop, entity *father, entity *son)
@@ -980,6 +1042,8 @@ GAULFUNC void ga_mutate_double_allpoint(population *pop, entity *father, entity
   int		i;		/* Loop variable over all chromosomes */
   int		chromo;		/* Index of chromosome to mutate */
   int		point;		/* Index of allele to mutate */
+  int		j, num;		/* Loop over chunk of alleles */
+  double	drift[GA_MUTATE_CHUNK];	/* Gaussian deviates */
 
 /* Checks */
   if (!father || !son) die("Null pointer to entity structure passed");
@@ -995,14 +1059,19 @@ GAULFUNC void ga_mutate_double_allpoint(population *pop, entity *father, entity
  */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
+    for (point=0; point<pop->len_chromosomes; point+=GA_MUTATE_CHUNK)
       {
-      (((double *)son->chromosome[chromo])[point]) += random_unit_gaussian();
+      num = MIN(GA_MUTATE_CHUNK, pop->len_chromosomes-point);
+      random_fill_unit_gaussian(drift, num);
+      for (j=0; j<num; j++)
+        {
+        (((double *)son->chromosome[chromo])[point+j]) += drift[j];
 
-      if (((double *)son->chromosome[chromo])[point] > pop->allele_max_double)
-        ((double *)son->chromosome[chromo])[point] -= (pop->allele_max_double-pop->allele_min_double);
-      if (((double *)son->chromosome[chromo])[point] < pop->allele_min_double)
-        ((double *)son->chromosome[chromo])[point] += (pop->allele_max_double-pop->allele_min_double);
+        if (((double *)son->chromosome[chromo])[point+j] > pop->allele_max_double)
+          ((double *)son->chromosome[chromo])[point+j] -= (pop->allele_max_double-pop->allele_min_double);
+        if (((double *)son->chromosome[chromo])[point+j] < pop->allele_min_double)
+          ((double *)son->chromosome[chromo])[point+j] += (pop->allele_max_double-pop->allele_min_double);
+        }
       }
     }
 
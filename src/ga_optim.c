@@ -40,12 +40,19 @@
 		Write ga_evolution_pvm().
 		Remove much duplicated code.
 		OpenMOSIX fix.  See below.
-		gaul_adapt_and_evaluate_forked() and gaul_adapt_and_evaluate_threaded() are only parallelized for the case that no adaptation occurs.
+		gaul_adapt_and_evaluate_forked() is only parallelized for the case that no adaptation occurs.
 
  **********************************************************************/
 
 #include "gaul/ga_optim.h"
 
+#ifndef W32_CRIPPLED
+#include <sys/mman.h>
+# ifndef MAP_ANONYMOUS
+#  define MAP_ANONYMOUS	MAP_ANON
+# endif
+#endif
+
 /*
  * Here is a kludge.
  *
@@ -442,28 +449,6 @@ GAULFUNC void ga_detach_mpi_slaves(void)
   }
 
 
-/**********************************************************************
-  gaul_entity_swap_rank()
-  synopsis:	Swap the ranks of a pair of entities.
-  parameters:	population *pop
-		const int rank1
-		const int rank2
-  return:	none
-  last updated:	11 Jun 2002
- **********************************************************************/
-
-static void gaul_entity_swap_rank(population *pop, const int rank1, const int rank2)
-  {
-  entity	*tmp;		/* Swapped entity. */
-
-  tmp = pop->entity_iarray[rank1];
-  pop->entity_iarray[rank1] = pop->entity_iarray[rank2];
-  pop->entity_iarray[rank2] = tmp;
-
-  return;
-  }
-
-
 /**********************************************************************
   gaul_migration()
   synopsis:	Migration cycle.
@@ -537,14 +522,11 @@ static void gaul_crossover(population *pop)
   pop->select_state = 0;
 
   /* Select pairs of entities to mate via crossover. */
-#pragma intel omp parallel taskq
   while ( !(pop->select_two(pop, &mother, &father)) )
     {
 
     if (mother && father)
       {
-#pragma intel omp task \
-  private(son,daughter) captureprivate(mother,father)
         {
         plog(LOG_VERBOSE, "Crossover between %d (rank %d fitness %f) and %d (rank %d fitness %f)",
              ga_get_entity_id(pop, mother),
@@ -590,14 +572,11 @@ static void gaul_mutation(population *pop)
    * Select entities to undergo asexual reproduction, in each case the child will
    * have a genetic mutation of some type.
    */
-#pragma intel omp parallel taskq
   while ( !(pop->select_one(pop, &mother)) )
     {
 
     if (mother)
       {
-#pragma intel omp task \
-  private(daughter) captureprivate(mother)
         {
         plog(LOG_VERBOSE, "Mutation of %d (rank %d fitness %f)",
              ga_get_entity_id(pop, mother),
@@ -718,20 +697,8 @@ static void gaul_evaluation_slave_mp(population *pop)
 
 static void gaul_ensure_evaluations(population *pop)
   {
-  int		i;			/* Loop variable over entity ranks. */
 
-#pragma omp parallel for \
-   shared(pop) private(i) \
-   schedule(static)
-  for (i=0; i<pop->size; i++)
-    {
-/*printf("DEBUG: gaul_ensure_evaluations() parallel for %d on %d/%d.\n", i, omp_get_thread_num(), omp_get_num_threads());*/
-    if (pop->entity_iarray[i]->fitness == GA_MIN_FITNESS)
-      {
-      if ( pop->evaluate(pop, pop->entity_iarray[i]) == FALSE )
-        pop->entity_iarray[i]->fitness = GA_MIN_FITNESS;
-      }
-    }
+  gaul_population_evaluate_ranks(pop, 0, pop->size, TRUE);
 
   return;
   }
@@ -988,304 +955,927 @@ static void gaul_ensure_evaluations_forked(population *pop, const int num_proces
 
 
 /**********************************************************************
-  gaul_ensure_evaluations_threaded()
-  synopsis:	Fitness evaluations.
-		Evaluate all previously unevaluated entities.
-		No adaptation.
-		Threaded processing version.
-  parameters:	population *pop
-  return:	none
-  last updated:	18 Sep 2002
+  Pre-forked evaluation worker processes.
+
+  A fixed set of worker processes is forked once per run.  Each
+  chromosome to be evaluated is serialised with the population's
+  chromosome_to_bytes callback into a slot of an anonymous shared
+  memory ring.  The slot's index is passed to an idle worker through
+  a job pipe, and the worker leaves the fitness (and fitness vector,
+  if any) in the same slot before passing the index back through a
+  result pipe.  The workers evaluate against their own copy of the
+  population, taken when they were forked.
  **********************************************************************/
 
-#ifdef HAVE_PTHREADS
+#ifndef W32_CRIPPLED
 
-typedef struct threaddata_s
+typedef struct forkslot_s
   {
-  int thread_num;
-  int eval_num;
-  population *pop;
-  pthread_t pid;
-  } threaddata_t;
+  int		rank;		/* Rank of entity held in this slot. */
+  unsigned int	len;		/* Length of serialised chromosomes. */
+  double	fitness;	/* Fitness returned by worker. */
+  } forkslot_t;
 
-/*
- * This is the child thread code used by gaul_ensure_evaluations_threaded(),
- * gaul_adapt_and_evaluate_threaded() and gaul_survival_threaded() to evaluate entities.
- */
-static void *_evaluation_thread( void *data )
+typedef struct forkpool_s
+  {
+  int		num_processes;	/* Number of worker processes. */
+  pid_t		*pid;		/* Worker PIDs. */
+  int		job_fd;		/* Write end of job pipe. */
+  int		result_fd;	/* Read end of result pipe. */
+  int		num_slots;	/* Number of slots in shared ring. */
+  size_t	slot_size;	/* Maximum chromosome bytes per slot. */
+  size_t	stride;		/* Total bytes per slot. */
+  size_t	shm_len;	/* Total bytes of shared memory. */
+  gaulbyte	*shm;		/* Shared memory ring. */
+  int		*free_slots;	/* Stack of unused slots. */
+  int		num_free;	/* Number of unused slots. */
+  } forkpool_t;
+
+#define FORKSLOT(pool, n)	((forkslot_t *)((pool)->shm + (size_t)(n)*(pool)->stride))
+#define FORKSLOT_FITVECTOR(slot)	((double *)((slot)+1))
+#define FORKSLOT_BYTES(pop, slot)	((gaulbyte *)(FORKSLOT_FITVECTOR(slot)+(pop)->fitness_dimensions))
+
+/*
+ * This is the worker process code.  It never returns.
+ */
+static void _forkpool_worker(population *pop, forkpool_t *pool,
+                             const int job_fd, const int result_fd)
   {
-  int		eval_num = ((threaddata_t *)data)->eval_num;
-  population	*pop = ((threaddata_t *)data)->pop;
+  entity	*scratch;	/* Entity used for evaluations. */
+  forkslot_t	*slot;		/* Current slot. */
+  int		n;		/* Index of current slot. */
+  int		i;		/* Loop over fitness vector. */
 
-  if ( pop->evaluate(pop, pop->entity_iarray[eval_num]) == FALSE )
-    pop->entity_iarray[eval_num]->fitness = GA_MIN_FITNESS;
+  scratch = ga_get_free_entity(pop);
 
-#if GA_DEBUG>2
-printf("DEBUG: Thread %d has evaluated entity %d\n", ((threaddata_t *)data)->thread_num, eval_num);
-#endif
+  while ( read(job_fd, &n, sizeof(int)) == sizeof(int) )
+    {
+    slot = FORKSLOT(pool, n);
+
+    ga_entity_blank(pop, scratch);
+    pop->chromosome_from_bytes(pop, scratch, FORKSLOT_BYTES(pop, slot));
+
+    if ( pop->evaluate(pop, scratch) == FALSE )
+      scratch->fitness = GA_MIN_FITNESS;
 
-  ((threaddata_t *)data)->thread_num = -1;	/* Signal that this thread is finished. */
+    slot->fitness = scratch->fitness;
+    for (i=0; i<pop->fitness_dimensions; i++)
+      FORKSLOT_FITVECTOR(slot)[i] = scratch->fitvector[i];
 
-  pthread_exit(NULL);
+    if ( write(result_fd, &n, sizeof(int)) != sizeof(int) ) break;
+    }
 
-  return NULL;	/* Keep Compaq's C/C++ compiler happy. */
+  _exit(0);
   }
 
-static void gaul_ensure_evaluations_threaded( population *pop, const int max_threads, threaddata_t *threaddata )
+
+/**********************************************************************
+  gaul_forkpool_new()
+  synopsis:	Fork a set of persistent evaluation worker processes
+		and allocate the shared memory through which they
+		receive chromosomes.  The slot size is taken from
+		the population's first entity, so the population
+		must not be empty.
+  parameters:	population *pop
+		const int num_processes	Number of worker processes.
+  return:	forkpool_t *		The new pool.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static forkpool_t *gaul_forkpool_new(population *pop, const int num_processes)
   {
-  int		thread_num;		/* Index of current thread. */
-  int		num_threads;		/* Number of threads currently in use. */
-  int		eval_num;		/* Index of current entity. */
+  forkpool_t	*pool;			/* The new pool. */
+  int		jobpipe[2];		/* Pipe for passing jobs to workers. */
+  int		resultpipe[2];		/* Pipe for passing results back. */
+  gaulbyte	*buffer=NULL;		/* Serialised chromosomes. */
+  unsigned int	max_len=0;		/* Size of buffer. */
+  int		i;			/* Loop over slots and processes. */
+
+  if (num_processes < 1) die("Invalid number of processes requested.");
+  if (pop->size < 1) die("Population is empty.");
+  if (!pop->chromosome_to_bytes || !pop->chromosome_from_bytes)
+    die("Population's chromosome serialisation callbacks are undefined.");
+
+  if ( !(pool = s_malloc(sizeof(forkpool_t))) )
+    die("Unable to allocate memory");
 
-/*
- * A thread is created for each fitness evaluation upto
- * a maximum of max_threads at which point we wait for
- * results before continuing.
- *
- * Skip evaluations for entities that have been previously evaluated.
- */
-  thread_num = 0;
-  eval_num = 0;
+  pool->num_processes = num_processes;
+  pool->num_slots = 2*num_processes;
+  pool->slot_size = pop->chromosome_to_bytes(pop, pop->entity_iarray[0], &buffer, &max_len);
+  if (max_len!=0) s_free(buffer);
 
-  /* Skip to the next entity which needs evaluating. */
-  while (eval_num < pop->size && pop->entity_iarray[eval_num]->fitness!=GA_MIN_FITNESS) eval_num++;
+  pool->stride = sizeof(forkslot_t) + sizeof(double)*pop->fitness_dimensions + pool->slot_size;
+  pool->stride = (pool->stride + sizeof(double) - 1) & ~(sizeof(double) - 1);
+  pool->shm_len = pool->stride*pool->num_slots;
+
+  pool->shm = mmap(NULL, pool->shm_len, PROT_READ|PROT_WRITE,
+                   MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if (pool->shm == MAP_FAILED)
+    dief("Error %d in mmap.", errno);
+
+  if ( !(pool->pid = s_malloc(num_processes*sizeof(pid_t))) )
+    die("Unable to allocate memory");
+  if ( !(pool->free_slots = s_malloc(pool->num_slots*sizeof(int))) )
+    die("Unable to allocate memory");
 
-  while (thread_num < max_threads && eval_num < pop->size)
+  for (i=0; i<pool->num_slots; i++)
+    pool->free_slots[i] = i;
+  pool->num_free = pool->num_slots;
+
+  if (pipe(jobpipe)==-1 || pipe(resultpipe)==-1) die("Unable to open pipe");
+
+  for (i=0; i<num_processes; i++)
     {
-    threaddata[thread_num].thread_num = thread_num;
-    threaddata[thread_num].eval_num = eval_num;
+    pool->pid[i] = fork();
 
-    if (pthread_create(&(threaddata[thread_num].pid), NULL, _evaluation_thread, (void *)&(threaddata[thread_num])) < 0)
-      {       /* Error in thread creation. */
-      dief("Error %d in pthread_create. (%s)", errno, errno==EAGAIN?"EAGAIN":errno==ENOMEM?"ENOMEM":"unknown");
+    if (pool->pid[i] < 0)
+      {       /* Error in fork. */
+      dief("Error %d in fork. (%s)", errno, errno==EAGAIN?"EAGAIN":errno==ENOMEM?"ENOMEM":"unknown");
+      }
+    else if (pool->pid[i] == 0)
+      {       /* This is the child process. */
+      close(jobpipe[1]);
+      close(resultpipe[0]);
+      _forkpool_worker(pop, pool, jobpipe[0], resultpipe[1]);
       }
+#ifdef NEED_MOSIX_FORK_HACK
+    usleep(10);
+#endif
+    }
 
-    thread_num++;
-    eval_num++;
+  close(jobpipe[0]);
+  close(resultpipe[1]);
+  pool->job_fd = jobpipe[1];
+  pool->result_fd = resultpipe[0];
 
-    /* Skip to the next entity which needs evaluating. */
-    while (eval_num < pop->size && pop->entity_iarray[eval_num]->fitness!=GA_MIN_FITNESS)
-      eval_num++;
-    }
+  return pool;
+  }
 
-  num_threads = thread_num;
 
-  /* Wait for a thread to finish and, if needed, create another. */
-  /* Also, find which entity this thread was evaluating. */
-  thread_num=0;
-  while (num_threads > 0)
-    {
-    while (threaddata[thread_num].thread_num >= 0)
-      {
-      thread_num++;
-      if (thread_num==max_threads)
-        {
-        thread_num=0;
-/* FIXME: Insert short sleep here? */
-        }
-      }
+/**********************************************************************
+  gaul_forkpool_free()
+  synopsis:	Shut down the worker processes of a pool and release
+		its resources.
+  parameters:	forkpool_t *pool
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
 
-#if GA_DEBUG>2
-printf("DEBUG: Thread %d finished.  num_threads=%d eval_num=%d/%d\n", thread_num, num_threads, eval_num, pop->size);
-#endif
+static void gaul_forkpool_free(forkpool_t *pool)
+  {
+  int		i;		/* Loop over processes. */
 
-    if ( pthread_join(threaddata[thread_num].pid, NULL) < 0 )
-      {
-      dief("Error %d in pthread_join. (%s)", errno, errno==ESRCH?"ESRCH":errno==EINVAL?"EINVAL":errno==EDEADLK?"EDEADLK":"unknown");
-      }
+/* Workers exit when they see the end of the job pipe. */
+  close(pool->job_fd);
 
-    if (eval_num < pop->size)
-      {       /* New thread. */
-      threaddata[thread_num].thread_num = thread_num;
-      threaddata[thread_num].eval_num = eval_num;
+  for (i=0; i<pool->num_processes; i++)
+    waitpid(pool->pid[i], NULL, 0);
 
-      if (pthread_create(&(threaddata[thread_num].pid), NULL, _evaluation_thread, (void *)&(threaddata[thread_num])) < 0)
-        {       /* Error in thread creation. */
-        dief("Error %d in pthread_create. (%s)", errno, errno==EAGAIN?"EAGAIN":errno==ENOMEM?"ENOMEM":"unknown");
-        }
+  close(pool->result_fd);
+  munmap(pool->shm, pool->shm_len);
 
-      eval_num++;
+  s_free(pool->free_slots);
+  s_free(pool->pid);
+  s_free(pool);
 
-      /* Skip to the next entity which needs evaluating. */
-      while (eval_num < pop->size && pop->entity_iarray[eval_num]->fitness!=GA_MIN_FITNESS)
-        eval_num++;
-      }
-    else
-      {
-      threaddata[thread_num].thread_num = 0;
-      threaddata[thread_num].eval_num = -1;
-      num_threads--;
-      }
-    }
+  return;
+  }
+
+
+/*
+ * Wait for a worker process to complete an evaluation, then store
+ * its results.
+ */
+static void gaul_forkpool_collect(forkpool_t *pool, population *pop)
+  {
+  forkslot_t	*slot;		/* Completed slot. */
+  entity	*this_entity;	/* Evaluated entity. */
+  int		n;		/* Index of completed slot. */
+  int		i;		/* Loop over fitness vector. */
+
+  if ( read(pool->result_fd, &n, sizeof(int)) != sizeof(int) )
+    die("Evaluation worker process terminated unexpectedly.");
+
+  slot = FORKSLOT(pool, n);
+  this_entity = pop->entity_iarray[slot->rank];
+
+  this_entity->fitness = slot->fitness;
+  for (i=0; i<pop->fitness_dimensions; i++)
+    this_entity->fitvector[i] = FORKSLOT_FITVECTOR(slot)[i];
+
+  pool->free_slots[pool->num_free++] = n;
 
   return;
   }
-#endif /* HAVE_PTHREADS */
 
 
 /**********************************************************************
-  gaul_adapt_and_evaluate()
-  synopsis:	Fitness evaluations.
-		Evaluate the new entities produced in the current
-		generation, whilst performing any necessary adaptation.
-		Simple sequential version.
-  parameters:	population *pop
+  gaul_forkpool_evaluate()
+  synopsis:	Evaluate each entity with rank in the range
+		[first, end) using the pool's worker processes.
+		Entities with chromosomes too large for a slot are
+		evaluated locally.  Blocks until all evaluations are
+		complete.
+  parameters:	forkpool_t *pool
+		population *pop
+		const int first
+		const int end
+		const boolean skip_evaluated	Whether to skip entities that already have a fitness.
   return:	none
-  last updated:	11 Jun 2002
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-static void gaul_adapt_and_evaluate(population *pop)
+static void gaul_forkpool_evaluate( forkpool_t *pool, population *pop,
+                                    const int first, const int end,
+                                    const boolean skip_evaluated )
   {
-  int		i;			/* Loop variable over entity ranks. */
-  entity	*adult=NULL;		/* Adapted entity. */
-  int		adultrank;		/* Rank of adapted entity. */
+  forkslot_t	*slot;			/* Slot to fill. */
+  entity	*this_entity;		/* Entity to evaluate. */
+  gaulbyte	*buffer=NULL;		/* Serialised chromosomes. */
+  unsigned int	max_len=0;		/* Size of buffer. */
+  unsigned int	len;			/* Length of serialised chromosomes. */
+  int		num_pending=0;		/* Number of evaluations in progress. */
+  int		rank;			/* Loop over entities. */
+  int		n;			/* Index of slot. */
+
+  for (rank=first; rank<end; rank++)
+    {
+    this_entity = pop->entity_iarray[rank];
 
-  if (pop->scheme == GA_SCHEME_DARWIN)
-    {	/* This is pure Darwinian evolution.  Simply assess fitness of all children.  */
+    if (skip_evaluated && this_entity->fitness != GA_MIN_FITNESS) continue;
 
-    plog(LOG_VERBOSE, "*** Fitness Evaluations ***");
+    len = pop->chromosome_to_bytes(pop, this_entity, &buffer, &max_len);
 
-#pragma omp parallel for \
-   shared(pop) private(i) \
-   schedule(static)
-    for (i=pop->orig_size; i<pop->size; i++)
+    if (len > pool->slot_size)
       {
-/*printf("DEBUG: gaul_adapt_and_evaluate() parallel for %d on %d/%d.\n", i, omp_get_thread_num(), omp_get_num_threads());*/
-      if ( pop->evaluate(pop, pop->entity_iarray[i]) == FALSE )
-        pop->entity_iarray[i]->fitness = GA_MIN_FITNESS;
+      plog(LOG_VERBOSE, "Chromosomes of entity %d are too large for shared slot, evaluating locally.", rank);
+      if ( pop->evaluate(pop, this_entity) == FALSE )
+        this_entity->fitness = GA_MIN_FITNESS;
+      continue;
       }
 
-    return;
-    }
-  else
-    {	/* Some kind of adaptation is required.  First reevaluate parents, as needed, then children. */
-
-    plog(LOG_VERBOSE, "*** Adaptation and Fitness Evaluations ***");
-
-    if ( (pop->scheme & GA_SCHEME_BALDWIN_PARENTS)!=0 )
-      {
-#pragma omp parallel for \
-   shared(pop) private(i,adult) \
-   schedule(static)
-      for (i=0; i<pop->orig_size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        pop->entity_iarray[i]->fitness=adult->fitness;
-#pragma omp master
-        ga_entity_dereference(pop, adult);
-        }
-      }
-    else if ( (pop->scheme & GA_SCHEME_LAMARCK_PARENTS)!=0 )
+    if (pool->num_free == 0)
       {
-#pragma omp parallel for \
-   shared(pop) private(i,adult,adultrank) \
-   schedule(static)
-      for (i=0; i<pop->orig_size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        adultrank = ga_get_entity_rank(pop, adult);
-        gaul_entity_swap_rank(pop, i, adultrank);
-#pragma omp master
-        ga_entity_dereference_by_rank(pop, adultrank);
-        }
+      gaul_forkpool_collect(pool, pop);
+      num_pending--;
       }
 
-    if ( (pop->scheme & GA_SCHEME_BALDWIN_CHILDREN)!=0 )
-      { 
-#pragma omp parallel for \
-   shared(pop) private(i,adult) \
-   schedule(static)
-      for (i=pop->orig_size; i<pop->size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        pop->entity_iarray[i]->fitness=adult->fitness;
-#pragma omp master
-        ga_entity_dereference(pop, adult);
-        }
-      }
-    else if ( (pop->scheme & GA_SCHEME_LAMARCK_CHILDREN)!=0 )
-      {
-#pragma omp parallel for \
-   shared(pop) private(i,adult,adultrank) \
-   schedule(static)
-      for (i=pop->orig_size; i<pop->size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        adultrank = ga_get_entity_rank(pop, adult);
-        gaul_entity_swap_rank(pop, i, adultrank);
-#pragma omp master
-        ga_entity_dereference_by_rank(pop, adultrank);
-        }
-      }
+    n = pool->free_slots[--pool->num_free];
+    slot = FORKSLOT(pool, n);
+    slot->rank = rank;
+    slot->len = len;
+    memcpy(FORKSLOT_BYTES(pop, slot), buffer, len);
+
+    if ( write(pool->job_fd, &n, sizeof(int)) != sizeof(int) )
+      die("Unable to pass job to evaluation worker process.");
+    num_pending++;
+    }
+
+  while (num_pending > 0)
+    {
+    gaul_forkpool_collect(pool, pop);
+    num_pending--;
     }
 
+  if (max_len!=0) s_free(buffer);
+
   return;
   }
+#endif /* W32_CRIPPLED */
 
 
 /**********************************************************************
-  gaul_adapt_and_evaluate_mp()
-  synopsis:	Fitness evaluations.
-		Evaluate the new entities produced in the current
-		generation, whilst performing any necessary adaptation.
-		MPI version.
-  parameters:	population *pop
-  return:	none
-  last updated:	03 Feb 2003
+  Persistent worker thread pool.
+
+  The threaded drivers create a single pool of worker threads for the
+  duration of a run.  Work is handed to the pool as a contiguous range
+  of indices together with a task callback and an optional pointer
+  to data describing the work.  Indices are usually entity ranks.
+  Idle workers block
+  on a condition variable, and so does the master while it waits for
+  the range to be completed.
  **********************************************************************/
 
-#ifdef HAVE_MPI
-static void gaul_adapt_and_evaluate_mp(population *pop)
+#ifdef HAVE_PTHREADS
+
+typedef void (*gaul_pooltask)(population *pop, const int rank, vpointer data);
+
+typedef struct threadpool_s
   {
-  int		i;			/* Loop variable over entity ranks. */
-  entity	*adult=NULL;		/* Adapted entity. */
-  int		adultrank;		/* Rank of adapted entity. */
+  int			num_threads;	/* Number of worker threads. */
+  pthread_t		*tid;		/* Worker thread ids. */
+  pthread_mutex_t	lock;		/* Protects everything below. */
+  pthread_cond_t	work_cond;	/* Signalled when work is queued. */
+  pthread_cond_t	done_cond;	/* Signalled when work is completed. */
+  population		*pop;		/* Population being processed. */
+  gaul_pooltask		task;		/* Task to apply to each rank. */
+  vpointer		data;		/* Data passed to task. */
+  int			next;		/* Next rank to process. */
+  int			end;		/* One past the final rank. */
+  int			busy;		/* Number of tasks in progress. */
+  boolean		shutdown;	/* Whether workers should exit. */
+  } threadpool_t;
+
+/*
+ * This is the worker thread code.  Each worker repeatedly takes the
+ * next rank from the current range and applies the pool's task to it.
+ */
+static void *_threadpool_worker( void *data )
+  {
+  threadpool_t	*pool = (threadpool_t *)data;
+  population	*pop;		/* Population being processed. */
+  gaul_pooltask	task;		/* Task to apply. */
+  vpointer	taskdata;	/* Data passed to task. */
+  int		rank;		/* Rank of entity to process. */
 
-  plog(LOG_FIXME, "Need to parallelise this!");
+  pthread_mutex_lock(&(pool->lock));
 
-  if (pop->scheme == GA_SCHEME_DARWIN)
-    {	/* This is pure Darwinian evolution.  Simply assess fitness of all children.  */
+  while (TRUE)
+    {
+    while (!pool->shutdown && pool->next >= pool->end)
+      pthread_cond_wait(&(pool->work_cond), &(pool->lock));
 
-    plog(LOG_VERBOSE, "*** Fitness Evaluations ***");
+    if (pool->shutdown) break;
 
-#pragma omp parallel for \
-   shared(pop) private(i) \
-   schedule(static)
-    for (i=pop->orig_size; i<pop->size; i++)
-      {
-      if ( pop->evaluate(pop, pop->entity_iarray[i]) == FALSE )
-        pop->entity_iarray[i]->fitness = GA_MIN_FITNESS;
-      }
+    rank = pool->next++;
+    pop = pool->pop;
+    task = pool->task;
+    taskdata = pool->data;
+    pool->busy++;
 
-    return;
+    pthread_mutex_unlock(&(pool->lock));
+    task(pop, rank, taskdata);
+    pthread_mutex_lock(&(pool->lock));
+
+    pool->busy--;
+    if (pool->next >= pool->end && pool->busy == 0)
+      pthread_cond_signal(&(pool->done_cond));
     }
-  else
-    {	/* Some kind of adaptation is required.  First reevaluate parents, as needed, then children. */
 
-    plog(LOG_VERBOSE, "*** Adaptation and Fitness Evaluations ***");
+  pthread_mutex_unlock(&(pool->lock));
 
-    if ( (pop->scheme & GA_SCHEME_BALDWIN_PARENTS)!=0 )
-      {
-#pragma omp parallel for \
-   shared(pop) private(i,adult) \
-   schedule(static)
-      for (i=0; i<pop->orig_size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        pop->entity_iarray[i]->fitness=adult->fitness;
-        ga_entity_dereference(pop, adult);
-        }
-      }
-    else if ( (pop->scheme & GA_SCHEME_LAMARCK_PARENTS)!=0 )
-      {
-#pragma omp parallel for \
-   shared(pop) private(i,adult,adultrank) \
-   schedule(static)
-      for (i=0; i<pop->orig_size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        adultrank = ga_get_entity_rank(pop, adult);
-        gaul_entity_swap_rank(pop, i, adultrank);
+  return NULL;
+  }
+
+
+/**********************************************************************
+  gaul_get_num_threads()
+  synopsis:	Determine the number of worker threads to use, from
+		the environment if possible.  The configured
+		environment variable takes precedence over
+		GAUL_NUM_THREADS.
+  parameters:	none
+  return:	Number of threads.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_get_num_threads(void)
+  {
+  int		num_threads=0;		/* Number of threads to use. */
+  char		*num_thread_str;	/* Value of enviroment variable. */
+
+  num_thread_str = getenv(GA_NUM_THREADS_ENVVAR_STRING);
+  if (!num_thread_str) num_thread_str = getenv("GAUL_NUM_THREADS");
+  if (num_thread_str) num_threads = atoi(num_thread_str);
+  if (num_threads <= 0) num_threads = GA_DEFAULT_NUM_THREADS;
+
+  return num_threads;
+  }
+
+
+/**********************************************************************
+  gaul_threadpool_new()
+  synopsis:	Start a pool of persistent worker threads.
+  parameters:	const int num_threads	Number of worker threads.
+  return:	threadpool_t *		The new pool.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static threadpool_t *gaul_threadpool_new(const int num_threads)
+  {
+  threadpool_t	*pool;		/* The new pool. */
+  int		i;		/* Loop over threads. */
+  int		err;		/* Return value from pthread_create(). */
+
+  if (num_threads < 1) die("Invalid number of threads requested.");
+
+  if ( !(pool = s_malloc(sizeof(threadpool_t))) )
+    die("Unable to allocate memory");
+  if ( !(pool->tid = s_malloc(sizeof(pthread_t)*num_threads)) )
+    die("Unable to allocate memory");
+
+  pthread_mutex_init(&(pool->lock), NULL);
+  pthread_cond_init(&(pool->work_cond), NULL);
+  pthread_cond_init(&(pool->done_cond), NULL);
+
+  pool->num_threads = num_threads;
+  pool->pop = NULL;
+  pool->task = NULL;
+  pool->data = NULL;
+  pool->next = 0;
+  pool->end = 0;
+  pool->busy = 0;
+  pool->shutdown = FALSE;
+
+  for (i=0; i<num_threads; i++)
+    {
+    if ( (err = pthread_create(&(pool->tid[i]), NULL, _threadpool_worker, (void *)pool)) != 0 )
+      {       /* Error in thread creation. */
+      dief("Error %d in pthread_create. (%s)", err, err==EAGAIN?"EAGAIN":err==ENOMEM?"ENOMEM":"unknown");
+      }
+    }
+
+  return pool;
+  }
+
+
+/**********************************************************************
+  gaul_threadpool_free()
+  synopsis:	Stop and join all worker threads in a pool, then
+		release its memory.
+  parameters:	threadpool_t *pool
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_threadpool_free(threadpool_t *pool)
+  {
+  int		i;		/* Loop over threads. */
+  int		err;		/* Return value from pthread_join(). */
+
+  pthread_mutex_lock(&(pool->lock));
+  pool->shutdown = TRUE;
+  pthread_cond_broadcast(&(pool->work_cond));
+  pthread_mutex_unlock(&(pool->lock));
+
+  for (i=0; i<pool->num_threads; i++)
+    {
+    if ( (err = pthread_join(pool->tid[i], NULL)) != 0 )
+      {
+      dief("Error %d in pthread_join. (%s)", err, err==ESRCH?"ESRCH":err==EINVAL?"EINVAL":err==EDEADLK?"EDEADLK":"unknown");
+      }
+    }
+
+  pthread_cond_destroy(&(pool->work_cond));
+  pthread_cond_destroy(&(pool->done_cond));
+  pthread_mutex_destroy(&(pool->lock));
+
+  s_free(pool->tid);
+  s_free(pool);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_threadpool_run()
+  synopsis:	Apply a task to each entity with rank in the range
+		[first, end) using the pool's worker threads.  Blocks
+		until all tasks are complete.  The population
+		structure must not be reorganised by the task.
+  parameters:	threadpool_t *pool
+		population *pop
+		gaul_pooltask task
+		vpointer data		Passed to task.
+		const int first
+		const int end
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_threadpool_run( threadpool_t *pool, population *pop,
+                                 gaul_pooltask task, vpointer data,
+                                 const int first, const int end )
+  {
+
+  if (first >= end) return;
+
+  pthread_mutex_lock(&(pool->lock));
+
+  pool->pop = pop;
+  pool->task = task;
+  pool->data = data;
+  pool->next = first;
+  pool->end = end;
+  pthread_cond_broadcast(&(pool->work_cond));
+
+  while (pool->next < pool->end || pool->busy > 0)
+    pthread_cond_wait(&(pool->done_cond), &(pool->lock));
+
+  pthread_mutex_unlock(&(pool->lock));
+
+  return;
+  }
+
+
+/*
+ * Pool tasks used by gaul_ensure_evaluations_threaded(),
+ * gaul_adapt_and_evaluate_threaded() and gaul_survival_threaded().
+ */
+static void _evaluation_task(population *pop, const int rank, vpointer data)
+  {
+  random_counter	counter;	/* Counter-based PRNG. */
+  random_counter	*previous=NULL;	/* PRNG counter to restore. */
+
+  if (pop->reproducible)
+    {
+    gaul_random_counter_init(pop, &counter, rank, GA_COUNTER_EVALUATION);
+    previous = random_set_thread_counter(&counter);
+    }
+
+  if ( pop->evaluate(pop, pop->entity_iarray[rank]) == FALSE )
+    pop->entity_iarray[rank]->fitness = GA_MIN_FITNESS;
+
+  if (pop->reproducible)
+    random_set_thread_counter(previous);
+
+  return;
+  }
+
+static void _ensure_evaluation_task(population *pop, const int rank, vpointer data)
+  {
+
+  if (pop->entity_iarray[rank]->fitness == GA_MIN_FITNESS)
+    _evaluation_task(pop, rank, data);
+
+  return;
+  }
+#endif /* HAVE_PTHREADS */
+
+
+/**********************************************************************
+  gaul_reproduction_threaded()
+  synopsis:	Mating and mutation cycles.  (i.e. Sexual and asexual
+		reproduction.)
+		Threaded processing version.
+
+		All parents are selected up front, in the calling
+		thread, and the child entities are then reserved in
+		a single call to ga_get_free_entities().  Each
+		crossover or mutation is a separate task for the
+		worker pool, and runs with a private PRNG state
+		seeded from the global PRNG.  Seeds are drawn in task
+		order, so the children do not depend on the number of
+		threads or on scheduling.  If the population is
+		reproducible, a counter-based PRNG keyed by the task
+		index is used instead, and no seeds are drawn.  The crossover, mutation
+		and data reference incrementor callbacks must be
+		thread-safe.
+
+		If the compiler doesn't support thread-local storage,
+		the tasks are run in the calling thread instead.
+  parameters:	population *pop
+		threadpool_t *pool
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+#ifdef HAVE_PTHREADS
+
+typedef struct breedtask_s
+  {
+  entity	*mother, *father;	/* Parent entities.  No father for mutation. */
+  entity	*daughter, *son;	/* Child entities.  No son for mutation. */
+  unsigned int	seed;			/* Seed for this task's PRNG. */
+  } breedtask_t;
+
+/*
+ * Pool task used by gaul_reproduction_threaded().
+ */
+static void _breeding_task(population *pop, const int i, vpointer data)
+  {
+  breedtask_t	*task = &(((breedtask_t *)data)[i]);
+  random_state	state;			/* Private PRNG state. */
+  random_state	*previous=NULL;		/* PRNG state to restore. */
+  random_counter	counter;		/* Counter-based PRNG. */
+  random_counter	*previous_counter=NULL;	/* PRNG counter to restore. */
+
+  if (pop->reproducible)
+    {
+    gaul_random_counter_init(pop, &counter, i, GA_COUNTER_BREEDING);
+    previous_counter = random_set_thread_counter(&counter);
+    }
+  else
+    {
+    random_seed_state(&state, task->seed);
+    previous = random_set_thread_state(&state);
+    }
+
+  if (task->father)
+    pop->crossover(pop, task->mother, task->father, task->daughter, task->son);
+  else
+    pop->mutate(pop, task->mother, task->daughter);
+
+  if (pop->reproducible)
+    random_set_thread_counter(previous_counter);
+  else
+    random_set_thread_state(previous);
+
+  return;
+  }
+
+static void gaul_reproduction_threaded(population *pop, threadpool_t *pool)
+  {
+  entity	*mother, *father;	/* Parent entities. */
+  breedtask_t	*tasks=NULL;		/* Planned crossovers and mutations. */
+  int		num_tasks=0;		/* Number of planned tasks. */
+  int		max_tasks=0;		/* Allocated size of tasks. */
+  entity	**children;		/* Reserved child entities. */
+  int		num_children=0;		/* Number of child entities. */
+  int		i, j;			/* Loop over tasks and children. */
+
+/*
+ * Select pairs of entities to mate via crossover.
+ */
+  plog(LOG_VERBOSE, "*** Mating cycle ***");
+
+  if (pop->crossover_ratio > 0.0)
+    {
+    pop->select_state = 0;
+
+    while ( !(pop->select_two(pop, &mother, &father)) )
+      {
+      if (mother && father)
+        {
+        plog(LOG_VERBOSE, "Crossover between %d (rank %d fitness %f) and %d (rank %d fitness %f)",
+             ga_get_entity_id(pop, mother),
+             ga_get_entity_rank(pop, mother), mother->fitness,
+             ga_get_entity_id(pop, father),
+             ga_get_entity_rank(pop, father), father->fitness);
+
+        if (num_tasks == max_tasks)
+          {
+          max_tasks = max_tasks*2+pop->orig_size;
+          if ( !(tasks = s_realloc(tasks, sizeof(breedtask_t)*max_tasks)) )
+            die("Unable to allocate memory");
+          }
+
+        tasks[num_tasks].mother = mother;
+        tasks[num_tasks].father = father;
+        num_tasks++;
+        num_children += 2;
+        }
+      else
+        {
+        plog( LOG_VERBOSE, "Crossover not performed." );
+        }
+      }
+    }
+
+/*
+ * Select entities to undergo asexual reproduction.
+ */
+  plog(LOG_VERBOSE, "*** Mutation cycle ***");
+
+  if (pop->mutation_ratio > 0.0)
+    {
+    pop->select_state = 0;
+
+    while ( !(pop->select_one(pop, &mother)) )
+      {
+      if (mother)
+        {
+        plog(LOG_VERBOSE, "Mutation of %d (rank %d fitness %f)",
+             ga_get_entity_id(pop, mother),
+             ga_get_entity_rank(pop, mother), mother->fitness );
+
+        if (num_tasks == max_tasks)
+          {
+          max_tasks = max_tasks*2+pop->orig_size;
+          if ( !(tasks = s_realloc(tasks, sizeof(breedtask_t)*max_tasks)) )
+            die("Unable to allocate memory");
+          }
+
+        tasks[num_tasks].mother = mother;
+        tasks[num_tasks].father = NULL;
+        num_tasks++;
+        num_children++;
+        }
+      else
+        {
+        plog( LOG_VERBOSE, "Mutation not performed." );
+        }
+      }
+    }
+
+  if (num_tasks == 0) return;
+
+/*
+ * Reserve all children at once, and draw a seed for each task.
+ */
+  if ( !(children = s_malloc(sizeof(entity *)*num_children)) )
+    die("Unable to allocate memory");
+
+  ga_get_free_entities(pop, num_children, children);
+
+  for (i=0, j=0; i<num_tasks; i++)
+    {
+    if (tasks[i].father)
+      {
+      tasks[i].son = children[j++];
+      tasks[i].daughter = children[j++];
+      }
+    else
+      {
+      tasks[i].son = NULL;
+      tasks[i].daughter = children[j++];
+      }
+    tasks[i].seed = pop->reproducible?0:random_rand();
+    }
+
+#if HAVE_THREAD_LOCAL==1
+  gaul_threadpool_run(pool, pop, _breeding_task, (vpointer) tasks, 0, num_tasks);
+#else
+  for (i=0; i<num_tasks; i++)
+    _breeding_task(pop, i, (vpointer) tasks);
+#endif
+
+  s_free(children);
+  s_free(tasks);
+
+  return;
+  }
+#endif /* HAVE_PTHREADS */
+
+
+/**********************************************************************
+  gaul_ensure_evaluations_threaded()
+  synopsis:	Fitness evaluations.
+		Evaluate all previously unevaluated entities.
+		No adaptation.
+		Threaded processing version.
+  parameters:	population *pop
+		threadpool_t *pool
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+#ifdef HAVE_PTHREADS
+static void gaul_ensure_evaluations_threaded( population *pop, threadpool_t *pool )
+  {
+
+  gaul_threadpool_run(pool, pop, _ensure_evaluation_task, NULL, 0, pop->size);
+
+  return;
+  }
+#endif /* HAVE_PTHREADS */
+
+
+/**********************************************************************
+  gaul_adapt_and_evaluate()
+  synopsis:	Fitness evaluations.
+		Evaluate the new entities produced in the current
+		generation, whilst performing any necessary adaptation.
+		Simple sequential version.
+  parameters:	population *pop
+  return:	none
+  last updated:	11 Jun 2002
+ **********************************************************************/
+
+static void gaul_adapt_and_evaluate(population *pop)
+  {
+  int		i;			/* Loop variable over entity ranks. */
+  entity	*adult=NULL;		/* Adapted entity. */
+  int		adultrank;		/* Rank of adapted entity. */
+
+  if (pop->scheme == GA_SCHEME_DARWIN)
+    {	/* This is pure Darwinian evolution.  Simply assess fitness of all children.  */
+
+    plog(LOG_VERBOSE, "*** Fitness Evaluations ***");
+
+    gaul_population_evaluate_ranks(pop, pop->orig_size, pop->size, FALSE);
+
+    return;
+    }
+  else
+    {	/* Some kind of adaptation is required.  First reevaluate parents, as needed, then children. */
+
+    plog(LOG_VERBOSE, "*** Adaptation and Fitness Evaluations ***");
+
+    if ( (pop->scheme & GA_SCHEME_BALDWIN_PARENTS)!=0 )
+      {
+#pragma omp parallel for \
+   shared(pop) private(i,adult) \
+   schedule(static)
+      for (i=0; i<pop->orig_size; i++)
+        {
+        adult = pop->adapt(pop, pop->entity_iarray[i]);
+        pop->entity_iarray[i]->fitness=adult->fitness;
+#pragma omp master
+        ga_entity_dereference(pop, adult);
+        }
+      }
+    else if ( (pop->scheme & GA_SCHEME_LAMARCK_PARENTS)!=0 )
+      {
+#pragma omp parallel for \
+   shared(pop) private(i,adult,adultrank) \
+   schedule(static)
+      for (i=0; i<pop->orig_size; i++)
+        {
+        adult = pop->adapt(pop, pop->entity_iarray[i]);
+        adultrank = ga_get_entity_rank(pop, adult);
+        gaul_entity_swap_rank(pop, i, adultrank);
+#pragma omp master
+        ga_entity_dereference_by_rank(pop, adultrank);
+        }
+      }
+
+    if ( (pop->scheme & GA_SCHEME_BALDWIN_CHILDREN)!=0 )
+      { 
+#pragma omp parallel for \
+   shared(pop) private(i,adult) \
+   schedule(static)
+      for (i=pop->orig_size; i<pop->size; i++)
+        {
+        adult = pop->adapt(pop, pop->entity_iarray[i]);
+        pop->entity_iarray[i]->fitness=adult->fitness;
+#pragma omp master
+        ga_entity_dereference(pop, adult);
+        }
+      }
+    else if ( (pop->scheme & GA_SCHEME_LAMARCK_CHILDREN)!=0 )
+      {
+#pragma omp parallel for \
+   shared(pop) private(i,adult,adultrank) \
+   schedule(static)
+      for (i=pop->orig_size; i<pop->size; i++)
+        {
+        adult = pop->adapt(pop, pop->entity_iarray[i]);
+        adultrank = ga_get_entity_rank(pop, adult);
+        gaul_entity_swap_rank(pop, i, adultrank);
+#pragma omp master
+        ga_entity_dereference_by_rank(pop, adultrank);
+        }
+      }
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_adapt_and_evaluate_mp()
+  synopsis:	Fitness evaluations.
+		Evaluate the new entities produced in the current
+		generation, whilst performing any necessary adaptation.
+		MPI version.
+  parameters:	population *pop
+  return:	none
+  last updated:	03 Feb 2003
+ **********************************************************************/
+
+#ifdef HAVE_MPI
+static void gaul_adapt_and_evaluate_mp(population *pop)
+  {
+  int		i;			/* Loop variable over entity ranks. */
+  entity	*adult=NULL;		/* Adapted entity. */
+  int		adultrank;		/* Rank of adapted entity. */
+
+  plog(LOG_FIXME, "Need to parallelise this!");
+
+  if (pop->scheme == GA_SCHEME_DARWIN)
+    {	/* This is pure Darwinian evolution.  Simply assess fitness of all children.  */
+
+    plog(LOG_VERBOSE, "*** Fitness Evaluations ***");
+
+#pragma omp parallel for \
+   shared(pop) private(i) \
+   schedule(static)
+    for (i=pop->orig_size; i<pop->size; i++)
+      {
+      if ( pop->evaluate(pop, pop->entity_iarray[i]) == FALSE )
+        pop->entity_iarray[i]->fitness = GA_MIN_FITNESS;
+      }
+
+    return;
+    }
+  else
+    {	/* Some kind of adaptation is required.  First reevaluate parents, as needed, then children. */
+
+    plog(LOG_VERBOSE, "*** Adaptation and Fitness Evaluations ***");
+
+    if ( (pop->scheme & GA_SCHEME_BALDWIN_PARENTS)!=0 )
+      {
+#pragma omp parallel for \
+   shared(pop) private(i,adult) \
+   schedule(static)
+      for (i=0; i<pop->orig_size; i++)
+        {
+        adult = pop->adapt(pop, pop->entity_iarray[i]);
+        pop->entity_iarray[i]->fitness=adult->fitness;
+        ga_entity_dereference(pop, adult);
+        }
+      }
+    else if ( (pop->scheme & GA_SCHEME_LAMARCK_PARENTS)!=0 )
+      {
+#pragma omp parallel for \
+   shared(pop) private(i,adult,adultrank) \
+   schedule(static)
+      for (i=0; i<pop->orig_size; i++)
+        {
+        adult = pop->adapt(pop, pop->entity_iarray[i]);
+        adultrank = ga_get_entity_rank(pop, adult);
+        gaul_entity_swap_rank(pop, i, adultrank);
         ga_entity_dereference_by_rank(pop, adultrank);
         }
       }
@@ -1663,163 +2253,209 @@ static void gaul_adapt_and_evaluate_forked(population *pop,
 
 
 /**********************************************************************
-  gaul_adapt_and_evaluate_threaded()
+  gaul_adapt_and_evaluate_preforked()
   synopsis:	Fitness evaluations.
 		Evaluate the new entities produced in the current
 		generation, whilst performing any necessary adaptation.
-		Threaded processing version.
+		Pre-forked worker process version.  As with the
+		other parallel versions, adaptation itself is
+		performed sequentially.
   parameters:	population *pop
+		forkpool_t *pool
   return:	none
-  last updated:	15 Apr 2004
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-#ifdef HAVE_PTHREADS
-static void gaul_adapt_and_evaluate_threaded(population *pop,
-	       		const int max_threads,
-			threaddata_t *threaddata)
+#ifndef W32_CRIPPLED
+static void gaul_adapt_and_evaluate_preforked(population *pop, forkpool_t *pool)
   {
-  int		i;			/* Loop variable over entity ranks. */
-  entity	*adult=NULL;		/* Adapted entity. */
-  int		adultrank;		/* Rank of adapted entity. */
-  int		thread_num;		/* Index of current thread. */
-  int		num_threads;		/* Number of threads currently in use. */
-  int		eval_num;		/* Index of current entity. */
 
   if (pop->scheme == GA_SCHEME_DARWIN)
     {	/* This is pure Darwinian evolution.  Simply assess fitness of all children.  */
 
     plog(LOG_VERBOSE, "*** Fitness Evaluations ***");
 
-/* 
- * A thread is created for each fitness evaluation upto
- * a maximum of max_threads at which point we wait for 
- * results before creating more.
- *
- * Skip evaluations for entities that have been previously evaluated.
- *
- * FIXME: This lump of code is almost identical to that in
- * gaul_ensure_evaluations_threaded() and shouldn't really be duplicated.
+    gaul_forkpool_evaluate(pool, pop, pop->orig_size, pop->size, FALSE);
+    }
+  else
+    {	/* Some kind of adaptation is required. */
+    gaul_adapt_and_evaluate(pop);
+    }
+
+  return;
+  }
+#endif
+
+
+/**********************************************************************
+  gaul_adapt_threaded()
+  synopsis:	Adapt the entities with ranks in the range
+		[first, end), using the pool's worker threads.  Each
+		adaptation is a separate task, with a private PRNG
+		state, as in gaul_reproduction_threaded(), so the
+		results do not depend on the number of threads.  The
+		adapted entities are obtained from per-thread entity
+		magazines, so the workers don't contend for the
+		population's lock.  With Baldwinian adaptation, only
+		the fitness is kept.  With Lamarckian adaptation, each
+		adapted entity replaces the original at its rank.
+		The adaptation and evaluation callbacks must be
+		thread-safe.
+  parameters:	population *pop
+		threadpool_t *pool
+		const int first
+		const int end
+		const boolean lamarck	Whether adapted entities replace
+					the originals.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+#ifdef HAVE_PTHREADS
+
+typedef struct adapttask_s
+  {
+  int		rank;		/* Rank of the original entity. */
+  entity	*child;		/* The original entity. */
+  entity	*adult;		/* The adapted entity, for Lamarckian adaptation. */
+  boolean	lamarck;	/* Whether the adapted entity is kept. */
+  unsigned int	seed;		/* Seed for this task's PRNG. */
+  } adapttask_t;
+
+/*
+ * Pool task used by gaul_adapt_threaded().
  */
-  thread_num = 0;
-  eval_num = 0;
+static void _adaptation_task(population *pop, const int i, vpointer data)
+  {
+  adapttask_t	*task = &(((adapttask_t *)data)[i]);
+  random_state	state;			/* Private PRNG state. */
+  random_state	*previous=NULL;		/* PRNG state to restore. */
+  random_counter	counter;		/* Counter-based PRNG. */
+  random_counter	*previous_counter=NULL;	/* PRNG counter to restore. */
 
-  /* Skip to the next entity which needs evaluating. */
-  while (eval_num < pop->size && pop->entity_iarray[eval_num]->fitness!=GA_MIN_FITNESS) eval_num++;
+  if (pop->reproducible)
+    {
+    gaul_random_counter_init(pop, &counter, task->rank, GA_COUNTER_ADAPTATION);
+    previous_counter = random_set_thread_counter(&counter);
+    }
+  else
+    {
+    random_seed_state(&state, task->seed);
+    previous = random_set_thread_state(&state);
+    }
 
-  while (thread_num < max_threads && eval_num < pop->size)
+  task->adult = pop->adapt(pop, task->child);
+
+  if (!task->lamarck)
     {
-    threaddata[thread_num].thread_num = thread_num;
-    threaddata[thread_num].eval_num = eval_num;
+    task->child->fitness = task->adult->fitness;
+    ga_entity_dereference(pop, task->adult);
+    task->adult = NULL;
+    }
 
-    if (pthread_create(&(threaddata[thread_num].pid), NULL, _evaluation_thread, (void *)&(threaddata[thread_num])) < 0)
-      {       /* Error in thread creation. */
-      dief("Error %d in pthread_create. (%s)", errno, errno==EAGAIN?"EAGAIN":errno==ENOMEM?"ENOMEM":"unknown");
-      }
+  if (pop->reproducible)
+    random_set_thread_counter(previous_counter);
+  else
+    random_set_thread_state(previous);
 
-    thread_num++;
-    eval_num++;
+  return;
+  }
 
-    /* Skip to the next entity which needs evaluating. */
-    while (eval_num < pop->size && pop->entity_iarray[eval_num]->fitness!=GA_MIN_FITNESS)
-      eval_num++;
-    }
+static void gaul_adapt_threaded(population *pop, threadpool_t *pool,
+                                const int first, const int end,
+                                const boolean lamarck)
+  {
+  adapttask_t	*tasks;		/* Planned adaptations. */
+  int		num_tasks=end-first;	/* Number of planned adaptations. */
+  int		i;		/* Loop over tasks. */
+  int		adultrank;	/* Rank of adapted entity. */
 
-  num_threads = thread_num;
+  if (num_tasks < 1) return;
 
-  /* Wait for a thread to finish and, if needed, create another. */
-  /* Also, find which entity this thread was evaluating. */
-  thread_num=0;
-  while (num_threads > 0)
+  if ( !(tasks = s_malloc(sizeof(adapttask_t)*num_tasks)) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<num_tasks; i++)
     {
-    while (threaddata[thread_num].thread_num >= 0)
-      {
-      thread_num++;
-      if (thread_num==max_threads)
-        {
-        thread_num=0;
-/* FIXME: Insert short sleep here? */
-        }
-      }
+    tasks[i].rank = first+i;
+    tasks[i].child = pop->entity_iarray[first+i];
+    tasks[i].adult = NULL;
+    tasks[i].lamarck = lamarck;
+    tasks[i].seed = pop->reproducible?0:random_rand();
+    }
 
-#if GA_DEBUG>2
-printf("DEBUG: Thread %d finished.  num_threads=%d eval_num=%d/%d\n", thread_num, num_threads, eval_num, pop->size);
+#if HAVE_THREAD_LOCAL==1
+  ga_population_begin_magazines(pop, 0);
+  gaul_threadpool_run(pool, pop, _adaptation_task, (vpointer) tasks, 0, num_tasks);
+  ga_population_end_magazines(pop);
+#else
+  for (i=0; i<num_tasks; i++)
+    _adaptation_task(pop, i, (vpointer) tasks);
 #endif
 
-    if ( pthread_join(threaddata[thread_num].pid, NULL) < 0 )
+/*
+ * The adapted entities are now ranked, after the originals.
+ */
+  if (lamarck)
+    {
+    for (i=0; i<num_tasks; i++)
       {
-      dief("Error %d in pthread_join. (%s)", errno, errno==ESRCH?"ESRCH":errno==EINVAL?"EINVAL":errno==EDEADLK?"EDEADLK":"unknown");
+      adultrank = ga_get_entity_rank(pop, tasks[i].adult);
+      gaul_entity_swap_rank(pop, first+i, adultrank);
+      ga_entity_dereference_by_rank(pop, adultrank);
       }
+    }
 
-    if (eval_num < pop->size)
-      {       /* New thread. */
-      threaddata[thread_num].thread_num = thread_num;
-      threaddata[thread_num].eval_num = eval_num;
+  s_free(tasks);
 
-      if (pthread_create(&(threaddata[thread_num].pid), NULL, _evaluation_thread, (void *)&(threaddata[thread_num])) < 0)
-        {       /* Error in thread creation. */
-        dief("Error %d in pthread_create. (%s)", errno, errno==EAGAIN?"EAGAIN":errno==ENOMEM?"ENOMEM":"unknown");
-        }
+  return;
+  }
+#endif /* HAVE_PTHREADS */
 
-      eval_num++;
 
-      /* Skip to the next entity which needs evaluating. */
-      while (eval_num < pop->size && pop->entity_iarray[eval_num]->fitness!=GA_MIN_FITNESS)
-        eval_num++;
-      }
-    else
-      {
-      threaddata[thread_num].thread_num = 0;
-      threaddata[thread_num].eval_num = -1;
-      num_threads--;
-      }
-    }
+/**********************************************************************
+  gaul_adapt_and_evaluate_threaded()
+  synopsis:	Fitness evaluations.
+		Evaluate the new entities produced in the current
+		generation, whilst performing any necessary adaptation.
+		Threaded processing version.
+  parameters:	population *pop
+		threadpool_t *pool
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
 
-    return;
-    }
-  else
-    {	/* Some kind of adaptation is required.  First reevaluate parents, as needed, then children. */
+#ifdef HAVE_PTHREADS
+static void gaul_adapt_and_evaluate_threaded(population *pop,
+			threadpool_t *pool)
+  {
 
-    plog(LOG_VERBOSE, "*** Adaptation and Fitness Evaluations ***");
+  if (pop->scheme == GA_SCHEME_DARWIN)
+    {	/* This is pure Darwinian evolution.  Simply assess fitness of all children.  */
 
-    if ( (pop->scheme & GA_SCHEME_BALDWIN_PARENTS)!=0 )
-      {
-      for (i=0; i<pop->orig_size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        pop->entity_iarray[i]->fitness=adult->fitness;
-        ga_entity_dereference(pop, adult);
-        }
-      }
+    plog(LOG_VERBOSE, "*** Fitness Evaluations ***");
+
+/*
+ * Hand all unevaluated entities to the worker pool.
+ */
+    gaul_ensure_evaluations_threaded(pop, pool);
+
+    return;
+    }
+  else
+    {	/* Some kind of adaptation is required.  First reevaluate parents, as needed, then children. */
+
+    plog(LOG_VERBOSE, "*** Adaptation and Fitness Evaluations ***");
+
+    if ( (pop->scheme & GA_SCHEME_BALDWIN_PARENTS)!=0 )
+      gaul_adapt_threaded(pop, pool, 0, pop->orig_size, FALSE);
     else if ( (pop->scheme & GA_SCHEME_LAMARCK_PARENTS)!=0 )
-      {
-      for (i=0; i<pop->orig_size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        adultrank = ga_get_entity_rank(pop, adult);
-        gaul_entity_swap_rank(pop, i, adultrank);
-        ga_entity_dereference_by_rank(pop, adultrank);
-        }
-      }
+      gaul_adapt_threaded(pop, pool, 0, pop->orig_size, TRUE);
 
     if ( (pop->scheme & GA_SCHEME_BALDWIN_CHILDREN)!=0 )
-      { 
-      for (i=pop->orig_size; i<pop->size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        pop->entity_iarray[i]->fitness=adult->fitness;
-        ga_entity_dereference(pop, adult);
-        }
-      }
+      gaul_adapt_threaded(pop, pool, pop->orig_size, pop->size, FALSE);
     else if ( (pop->scheme & GA_SCHEME_LAMARCK_CHILDREN)!=0 )
-      {
-      for (i=pop->orig_size; i<pop->size; i++)
-        {
-        adult = pop->adapt(pop, pop->entity_iarray[i]);
-        adultrank = ga_get_entity_rank(pop, adult);
-        gaul_entity_swap_rank(pop, i, adultrank);
-        ga_entity_dereference_by_rank(pop, adultrank);
-        }
-      }
+      gaul_adapt_threaded(pop, pool, pop->orig_size, pop->size, TRUE);
     }
 
   return;
@@ -1835,7 +2471,7 @@ printf("DEBUG: Thread %d finished.  num_threads=%d eval_num=%d/%d\n", thread_num
 		as required.
   parameters:	population *pop
   return:	none
-  last updated:	25 Apr 2005
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 static void gaul_survival(population *pop)
@@ -1846,15 +2482,23 @@ static void gaul_survival(population *pop)
   boolean	*dominated;	/* Whether each entity is Pareto dominated. */
   int		paretocount;	/* Size of Pareto set. */
   boolean	dominance;	/* Used in determining dominance. */
+  boolean	*cull;		/* Whether each entity should die. */
+  int		survivors;	/* Population size after culling. */
 
   plog(LOG_VERBOSE, "*** Survival of the fittest ***");
 
+/*
+ * Offer every entity to the Pareto archive before any are culled.
+ */
+  if (pop->archive)
+    ga_population_archive_update(pop);
+
   if (pop->elitism == GA_ELITISM_PARENTS_SURVIVE)
     {
 /*
- * Sort all population members by fitness.
+ * Sort the fittest population members, which are those that survive.
  */
-    sort_population(pop);
+    sort_population_best(pop, pop->stable_size+1);
 
 /*
  * Ensure that any very bad solutions are not retained.
@@ -1869,16 +2513,17 @@ static void gaul_survival(population *pop)
     }
   else if (pop->elitism == GA_ELITISM_PARENTS_DIE || pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES)
     {
-    while (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
+    if (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
       {
-      pop->orig_size--;
-      ga_entity_dereference_by_rank(pop, pop->orig_size);
+      ga_entity_dereference_by_rank_range(pop,
+                  pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES, pop->orig_size);
+      pop->orig_size = (pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES);
       }
 
 /*
- * Sort all population members by fitness.
+ * Sort the fittest population members, which are those that survive.
  */
-    sort_population(pop);
+    sort_population_best(pop, pop->stable_size+1);
 
 /*
  * Ensure that any very bad solutions are not retained.
@@ -1895,19 +2540,12 @@ static void gaul_survival(population *pop)
     {
     plog(LOG_VERBOSE, "*** Fitness Re-evaluations ***");
 
-#pragma omp parallel for \
-   shared(pop) private(i) \
-   schedule(static)
-    for (i=pop->orig_size; i<pop->size; i++)
-      {
-      if ( pop->evaluate(pop, pop->entity_iarray[i]) == FALSE )
-        pop->entity_iarray[i]->fitness = GA_MIN_FITNESS;
-      }
+    gaul_population_evaluate_ranks(pop, pop->orig_size, pop->size, FALSE);
 
 /*
- * Sort all population members by fitness.
+ * Sort the fittest population members, which are those that survive.
  */
-    sort_population(pop);
+    sort_population_best(pop, pop->stable_size+1);
 
 /*
  * Ensure that any very bad solutions are not retained.
@@ -1955,20 +2593,25 @@ static void gaul_survival(population *pop)
 /* Allow all parents in the best set to survive.  Make up to
  * population's stable size with the fittest of the remainder.
  */
-    k=pop->size;
-    while (k > 0 && pop->size > pop->stable_size)
+    if ( !(cull = s_malloc(sizeof(boolean)*pop->size)) )
+      die("Unable to allocate memory");
+
+    survivors = pop->size;
+    for (k=pop->size-1; k>=0; k--)
       {
-      k--;
       save_entity = FALSE;
       for (i=0; i<pop->fitness_dimensions; i++)
         {
         if (set[i] == k)
           save_entity = TRUE;
         }
-      if ( save_entity == FALSE )
-        ga_entity_dereference_by_rank(pop, k);
+      cull[k] = save_entity == FALSE && survivors > pop->stable_size;
+      if ( cull[k] ) survivors--;
       }
 
+    ga_entity_dereference_by_mask(pop, cull);
+
+    s_free(cull);
     s_free(set);
     }
   else if (pop->elitism == GA_ELITISM_PARETO_SET_SURVIVE)
@@ -1978,7 +2621,7 @@ static void gaul_survival(population *pop)
  * to the fitness vector.  An entity is dominated if at least one other
  * entity is better in all objectives.
  */
-    if ( !(dominated = s_malloc(sizeof(int)*pop->size)) )
+    if ( !(dominated = s_malloc(sizeof(boolean)*pop->size)) )
       die("Unable to allocate memory");
 
 /*
@@ -2043,17 +2686,53 @@ static void gaul_survival(population *pop)
 /*
  * Allow all entities in the Pareto set to survive.  Make up to
  * population's stable size with the fittest of the remainder.
+ * The dominated flags are trimmed to form the cull mask.
  */
-    i = pop->size;
-    while ( i > 0 && pop->size > pop->stable_size )
+    survivors = pop->size;
+    for (i=pop->size-1; i>=0; i--)
       {
-      i--;
-      if ( dominated[i] )
-        ga_entity_dereference_by_rank(pop, i);
+      if ( dominated[i] && survivors > pop->stable_size )
+        survivors--;
+      else
+        dominated[i] = FALSE;
       }
 
+    ga_entity_dereference_by_mask(pop, dominated);
+
     s_free(dominated);
     }
+  else if ( pop->elitism == GA_ELITISM_PARETO_FRONTS_SURVIVE ||
+            pop->elitism == GA_ELITISM_HYPERVOLUME_SURVIVE )
+    {
+/*
+ * Sort all population members by fitness, so that the survivors
+ * remain in fitness order.
+ */
+    sort_population(pop);
+
+/*
+ * Ensure that any very bad solutions are not retained.
+ */
+    ga_genocide_by_fitness(pop, GA_MIN_FITNESS);
+
+/*
+ * NSGA-II style survival.  Whole Pareto fronts survive, in turn,
+ * and the least crowded members of the last front fill any
+ * remaining places.  Alternatively, SMS-EMOA style, the members of
+ * the last front which contribute least to its hypervolume die.
+ */
+    if (pop->size > pop->stable_size)
+      {
+      if ( !(cull = s_malloc(sizeof(boolean)*pop->size)) )
+        die("Unable to allocate memory");
+
+      gaul_rank_pareto_survivors(pop, pop->stable_size, cull,
+                                 pop->elitism == GA_ELITISM_HYPERVOLUME_SURVIVE);
+      ga_entity_dereference_by_mask(pop, cull);
+
+      s_free(cull);
+      }
+    }
 
   return;
   }
@@ -2084,10 +2763,11 @@ static void gaul_survival_mp(population *pop)
  */
   if (pop->elitism == GA_ELITISM_PARENTS_DIE || pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES)
     {
-    while (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
+    if (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
       {
-      pop->orig_size--;
-      ga_entity_dereference_by_rank(pop, pop->orig_size);
+      ga_entity_dereference_by_rank_range(pop,
+                  pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES, pop->orig_size);
+      pop->orig_size = (pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES);
       }
     }
   else if (pop->elitism == GA_ELITISM_RESCORE_PARENTS)
@@ -2105,9 +2785,9 @@ static void gaul_survival_mp(population *pop)
     }
 
 /*
- * Sort all population members by fitness.
+ * Sort the fittest population members, which are those that survive.
  */
-  sort_population(pop);
+  sort_population_best(pop, pop->stable_size+1);
 
 /*
  * Least fit population members die to restore the
@@ -2144,10 +2824,11 @@ static void gaul_survival_mpi(population *pop)
  */
   if (pop->elitism == GA_ELITISM_PARENTS_DIE || pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES)
     {
-    while (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
+    if (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
       {
-      pop->orig_size--;
-      ga_entity_dereference_by_rank(pop, pop->orig_size);
+      ga_entity_dereference_by_rank_range(pop,
+                  pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES, pop->orig_size);
+      pop->orig_size = (pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES);
       }
     }
   else if (pop->elitism == GA_ELITISM_RESCORE_PARENTS)
@@ -2166,9 +2847,9 @@ static void gaul_survival_mpi(population *pop)
     }
 
 /*
- * Sort all population members by fitness.
+ * Sort the fittest population members, which are those that survive.
  */
-  sort_population(pop);
+  sort_population_best(pop, pop->stable_size+1);
 
 /*
  * Least fit population members die to restore the
@@ -2211,10 +2892,11 @@ static void gaul_survival_forked(population *pop,
  */
   if (pop->elitism == GA_ELITISM_PARENTS_DIE || pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES)
     {
-    while (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
+    if (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
       {
-      pop->orig_size--;
-      ga_entity_dereference_by_rank(pop, pop->orig_size);
+      ga_entity_dereference_by_rank_range(pop,
+                  pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES, pop->orig_size);
+      pop->orig_size = (pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES);
       }
     }
   else if (pop->elitism == GA_ELITISM_RESCORE_PARENTS)
@@ -2307,9 +2989,9 @@ static void gaul_survival_forked(population *pop,
     }
 
 /*
- * Sort all population members by fitness.
+ * Sort the fittest population members, which are those that survive.
  */
-  sort_population(pop);
+  sort_population_best(pop, pop->stable_size+1);
 
 /*
  * Least fit population members die to restore the
@@ -2324,25 +3006,21 @@ static void gaul_survival_forked(population *pop,
 
 
 /**********************************************************************
-  gaul_survival_threaded()
+  gaul_survival_preforked()
   synopsis:	Survival of the fittest.
 		Enforce elitism, reduce
 		population back to its stable size and rerank entities,
 		as required.
-		This is the threaded processing version.
+		This is the pre-forked worker process version.
   parameters:	population *pop
+		forkpool_t *pool
   return:	none
-  last updated:	18 Mar 2003
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-#ifdef HAVE_PTHREADS
-static void gaul_survival_threaded(population *pop,
-			const int max_threads,
-			threaddata_t *threaddata)
+#ifndef W32_CRIPPLED
+static void gaul_survival_preforked(population *pop, forkpool_t *pool)
   {
-  int		thread_num;		/* Index of current thread. */
-  int		num_threads;		/* Number of threads currently in use. */
-  int		eval_num;		/* Index of current entity. */
 
   plog(LOG_VERBOSE, "*** Survival of the fittest ***");
 
@@ -2351,10 +3029,11 @@ static void gaul_survival_threaded(population *pop,
  */
   if (pop->elitism == GA_ELITISM_PARENTS_DIE || pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES)
     {
-    while (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
+    if (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
       {
-      pop->orig_size--;
-      ga_entity_dereference_by_rank(pop, pop->orig_size);
+      ga_entity_dereference_by_rank_range(pop,
+                  pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES, pop->orig_size);
+      pop->orig_size = (pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES);
       }
     }
   else if (pop->elitism == GA_ELITISM_RESCORE_PARENTS)
@@ -2362,82 +3041,70 @@ static void gaul_survival_threaded(population *pop,
 
     plog(LOG_VERBOSE, "*** Fitness Re-evaluations ***");
 
+    gaul_forkpool_evaluate(pool, pop, 0, pop->orig_size, FALSE);
+    }
+
 /*
- * A thread is created for each fitness evaluation upto
- * a maximum of max_threads at which point we wait for
- * results before continuing.
- *
- * Skip evaluations for entities that have been previously evaluated.
+ * Sort the fittest population members, which are those that survive.
  */
-    thread_num = 0;
-    eval_num = 0;
-
-    while (thread_num < max_threads && eval_num < pop->orig_size)
-      {
-      threaddata[thread_num].thread_num = thread_num;
-      threaddata[thread_num].eval_num = eval_num;
-
-      if (pthread_create(&(threaddata[thread_num].pid), NULL, _evaluation_thread, (void *)&(threaddata[thread_num])) < 0)
-        {       /* Error in thread creation. */
-        dief("Error %d in pthread_create. (%s)", errno, errno==EAGAIN?"EAGAIN":errno==ENOMEM?"ENOMEM":"unknown");
-        }
-
-      thread_num++;
-      eval_num++;
-      }
-
-    num_threads = thread_num;
+  sort_population_best(pop, pop->stable_size+1);
 
-  /* Wait for a thread to finish and, if needed, create another. */
-  /* Also, find which entity this thread was evaluating. */
-    thread_num=0;
-    while (num_threads > 0)
-      {
-      while (threaddata[thread_num].thread_num >= 0)
-        {
-        thread_num++;
-        if (thread_num==max_threads)
-          {
-          thread_num=0;
-/* FIXME: Insert short sleep here? */
-          }
-        }
+/*
+ * Least fit population members die to restore the
+ * population size to its stable size.
+ */
+  ga_genocide(pop, pop->stable_size);
+  ga_genocide_by_fitness(pop, GA_MIN_FITNESS);
 
-#if GA_DEBUG>2
-printf("DEBUG: Thread %d finished.  num_threads=%d eval_num=%d/%d\n", thread_num, num_threads, eval_num, pop->size);
+  return;
+  }
 #endif
 
-      if ( pthread_join(threaddata[thread_num].pid, NULL) < 0 )
-        {
-        dief("Error %d in pthread_join. (%s)", errno, errno==ESRCH?"ESRCH":errno==EINVAL?"EINVAL":errno==EDEADLK?"EDEADLK":"unknown");
-        }
 
-      if (eval_num < pop->orig_size)
-        {       /* New thread. */
-        threaddata[thread_num].thread_num = thread_num;
-        threaddata[thread_num].eval_num = eval_num;
+/**********************************************************************
+  gaul_survival_threaded()
+  synopsis:	Survival of the fittest.
+		Enforce elitism, reduce
+		population back to its stable size and rerank entities,
+		as required.
+		This is the threaded processing version.
+  parameters:	population *pop
+		threadpool_t *pool
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
 
-        if (pthread_create(&(threaddata[thread_num].pid), NULL, _evaluation_thread, (void *)&(threaddata[thread_num])) < 0)
-          {       /* Error in thread creation. */
-          dief("Error %d in pthread_create. (%s)", errno, errno==EAGAIN?"EAGAIN":errno==ENOMEM?"ENOMEM":"unknown");
-          }
+#ifdef HAVE_PTHREADS
+static void gaul_survival_threaded(population *pop,
+			threadpool_t *pool)
+  {
 
-        eval_num++;
-        }
-      else
-        {
-        threaddata[thread_num].thread_num = 0;
-        threaddata[thread_num].eval_num = -1;
-        num_threads--;
-        }
+  plog(LOG_VERBOSE, "*** Survival of the fittest ***");
+
+/*
+ * Need to kill parents, or rescore parents?
+ */
+  if (pop->elitism == GA_ELITISM_PARENTS_DIE || pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES)
+    {
+    if (pop->orig_size>(pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES))
+      {
+      ga_entity_dereference_by_rank_range(pop,
+                  pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES, pop->orig_size);
+      pop->orig_size = (pop->elitism == GA_ELITISM_ONE_PARENT_SURVIVES);
       }
+    }
+  else if (pop->elitism == GA_ELITISM_RESCORE_PARENTS)
+    {
+
+    plog(LOG_VERBOSE, "*** Fitness Re-evaluations ***");
 
+    gaul_threadpool_run(pool, pop, _evaluation_task, NULL, 0, pop->orig_size);
     }
 
 /*
- * Sort all population members by fitness.
+ * Sort the fittest population members, which are those that survive.
  */
-  sort_population(pop);
+  sort_population_best(pop, pop->stable_size+1);
 
 /*
  * Least fit population members die to restore the
@@ -2697,10 +3364,150 @@ GAULFUNC int ga_evolution_forked(	population		*pop,
   return generation;
   }
 #else
-GAULFUNC int ga_evolution_forked(	population		*pop,
+GAULFUNC int ga_evolution_forked(	population		*pop,
+				const int		max_generations )
+  {
+  die("Sorry, the ga_evolution_forked() function isn't available for Windows.");
+  return 0;
+  }
+#endif
+
+
+/**********************************************************************
+  ga_evolution_preforked()
+  synopsis:	Main genetic algorithm routine.  Performs GA-based
+		optimisation on the given population.  This is a
+		generation-based GA.  ga_genesis(), or equivalent,
+		must be called prior to this function.
+
+		This function is like ga_evolution_forked(), except
+		that the worker processes are forked just once, at
+		the start of the run, rather than once per fitness
+		evaluation.  Chromosomes are passed to the workers
+		through shared memory, so the population's
+		chromosome_to_bytes and chromosome_from_bytes
+		callbacks must be defined.  Each worker evaluates
+		against a snapshot of the population taken when the
+		run started, so the evaluation callback must not
+		depend on population state which changes during
+		the run.  This is ideal for evaluation callbacks
+		which are not thread-safe.
+
+  parameters:
+  return:	Number of generations performed.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+#ifndef W32_CRIPPLED
+GAULFUNC int ga_evolution_preforked(	population		*pop,
+				const int		max_generations )
+  {
+  int		generation=0;		/* Current generation number. */
+  forkpool_t	*pool;			/* Persistent worker processes. */
+  int		max_processes=0;	/* Number of processes to fork. */
+  char		*max_proc_str;		/* Value of enviroment variable. */
+
+/* Checks. */
+  if (!pop) die("NULL pointer to population structure passed.");
+  if (!pop->evaluate) die("Population's evaluation callback is undefined.");
+  if (!pop->select_one) die("Population's asexual selection callback is undefined.");
+  if (!pop->select_two) die("Population's sexual selection callback is undefined.");
+  if (!pop->mutate) die("Population's mutation callback is undefined.");
+  if (!pop->crossover) die("Population's crossover callback is undefined.");
+  if (!pop->rank) die("Population's ranking callback is undefined.");
+  if (pop->scheme != GA_SCHEME_DARWIN && !pop->adapt) die("Population's adaption callback is undefined.");
+  if (!pop->chromosome_to_bytes) die("Population's chromosome_to_bytes callback is undefined.");
+  if (!pop->chromosome_from_bytes) die("Population's chromosome_from_bytes callback is undefined.");
+
+/*
+ * Look at environment to find number of processes to fork.
+ */
+  max_proc_str = getenv(GA_NUM_PROCESSES_ENVVAR_STRING);
+  if (max_proc_str) max_processes = atoi(max_proc_str);
+  if (max_processes == 0) max_processes = GA_DEFAULT_NUM_PROCESSES;
+
+  plog(LOG_VERBOSE, "The evolution has begun!  %d worker processes will be fork'ed", max_processes);
+
+  pop->generation = 0;
+
+/*
+ * Fork the worker processes.  The population must be
+ * populated first, so that the shared slots can be sized.
+ */
+  if (pop->size < pop->stable_size)
+    gaul_population_fill(pop, pop->stable_size - pop->size);
+
+  pool = gaul_forkpool_new(pop, max_processes);
+
+/*
+ * Score and sort the initial population members.
+ */
+  gaul_forkpool_evaluate(pool, pop, 0, pop->size, TRUE);
+  sort_population(pop);
+  ga_genocide_by_fitness(pop, GA_MIN_FITNESS);
+
+  plog( LOG_VERBOSE,
+        "Prior to the first generation, population has fitness scores between %f and %f",
+        pop->entity_iarray[0]->fitness,
+        pop->entity_iarray[pop->size-1]->fitness );
+
+/*
+ * Do all the generations:
+ *
+ * Stop when (a) max_generations reached, or
+ *           (b) "pop->generation_hook" returns FALSE.
+ */
+  while ( (pop->generation_hook?pop->generation_hook(generation, pop):TRUE) &&
+           generation<max_generations )
+    {
+    generation++;
+    pop->generation = generation;
+    pop->orig_size = pop->size;
+
+    plog(LOG_DEBUG,
+              "Population size is %d at start of generation %d",
+              pop->orig_size, generation );
+
+/*
+ * Crossover step.
+ */
+    gaul_crossover(pop);
+
+/*
+ * Mutation step.
+ */
+    gaul_mutation(pop);
+
+/*
+ * Score all child entities from this generation.
+ */
+    gaul_adapt_and_evaluate_preforked(pop, pool);
+
+/*
+ * Apply survival pressure.
+ */
+    gaul_survival_preforked(pop, pool);
+
+    plog(LOG_VERBOSE,
+          "After generation %d, population has fitness scores between %f and %f",
+          generation,
+          pop->entity_iarray[0]->fitness,
+          pop->entity_iarray[pop->size-1]->fitness );
+
+    }	/* Main generation loop. */
+
+/*
+ * Shut down the worker processes.
+ */
+  gaul_forkpool_free(pool);
+
+  return generation;
+  }
+#else
+GAULFUNC int ga_evolution_preforked(	population		*pop,
 				const int		max_generations )
   {
-  die("Sorry, the ga_evolution_forked() function isn't available for Windows.");
+  die("Sorry, the ga_evolution_preforked() function isn't available for Windows.");
   return 0;
   }
 #endif
@@ -2719,9 +3526,13 @@ GAULFUNC int ga_evolution_forked(	population		*pop,
 		machines or multipipelined processors (e.g. the new
 		Intel Xeons).
 
+		Adaptation, for the Baldwinian and Lamarckian schemes,
+		is also performed in threads, so the adaptation
+		callback must be thread-safe too.
+
   parameters:
   return:	Number of generations performed.
-  last updated:	17 Feb 2005
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 #ifdef HAVE_PTHREADS
@@ -2729,10 +3540,8 @@ GAULFUNC int ga_evolution_threaded(	population		*pop,
 				const int		max_generations )
   {
   int		generation=0;		/* Current generation number. */
-  int		max_threads=0;		/* Maximum number of threads to use at one time. */
-  char		*max_thread_str;	/* Value of enviroment variable. */
-  threaddata_t	*threaddata;		/* Used for passing data to threads. */
-  int		i;			/* Loop over threaddata elements. */
+  int		max_threads;		/* Number of worker threads to use. */
+  threadpool_t	*pool;			/* Persistent worker threads. */
 
 /* Checks. */
   if (!pop) die("NULL pointer to population structure passed.");
@@ -2747,20 +3556,14 @@ GAULFUNC int ga_evolution_threaded(	population		*pop,
 /*
  * Look at environment to find number of threads to use.
  */
-  max_thread_str = getenv(GA_NUM_THREADS_ENVVAR_STRING);
-  if (max_thread_str) max_threads = atoi(max_thread_str);
-  if (max_threads == 0) max_threads = GA_DEFAULT_NUM_THREADS;
+  max_threads = gaul_get_num_threads();
 
-  plog(LOG_VERBOSE, "The evolution has begun!  Upto %d threads will be created", max_threads);
+  plog(LOG_VERBOSE, "The evolution has begun!  %d worker threads will be created", max_threads);
 
 /*
- * Allocate memory required for handling the threads.
+ * Start the worker threads.  These persist for the whole run.
  */
-  if ( !(threaddata = s_malloc(sizeof(threaddata_t)*max_threads)) )
-    die("Unable to allocate memory");
-
-  for (i=0; i<max_threads; i++)
-    threaddata[i].pop = pop;
+  pool = gaul_threadpool_new(max_threads);
 
   pop->generation = 0;
 
@@ -2769,7 +3572,7 @@ GAULFUNC int ga_evolution_threaded(	population		*pop,
  */
   if (pop->size < pop->stable_size)
     gaul_population_fill(pop, pop->stable_size - pop->size);
-  gaul_ensure_evaluations_threaded(pop, max_threads, threaddata);
+  gaul_ensure_evaluations_threaded(pop, pool);
   sort_population(pop);
   ga_genocide_by_fitness(pop, GA_MIN_FITNESS);
 
@@ -2796,24 +3599,19 @@ GAULFUNC int ga_evolution_threaded(	population		*pop,
               pop->orig_size, generation );
 
 /*
- * Crossover step.
- */
-    gaul_crossover(pop);
-
-/*
- * Mutation step.
+ * Crossover and mutation steps.
  */
-    gaul_mutation(pop);
+    gaul_reproduction_threaded(pop, pool);
 
 /*
  * Score all child entities from this generation.
  */
-    gaul_adapt_and_evaluate_threaded(pop, max_threads, threaddata);
+    gaul_adapt_and_evaluate_threaded(pop, pool);
 
 /*
  * Apply survival pressure.
  */
-    gaul_survival_threaded(pop, max_threads, threaddata);
+    gaul_survival_threaded(pop, pool);
 
     plog(LOG_VERBOSE,
           "After generation %d, population has fitness scores between %f and %f",
@@ -2823,8 +3621,8 @@ GAULFUNC int ga_evolution_threaded(	population		*pop,
 
     }	/* Main generation loop. */
 
-/* Free memory used for storing thread information. */
-  s_free(threaddata);
+/* Stop the worker threads. */
+  gaul_threadpool_free(pool);
 
   return generation;
   }
@@ -3322,9 +4120,12 @@ GAULFUNC void ga_evolution_with_stats(	population		*pop,
 		This is a steady-state GA.
 		ga_genesis(), or equivalent, must be called prior to
 		this function.
+		With ga_replace_by_fitness(), the least fit entity
+		is found from a binary heap, and the population is
+		only sorted when ranks are required.
   parameters:
   return:
-  last updated:	17 Feb 2005
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_evolution_steady_state(	population		*pop,
@@ -3334,6 +4135,7 @@ GAULFUNC int ga_evolution_steady_state(	population		*pop,
   int		i;			/* Loop over members of population. */
   entity	*mother, *father;	/* Parent entities. */
   entity	*son, *daughter, *child;	/* Child entities. */
+  entity	*brood[2];		/* Crossover children, for evaluation. */
   entity	*adult;			/* Temporary copy for gene optimisation. */
   int		new_pop_size;		/* Population size prior to adaptation. */
 
@@ -3366,6 +4168,16 @@ GAULFUNC int ga_evolution_steady_state(	population		*pop,
         pop->entity_iarray[0]->fitness,
         pop->entity_iarray[pop->size-1]->fitness );
 
+/*
+ * Index the population for O(log n) replacement of the least fit entity.
+ * Established entities are only sorted when their ranks are required.
+ */
+  if ( pop->replace == ga_replace_by_fitness && pop->rank == ga_rank_fitness &&
+       ( pop->scheme == GA_SCHEME_DARWIN ||
+         pop->scheme == GA_SCHEME_BALDWIN_CHILDREN ||
+         pop->scheme == GA_SCHEME_LAMARCK_CHILDREN ) )
+    gaul_replace_heap_build(pop);
+
 /* Do all the iterations: */
   while ( (pop->generation_hook?pop->generation_hook(iteration, pop):TRUE) &&
            iteration<max_iterations )
@@ -3398,19 +4210,24 @@ GAULFUNC int ga_evolution_steady_state(	population		*pop,
       {
       plog(LOG_VERBOSE, "Crossover between %d (%d = %f) and %d (%d = %f)",
              ga_get_entity_id(pop, mother),
-             ga_get_entity_rank(pop, mother), mother->fitness,
+             gaul_entity_position(pop, mother), mother->fitness,
              ga_get_entity_id(pop, father),
-             ga_get_entity_rank(pop, father), father->fitness);
+             gaul_entity_position(pop, father), father->fitness);
 
       son = ga_get_free_entity(pop);
       daughter = ga_get_free_entity(pop);
       pop->crossover(pop, mother, father, daughter, son);
-      if ( pop->evaluate(pop, daughter) == FALSE )
+
+      brood[0] = daughter;
+      brood[1] = son;
+      ga_entity_evaluate_batch(pop, brood, 2);
+
+      if ( daughter->fitness == GA_MIN_FITNESS )
         {
         ga_entity_dereference(pop, daughter);
         daughter = NULL;
         }
-      if ( pop->evaluate(pop, son) == FALSE )
+      if ( son->fitness == GA_MIN_FITNESS )
         {
         ga_entity_dereference(pop, son);
         son = NULL;
@@ -3439,11 +4256,12 @@ GAULFUNC int ga_evolution_steady_state(	population		*pop,
       {
       plog(LOG_VERBOSE, "Mutation of %d (%d = %f)",
              ga_get_entity_id(pop, mother),
-             ga_get_entity_rank(pop, mother), mother->fitness );
+             gaul_entity_position(pop, mother), mother->fitness );
 
       child = ga_get_free_entity(pop);
       pop->mutate(pop, mother, child);
-      if ( pop->evaluate(pop, child) == FALSE )
+      ga_entity_evaluate_batch(pop, &child, 1);
+      if ( child->fitness == GA_MIN_FITNESS )
         {
         ga_entity_dereference(pop, child);
         child = NULL;
@@ -3482,7 +4300,7 @@ GAULFUNC int ga_evolution_steady_state(	population		*pop,
           {
           adult = pop->adapt(pop, pop->entity_iarray[i]);
           pop->entity_iarray[i]->fitness=adult->fitness;
-/* check. */ s_assert(ga_get_entity_rank(pop, adult) == new_pop_size);
+/* check. */ s_assert(gaul_entity_position(pop, adult) == new_pop_size);
           ga_entity_dereference_by_rank(pop, new_pop_size);
           }
         break;
@@ -3493,7 +4311,7 @@ GAULFUNC int ga_evolution_steady_state(	population		*pop,
           {
           adult = pop->adapt(pop, pop->entity_iarray[i]);
           pop->entity_iarray[i]->fitness=adult->fitness;
-/* check. */ s_assert(ga_get_entity_rank(pop, adult) == new_pop_size);
+/* check. */ s_assert(gaul_entity_position(pop, adult) == new_pop_size);
           ga_entity_dereference_by_rank(pop, new_pop_size);
           }
         break;
@@ -3532,16 +4350,397 @@ GAULFUNC int ga_evolution_steady_state(	population		*pop,
  */
     plog(LOG_VERBOSE, "*** Analysis ***");
 
+/* Avoid sorting for the sake of a log message, since that could alter the run. */
+    if (pop->replace_heap)
+      {
+      plog(LOG_VERBOSE,
+            "After iteration %d, least fit entity has fitness score %f",
+            iteration,
+            pop->replace_heap[0]->fitness );
+      }
+    else
+      {
+      plog(LOG_VERBOSE,
+            "After iteration %d, population has fitness scores between %f and %f",
+            iteration,
+            pop->entity_iarray[0]->fitness,
+            pop->entity_iarray[pop->size-1]->fitness );
+      }
+
+    }	/* Iteration loop. */
+
+/* Leave the population sorted, as usual. */
+  sort_population_on_demand(pop);
+  gaul_replace_heap_free(pop);
+
+  return (iteration<max_iterations);
+  }
+
+
+/**********************************************************************
+  ga_evolution_steady_state_async()
+  synopsis:	Main genetic algorithm routine.  Performs GA-based
+		optimisation on the given population.
+		This is a steady-state GA.
+		ga_genesis(), or equivalent, must be called prior to
+		this function.
+
+		This function is like ga_evolution_steady_state(),
+		except that offspring are evaluated by a set of worker
+		threads while breeding continues.  Each offspring is
+		passed to the population's replacement callback as
+		soon as its evaluation finishes, so there is no
+		barrier between iterations.  At most max_in_flight
+		offspring may be awaiting, or undergoing, evaluation
+		at any time.  If max_in_flight is less than 2, twice
+		the number of worker threads is used.
+
+		Offspring awaiting evaluation are held in the
+		population beyond pop->orig_size, which is where
+		the selection and replacement callbacks expect them.
+		Only the evaluation callback is called by the worker
+		threads, so it must be thread-safe.  All other
+		callbacks, and all changes to the population, are
+		made by the calling thread, which passes evaluated
+		offspring to the replacement callback before each
+		selection.  The worker threads and the calling
+		thread share nothing but the queues of offspring,
+		so the lock is held only while offspring are
+		queued or collected.  Since the order in which
+		evaluations complete varies, results are not
+		reproducible.  Only GA_SCHEME_DARWIN is supported.
+  parameters:	population *pop
+		const int max_iterations
+		const int max_in_flight
+  return:	TRUE if the generation hook terminated evolution.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+#ifdef HAVE_PTHREADS
+
+typedef struct asyncdata_s
+  {
+  population		*pop;		/* Population being evolved. */
+  pthread_mutex_t	lock;		/* Protects everything below. */
+  pthread_cond_t	work_cond;	/* Signalled when offspring are queued. */
+  pthread_cond_t	done_cond;	/* Signalled when an evaluation completes. */
+  entity		**queue;	/* Ring of offspring awaiting evaluation. */
+  int			queue_head;	/* Index of first queued offspring. */
+  int			queue_len;	/* Number of queued offspring. */
+  entity		**done;		/* Evaluated offspring awaiting replacement. */
+  int			num_done;	/* Number of evaluated offspring. */
+  int			in_flight;	/* Offspring queued, being evaluated or evaluated. */
+  int			max_in_flight;	/* Bound on in_flight. */
+  boolean		shutdown;	/* Whether workers should exit once the queue is empty. */
+  } asyncdata_t;
+
+/*
+ * This is the worker thread code used by ga_evolution_steady_state_async().
+ * The population is never modified here.
+ */
+static void *_async_evaluation_thread( void *data )
+  {
+  asyncdata_t	*async = (asyncdata_t *)data;
+  population	*pop = async->pop;
+  entity	*child;		/* Offspring to evaluate. */
+
+  pthread_mutex_lock(&(async->lock));
+
+  while (TRUE)
+    {
+    while (!async->shutdown && async->queue_len == 0)
+      pthread_cond_wait(&(async->work_cond), &(async->lock));
+
+    if (async->queue_len == 0) break;	/* Shut down. */
+
+    child = async->queue[async->queue_head];
+    async->queue_head = (async->queue_head+1)%async->max_in_flight;
+    async->queue_len--;
+
+    pthread_mutex_unlock(&(async->lock));
+
+    if ( pop->evaluate(pop, child) == FALSE )
+      child->fitness = GA_MIN_FITNESS;
+
+    pthread_mutex_lock(&(async->lock));
+
+    async->done[async->num_done++] = child;
+    pthread_cond_signal(&(async->done_cond));
+    }
+
+  pthread_mutex_unlock(&(async->lock));
+
+  return NULL;
+  }
+
+/*
+ * Queue offspring for evaluation.  The caller must already have
+ * ensured that there is space.
+ */
+static void gaul_async_submit(asyncdata_t *async, entity *child)
+  {
+
+  pthread_mutex_lock(&(async->lock));
+
+  async->queue[(async->queue_head+async->queue_len)%async->max_in_flight] = child;
+  async->queue_len++;
+  async->in_flight++;
+
+  pthread_cond_signal(&(async->work_cond));
+  pthread_mutex_unlock(&(async->lock));
+
+  return;
+  }
+
+/*
+ * Wait until there is space for the given number of extra offspring,
+ * then pass all evaluated offspring to the replacement callback.
+ * reaped is work space for max_in_flight entities.
+ */
+static void gaul_async_reap(asyncdata_t *async, const int num, entity **reaped)
+  {
+  population	*pop = async->pop;
+  entity	*child;		/* Evaluated offspring. */
+  int		num_reaped;	/* Number of evaluated offspring. */
+  int		i;		/* Loop over evaluated offspring. */
+
+  pthread_mutex_lock(&(async->lock));
+
+  while (async->in_flight-async->num_done+num > async->max_in_flight)
+    pthread_cond_wait(&(async->done_cond), &(async->lock));
+
+  num_reaped = async->num_done;
+  memcpy(reaped, async->done, sizeof(entity *)*num_reaped);
+  async->num_done = 0;
+  async->in_flight -= num_reaped;
+
+  pthread_mutex_unlock(&(async->lock));
+
+  for (i=0; i<num_reaped; i++)
+    {
+    child = reaped[i];
+
+    if (child->fitness == GA_MIN_FITNESS)
+      {
+      ga_entity_dereference(pop, child);
+      }
+    else
+      {
+/*
+ * Move the child to the front of the offspring so that any entities
+ * shifted down by the replacement are residents or the child itself,
+ * never offspring which are still in flight.
+ */
+      gaul_entity_swap_rank(pop, ga_get_entity_rank(pop, child), pop->orig_size);
+
+      pop->replace(pop, child);
+      }
+    }
+
+  return;
+  }
+
+GAULFUNC int ga_evolution_steady_state_async(	population		*pop,
+				const int		max_iterations,
+				const int		max_in_flight )
+  {
+  int		iteration=0;		/* Current iteration count. */
+  entity	*mother, *father;	/* Parent entities. */
+  entity	*son, *daughter, *child;	/* Child entities. */
+  int		max_threads;		/* Number of worker threads to use. */
+  pthread_t	*tid;			/* Worker thread ids. */
+  threadpool_t	*pool;			/* Threads for initial evaluations. */
+  asyncdata_t	async;			/* State shared with worker threads. */
+  entity	**reaped;		/* Evaluated offspring. */
+  int		i;			/* Loop over threads. */
+  int		err;			/* Return value from pthread functions. */
+
+/* Checks. */
+  if (!pop) die("NULL pointer to population structure passed.");
+  if (!pop->evaluate) die("Population's evaluation callback is undefined.");
+  if (!pop->select_one) die("Population's asexual selection callback is undefined.");
+  if (!pop->select_two) die("Population's sexual selection callback is undefined.");
+  if (!pop->mutate) die("Population's mutation callback is undefined.");
+  if (!pop->crossover) die("Population's crossover callback is undefined.");
+  if (!pop->replace) die("Population's replacement callback is undefined.");
+  if (!pop->rank) die("Population's ranking callback is undefined.");
+  if (pop->scheme != GA_SCHEME_DARWIN) die("Only GA_SCHEME_DARWIN is supported by ga_evolution_steady_state_async().");
+
+  max_threads = gaul_get_num_threads();
+
+  plog(LOG_VERBOSE, "The evolution has begun!  %d worker threads will be created", max_threads);
+
+  pop->generation = 0;
+
+/*
+ * Score and sort the initial population members.
+ */
+  if (pop->size < pop->stable_size)
+    gaul_population_fill(pop, pop->stable_size - pop->size);
+
+  pool = gaul_threadpool_new(max_threads);
+  gaul_ensure_evaluations_threaded(pop, pool);
+  gaul_threadpool_free(pool);
+
+  sort_population(pop);
+  ga_genocide_by_fitness(pop, GA_MIN_FITNESS);
+
+  plog( LOG_VERBOSE,
+        "Prior to the first iteration, population has fitness scores between %f and %f",
+        pop->entity_iarray[0]->fitness,
+        pop->entity_iarray[pop->size-1]->fitness );
+
+/*
+ * Entities beyond orig_size are offspring.  This boundary remains
+ * fixed, because the replacement callback kills one entity for each
+ * offspring it is passed.
+ */
+  pop->orig_size = pop->size;
+
+/*
+ * Start the worker threads.
+ */
+  async.pop = pop;
+  async.queue_head = 0;
+  async.queue_len = 0;
+  async.num_done = 0;
+  async.in_flight = 0;
+  async.max_in_flight = max_in_flight<2?2*max_threads:max_in_flight;
+  async.shutdown = FALSE;
+
+  if ( !(async.queue = s_malloc(sizeof(entity *)*async.max_in_flight)) )
+    die("Unable to allocate memory");
+  if ( !(async.done = s_malloc(sizeof(entity *)*async.max_in_flight)) )
+    die("Unable to allocate memory");
+  if ( !(reaped = s_malloc(sizeof(entity *)*async.max_in_flight)) )
+    die("Unable to allocate memory");
+  if ( !(tid = s_malloc(sizeof(pthread_t)*max_threads)) )
+    die("Unable to allocate memory");
+
+  pthread_mutex_init(&(async.lock), NULL);
+  pthread_cond_init(&(async.work_cond), NULL);
+  pthread_cond_init(&(async.done_cond), NULL);
+
+  for (i=0; i<max_threads; i++)
+    {
+    if ( (err = pthread_create(&(tid[i]), NULL, _async_evaluation_thread, (void *)&async)) != 0 )
+      {       /* Error in thread creation. */
+      dief("Error %d in pthread_create. (%s)", err, err==EAGAIN?"EAGAIN":err==ENOMEM?"ENOMEM":"unknown");
+      }
+    }
+
+/* Do all the iterations: */
+  while ( (pop->generation_hook?pop->generation_hook(iteration, pop):TRUE) &&
+           iteration<max_iterations )
+    {
+    iteration++;
+
+    plog(LOG_DEBUG,
+              "Population size is %d at start of iteration %d",
+              pop->orig_size, iteration );
+
+/*
+ * Mating.
+ */
+    gaul_async_reap(&async, 2, reaped);
+
+    pop->select_state = 0;
+
+    pop->select_two(pop, &mother, &father);
+
+    if (mother && father)
+      {
+      plog(LOG_VERBOSE, "Crossover between %d (%d = %f) and %d (%d = %f)",
+             ga_get_entity_id(pop, mother),
+             ga_get_entity_rank(pop, mother), mother->fitness,
+             ga_get_entity_id(pop, father),
+             ga_get_entity_rank(pop, father), father->fitness);
+
+      son = ga_get_free_entity(pop);
+      daughter = ga_get_free_entity(pop);
+      pop->crossover(pop, mother, father, daughter, son);
+
+      gaul_async_submit(&async, daughter);
+      gaul_async_submit(&async, son);
+      }
+    else
+      {
+      plog( LOG_VERBOSE, "Crossover not performed." );
+      }
+
+/*
+ * Mutation.
+ */
+    gaul_async_reap(&async, 1, reaped);
+
+    pop->select_state = 0;
+
+    pop->select_one(pop, &mother);
+
+    if (mother)
+      {
+      plog(LOG_VERBOSE, "Mutation of %d (%d = %f)",
+             ga_get_entity_id(pop, mother),
+             ga_get_entity_rank(pop, mother), mother->fitness );
+
+      child = ga_get_free_entity(pop);
+      pop->mutate(pop, mother, child);
+
+      gaul_async_submit(&async, child);
+      }
+    else
+      {
+      plog( LOG_VERBOSE, "Mutation not performed." );
+      }
+
     plog(LOG_VERBOSE,
           "After iteration %d, population has fitness scores between %f and %f",
           iteration,
           pop->entity_iarray[0]->fitness,
-          pop->entity_iarray[pop->size-1]->fitness );
+          pop->entity_iarray[pop->orig_size-1]->fitness );
 
     }	/* Iteration loop. */
 
+/*
+ * Wait for outstanding evaluations, then stop the worker threads.
+ */
+  gaul_async_reap(&async, async.max_in_flight, reaped);
+
+  pthread_mutex_lock(&(async.lock));
+  async.shutdown = TRUE;
+  pthread_cond_broadcast(&(async.work_cond));
+  pthread_mutex_unlock(&(async.lock));
+
+  for (i=0; i<max_threads; i++)
+    {
+    if ( (err = pthread_join(tid[i], NULL)) != 0 )
+      {
+      dief("Error %d in pthread_join. (%s)", err, err==ESRCH?"ESRCH":err==EINVAL?"EINVAL":err==EDEADLK?"EDEADLK":"unknown");
+      }
+    }
+
+  pthread_cond_destroy(&(async.done_cond));
+  pthread_cond_destroy(&(async.work_cond));
+  pthread_mutex_destroy(&(async.lock));
+
+  s_free(tid);
+  s_free(reaped);
+  s_free(async.done);
+  s_free(async.queue);
+
   return (iteration<max_iterations);
   }
+#else
+GAULFUNC int ga_evolution_steady_state_async(	population		*pop,
+				const int		max_iterations,
+				const int		max_in_flight )
+  {
+
+  die("Support for ga_evolution_steady_state_async() not compiled.");
+
+  return 0;
+  }
+#endif /* HAVE_PTHREADS */
 
 
 /**********************************************************************
@@ -4803,10 +6002,8 @@ GAULFUNC int ga_evolution_archipelago_threaded( const int num_pops,
   int		current_island;		/* Current current_island number. */
   population	*pop=NULL;		/* Current population. */
   boolean	complete=FALSE;		/* Whether evolution is terminated. */
-  int		max_threads=0;		/* Maximum number of threads to use at one time. */
-  char		*max_thread_str;	/* Value of enviroment variable. */
-  threaddata_t	*threaddata;		/* Used for passing data to threads. */
-  int		i;			/* Loop over threaddata elements. */
+  int		max_threads;		/* Number of worker threads to use. */
+  threadpool_t	*pool;			/* Persistent worker threads, shared by all islands. */
 
 /* Checks. */
   if (!pops)
@@ -4835,17 +6032,14 @@ GAULFUNC int ga_evolution_archipelago_threaded( const int num_pops,
 /*
  * Look at environment to find number of threads to use.
  */
-  max_thread_str = getenv(GA_NUM_THREADS_ENVVAR_STRING);
-  if (max_thread_str) max_threads = atoi(max_thread_str);
-  if (max_threads == 0) max_threads = GA_DEFAULT_NUM_THREADS;
+  max_threads = gaul_get_num_threads();
 
-  plog(LOG_VERBOSE, "During evolution upto %d threads will be created", max_threads);
+  plog(LOG_VERBOSE, "During evolution %d worker threads will be created", max_threads);
 
 /*
- * Allocate memory required for handling the threads.
+ * Start the worker threads.  These persist for the whole run.
  */
-  if ( !(threaddata = s_malloc(sizeof(threaddata_t)*max_threads)) )
-    die("Unable to allocate memory");
+  pool = gaul_threadpool_new(max_threads);
 
   pop->generation = 0;
 
@@ -4853,15 +6047,12 @@ GAULFUNC int ga_evolution_archipelago_threaded( const int num_pops,
     {
     pop = pops[current_island];
 
-    for (i=0; i<max_threads; i++)
-      threaddata[i].pop = pop;
-
 /*
  * Score and sort the initial population members.
  */
     if (pop->size < pop->stable_size)
       gaul_population_fill(pop, pop->stable_size - pop->size);
-    gaul_ensure_evaluations_threaded(pop, max_threads, threaddata);
+    gaul_ensure_evaluations_threaded(pop, pool);
     sort_population(pop);
     ga_genocide_by_fitness(pop, GA_MIN_FITNESS);
   
@@ -4889,9 +6080,6 @@ GAULFUNC int ga_evolution_archipelago_threaded( const int num_pops,
 
       plog( LOG_VERBOSE, "*** Evolution on current_island %d ***", current_island );
 
-      for (i=0; i<max_threads; i++)
-        threaddata[i].pop = pop;
-
       if (pop->generation_hook?pop->generation_hook(generation, pop):TRUE)
         {
         pop->orig_size = pop->size;
@@ -4901,24 +6089,19 @@ GAULFUNC int ga_evolution_archipelago_threaded( const int num_pops,
               current_island, pop->orig_size, generation );
 
 /*
- * Crossover step.
- */
-        gaul_crossover(pop);	/* FIXME: Need to pass current_island for messages. */
-
-/*
- * Mutation step.
+ * Crossover and mutation steps.
  */
-        gaul_mutation(pop);	/* FIXME: Need to pass current_island for messages. */
+        gaul_reproduction_threaded(pop, pool);	/* FIXME: Need to pass current_island for messages. */
 
 /*
  * Apply environmental adaptations, score entities, sort entities, etc.
  */
-        gaul_adapt_and_evaluate_threaded(pop, max_threads, threaddata);
+        gaul_adapt_and_evaluate_threaded(pop, pool);
 
 /*
  * Survival of the fittest.
  */
-        gaul_survival_threaded(pop, max_threads, threaddata);
+        gaul_survival_threaded(pop, pool);
 
         }
       else
@@ -4936,8 +6119,8 @@ GAULFUNC int ga_evolution_archipelago_threaded( const int num_pops,
 
     }	/* Generation loop. */
 
-/* Free memory used for storing thread information. */
-  s_free(threaddata);
+/* Stop the worker threads. */
+  gaul_threadpool_free(pool);
 
   return generation;
   }
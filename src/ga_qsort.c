@@ -29,7 +29,17 @@
 
 		These functions aren't intended for public use.
 
-		Two versions exist.  (1) The older version uses the
+		For the standard fitness ranking, sizeable
+		populations are sorted by an LSD radix sort of
+		order-preserving 64-bit keys derived from the
+		fitness.  When only the survivors need ordering, the
+		survivors are first isolated by a radix selection.
+		Very large arrays are sorted in parallel runs which
+		are combined by merge path merges, when OpenMP is in
+		use.  All of these are stable, and so they give
+		exactly the same ordering as the shuffle sort below.
+
+		Two versions of the comparison based sort exist.  (1) The older version uses the
 		quicksort algorithm, but since it is inefficient for
 		small arrays we use a shuffle sort to sort blocks of
 		less than 8 elements.  Unfortunately, platform
@@ -49,6 +59,26 @@
  */
 #define swap_e(x, y)	{entity *t; t = x; x = y; y = t; }
 
+/*
+ * Records for the radix sorts.  Each pairs an entity with a 64-bit
+ * key, derived from its fitness, stored as two 32-bit words with the
+ * most significant first.
+ */
+typedef struct ga_sortrec_t
+  {
+  unsigned int	key[2];
+  entity	*entity;
+  } ga_sortrec;
+
+#define GA_QSORT_SIGN_BIT	0x80000000U
+
+/* Byte b of a record's key, where byte 0 is the least significant. */
+#define GA_QSORT_DIGIT(r, b)	( ((r).key[(b)<4] >> (((b)&3)*8)) & 0xFF )
+
+#define GA_QSORT_KEY_EQ(x, y)	( (x).key[0] == (y).key[0] && (x).key[1] == (y).key[1] )
+#define GA_QSORT_KEY_LT(x, y)	( (x).key[0] < (y).key[0] || ((x).key[0] == (y).key[0] && (x).key[1] < (y).key[1]) )
+#define GA_QSORT_KEY_LE(x, y)	( (x).key[0] < (y).key[0] || ((x).key[0] == (y).key[0] && (x).key[1] <= (y).key[1]) )
+
 #if 0
 /**********************************************************************
   quicksort_population()
@@ -256,20 +286,15 @@ void quicksort_population(population *pop)
 /*
  * New, shuffle sort function.
  * Fairly efficient when much of the population is already in order.
+ * Stops once the first num_best entities are definitely sorted.
  */
-void sort_population(population *pop)
+static void gaul_sort_shuffle(population *pop, const int num_best)
   {
   int		k;		/* Loop variable. */
   int		first=0, last=pop->size-1;	/* Indices into population. */
   entity	**array_of_ptrs=pop->entity_iarray;
   boolean	done=TRUE;	/* Whether shuffle sort is complete. */
 
-  plog(LOG_VERBOSE, "Sorting population with %d members.", pop->size);
-
-#ifdef GA_QSORT_TIME
-  timer_start();
-#endif
-
   if (pop->rank == ga_rank_fitness)
     {
 /*
@@ -280,7 +305,7 @@ void sort_population(population *pop)
 
 /*
  * A bi-directional bubble sort (actually called shuffle sort, apparently)
- * algorithm.  We stop when the first pop->stable_size entities are
+ * algorithm.  We stop when the first num_best entities are
  * definitely sorted.
  * There's an extra bubble-up at the start.
  */
@@ -299,7 +324,7 @@ void sort_population(population *pop)
       }
     first++;	/* The first one *MUST* be correct now. */
 
-    while (done == FALSE && first <= pop->stable_size && first < last)
+    while (done == FALSE && first < num_best && first < last)
       {
       for (k = last ; k > first ; k--)
         {
@@ -327,7 +352,7 @@ void sort_population(population *pop)
     {
 /*
  * A bi-directional bubble sort (actually called shuffle sort, apparently)
- * algorithm.  We stop when the first pop->stable_size entities are
+ * algorithm.  We stop when the first num_best entities are
  * definitely sorted.
  * There's an extra bubble-up at the start.
  */
@@ -346,7 +371,7 @@ void sort_population(population *pop)
       }
     first++;	/* The first one *MUST* be correct now. */
 
-    while (done == FALSE && first <= pop->stable_size && first < last)
+    while (done == FALSE && first < num_best && first < last)
       {
       for (k = last ; k > first ; k--)
         {
@@ -371,6 +396,468 @@ void sort_population(population *pop)
       }
     }
 
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_sort_make_keys()
+  synopsis:	Fill sort records with an order-preserving 64-bit key,
+		held as two 32-bit words, for each entity's fitness.
+		The keys are inverted, so that sorting them into
+		ascending order places the fittest entities first.
+		Negative zero is mapped onto positive zero, so that
+		equal fitnesses always have equal keys.  NaN fitnesses
+		have no meaningful order, so if any are present the
+		keys are not used.
+  parameters:	population *pop
+		ga_sortrec *rec	Array of pop->size records to fill.
+  return:	TRUE on success, FALSE if radix sorting can't be used.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean gaul_sort_make_keys(population *pop, ga_sortrec *rec)
+  {
+  int		i;		/* Loop variable over entities. */
+  int		hi;		/* Index of the double's most significant word. */
+  double	fitness;	/* Fitness of current entity. */
+  unsigned int	hiword, loword;	/* Key words. */
+  union
+    {
+    double	d;
+    unsigned int	w[2];
+    } bits;			/* Bit pattern of a fitness. */
+
+  if (sizeof(double) != 2*sizeof(unsigned int)) return FALSE;
+
+  bits.d = -0.0;
+  hi = bits.w[1]!=0?1:0;
+
+  for (i=0; i<pop->size; i++)
+    {
+    fitness = pop->entity_iarray[i]->fitness;
+
+    if (fitness != fitness) return FALSE;
+    if (fitness == 0.0) fitness = 0.0;
+
+    bits.d = fitness;
+    hiword = bits.w[hi];
+    loword = bits.w[1-hi];
+
+    if ( !(hiword & GA_QSORT_SIGN_BIT) )
+      {
+      hiword = ~(hiword | GA_QSORT_SIGN_BIT);
+      loword = ~loword;
+      }
+
+    rec[i].key[0] = hiword;
+    rec[i].key[1] = loword;
+    rec[i].entity = pop->entity_iarray[i];
+    }
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  gaul_radix_sort()
+  synopsis:	Stable LSD radix sort of records by key, one byte at a
+		time.  All byte histograms are collected in a single
+		pass, and passes in which every key has the same digit
+		are skipped, which is common with degenerate fitness.
+  parameters:	ga_sortrec *rec	Records to sort.
+		ga_sortrec *tmp	Workspace of the same size.
+		const int num	Number of records.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_radix_sort(ga_sortrec *rec, ga_sortrec *tmp, const int num)
+  {
+  int		i, b, d;		/* Loop variables. */
+  int		count[8][256];		/* Digit histograms. */
+  int		offset, num_digit;	/* Bucket positions. */
+  ga_sortrec	*src=rec, *dest=tmp, *swap;	/* Pass buffers. */
+
+  if (num < 2) return;
+
+  memset(count, 0, sizeof(count));
+
+  for (i=0; i<num; i++)
+    {
+    for (b=0; b<8; b++)
+      count[b][GA_QSORT_DIGIT(rec[i], b)]++;
+    }
+
+  for (b=0; b<8; b++)
+    {
+    if (count[b][GA_QSORT_DIGIT(rec[0], b)] == num) continue;
+
+    offset = 0;
+    for (d=0; d<256; d++)
+      {
+      num_digit = count[b][d];
+      count[b][d] = offset;
+      offset += num_digit;
+      }
+
+    for (i=0; i<num; i++)
+      dest[count[b][GA_QSORT_DIGIT(src[i], b)]++] = src[i];
+
+    swap = src;
+    src = dest;
+    dest = swap;
+    }
+
+  if (src != rec) memcpy(rec, src, sizeof(ga_sortrec)*num);
+
+  return;
+  }
+
+
+#ifdef USE_OPENMP
+/**********************************************************************
+  gaul_merge_path_split()
+  synopsis:	Find where the diagonal of a merge path crosses it.
+		Ties are taken from the first array, so the merge is
+		stable.
+  parameters:	const ga_sortrec *a	First sorted array.
+		const int na
+		const ga_sortrec *b	Second sorted array.
+		const int nb
+		const int diag	Number of merged elements.
+  return:	Number of those elements taken from the first array.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_merge_path_split(const ga_sortrec *a, const int na,
+                                 const ga_sortrec *b, const int nb,
+                                 const int diag)
+  {
+  int	lo, hi, mid;	/* Binary search bounds. */
+
+  lo = diag>nb?diag-nb:0;
+  hi = MIN(diag, na);
+
+  while (lo < hi)
+    {
+    mid = (lo+hi)/2;
+    if ( GA_QSORT_KEY_LE(a[mid], b[diag-mid-1]) )
+      lo = mid+1;
+    else
+      hi = mid;
+    }
+
+  return lo;
+  }
+
+
+/**********************************************************************
+  gaul_merge_parallel()
+  synopsis:	Stable merge of two sorted arrays.  The output is
+		divided into equal segments, each of which is merged
+		independently after locating its start on the merge
+		path.
+  parameters:	const ga_sortrec *a	First sorted array.
+		const int na
+		const ga_sortrec *b	Second sorted array.
+		const int nb
+		ga_sortrec *out		Output, na+nb records.
+		const int num_parts	Number of segments.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_merge_parallel(const ga_sortrec *a, const int na,
+                                const ga_sortrec *b, const int nb,
+                                ga_sortrec *out, const int num_parts)
+  {
+  int	p;			/* Loop variable over segments. */
+  int	start, end;		/* Segment of output. */
+  int	i, j, iend, jend;	/* Positions in the input arrays. */
+  int	k;			/* Position in output. */
+
+#pragma omp parallel for \
+   shared(a,b,out) private(p,start,end,i,j,iend,jend,k) \
+   schedule(static)
+  for (p=0; p<num_parts; p++)
+    {
+    start = (int)(((double)(na+nb)*p)/num_parts);
+    end = (int)(((double)(na+nb)*(p+1))/num_parts);
+
+    i = gaul_merge_path_split(a, na, b, nb, start);
+    j = start-i;
+    iend = gaul_merge_path_split(a, na, b, nb, end);
+    jend = end-iend;
+
+    for (k=start; k<end; k++)
+      {
+      if ( j>=jend || (i<iend && GA_QSORT_KEY_LE(a[i], b[j])) )
+        out[k] = a[i++];
+      else
+        out[k] = b[j++];
+      }
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_sort_parallel()
+  synopsis:	Stable parallel sort.  Equal runs are radix sorted
+		concurrently and then merged pairwise, each merge
+		being split across the threads.
+  parameters:	ga_sortrec *rec	Records to sort.
+		ga_sortrec *tmp	Workspace of the same size.
+		const int num	Number of records.
+		const int num_runs	Number of runs.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_sort_parallel(ga_sortrec *rec, ga_sortrec *tmp,
+                               const int num, const int num_runs)
+  {
+  int		r;			/* Loop variable over runs. */
+  int		width;			/* Runs per merged block. */
+  int		first, mid, end;	/* Bounds of merged block. */
+  int		*bound;			/* Bounds of runs. */
+  ga_sortrec	*src=rec, *dest=tmp, *swap;	/* Merge buffers. */
+
+  if ( !(bound = s_malloc(sizeof(int)*(num_runs+1))) )
+    die("Unable to allocate memory");
+
+  for (r=0; r<=num_runs; r++)
+    bound[r] = (int)(((double)num*r)/num_runs);
+
+#pragma omp parallel for \
+   shared(rec,tmp,bound) private(r) \
+   schedule(static)
+  for (r=0; r<num_runs; r++)
+    gaul_radix_sort(rec+bound[r], tmp+bound[r], bound[r+1]-bound[r]);
+
+  for (width=1; width<num_runs; width*=2)
+    {
+    for (r=0; r<num_runs; r+=2*width)
+      {
+      first = bound[r];
+      mid = bound[MIN(r+width, num_runs)];
+      end = bound[MIN(r+2*width, num_runs)];
+      gaul_merge_parallel(src+first, mid-first, src+mid, end-mid,
+                          dest+first, num_runs);
+      }
+
+    swap = src;
+    src = dest;
+    dest = swap;
+    }
+
+  if (src != rec) memcpy(rec, src, sizeof(ga_sortrec)*num);
+
+  s_free(bound);
+
+  return;
+  }
+#endif
+
+
+/**********************************************************************
+  gaul_sort_records()
+  synopsis:	Stable sort of records by key.  Large arrays are
+		sorted in parallel when OpenMP is in use.
+  parameters:	ga_sortrec *rec	Records to sort.
+		ga_sortrec *tmp	Workspace of the same size.
+		const int num	Number of records.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_sort_records(ga_sortrec *rec, ga_sortrec *tmp, const int num)
+  {
+#ifdef USE_OPENMP
+  int	num_threads=omp_get_max_threads();	/* Available threads. */
+
+  if (num >= GA_QSORT_PARALLEL_MIN && num_threads > 1)
+    {
+    gaul_sort_parallel(rec, tmp, num, num_threads);
+    return;
+    }
+#endif
+
+  gaul_radix_sort(rec, tmp, num);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_select_records()
+  synopsis:	Stable partial selection.  Moves the num_best records
+		with the lowest keys to the front of the array, ahead
+		of the others, without otherwise altering the order of
+		either group.  The key of the last selected record is
+		found by MSD radix selection over a shrinking set of
+		candidates; records with that key are selected in their
+		original order.
+  parameters:	ga_sortrec *rec	Records.
+		ga_sortrec *tmp	Workspace of the same size.
+		const int num	Number of records.
+		const int num_best	Number of records to select.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_select_records(ga_sortrec *rec, ga_sortrec *tmp,
+                                const int num, const int num_best)
+  {
+  int		i, b, d;		/* Loop variables. */
+  int		count[256];		/* Digit histogram. */
+  int		need=num_best;		/* Records still to select from candidates. */
+  int		num_cand=num;		/* Number of candidates. */
+  int		num_head=0, num_tail=0;	/* Partition sizes. */
+  ga_sortrec	*cand=rec;		/* Candidates for the threshold. */
+  ga_sortrec	threshold;		/* Key of last selected record. */
+
+  threshold.key[0] = 0;
+  threshold.key[1] = 0;
+
+  for (b=7; b>=0; b--)
+    {
+    memset(count, 0, sizeof(count));
+
+    for (i=0; i<num_cand; i++)
+      count[GA_QSORT_DIGIT(cand[i], b)]++;
+
+    for (d=0; count[d] < need; d++)
+      need -= count[d];
+
+    threshold.key[b<4] |= ((unsigned int) d) << ((b&3)*8);
+
+    for (i=0; i<num_cand; i++)
+      {
+      if (GA_QSORT_DIGIT(cand[i], b) == d)
+        tmp[num_head++] = cand[i];
+      }
+
+    cand = tmp;
+    num_cand = num_head;
+    num_head = 0;
+    }
+
+/*
+ * Stable partition about the threshold.  The selection is compacted
+ * in place, and the remainder is gathered in the workspace.
+ */
+  for (i=0; i<num; i++)
+    {
+    if ( GA_QSORT_KEY_LT(rec[i], threshold) ||
+         (need > 0 && GA_QSORT_KEY_EQ(rec[i], threshold)) )
+      {
+      if (GA_QSORT_KEY_EQ(rec[i], threshold)) need--;
+      rec[num_head++] = rec[i];
+      }
+    else
+      {
+      tmp[num_tail++] = rec[i];
+      }
+    }
+
+  memcpy(rec+num_head, tmp, sizeof(ga_sortrec)*num_tail);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_sort_radix()
+  synopsis:	Sort the population by fitness, using radix keys.
+		When num_best is less than the population size, only
+		the num_best fittest entities are selected and sorted,
+		the remainder follow in an arbitrary order.
+  parameters:	population *pop
+		const int num_best	Number of entities to sort.
+  return:	FALSE if the keys couldn't be generated.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean gaul_sort_radix(population *pop, const int num_best)
+  {
+  int		i;		/* Loop variable over entities. */
+  ga_sortrec	*rec, *tmp;	/* Sort records and workspace. */
+
+  if ( !(rec = s_malloc(sizeof(ga_sortrec)*pop->size*2)) )
+    die("Unable to allocate memory");
+  tmp = rec+pop->size;
+
+  if (gaul_sort_make_keys(pop, rec) == FALSE)
+    {
+    s_free(rec);
+    return FALSE;
+    }
+
+  if (num_best < pop->size)
+    gaul_select_records(rec, tmp, pop->size, num_best);
+
+  gaul_sort_records(rec, tmp, MIN(num_best, pop->size));
+
+  for (i=0; i<pop->size; i++)
+    pop->entity_iarray[i] = rec[i].entity;
+
+  s_free(rec);
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  gaul_sort()
+  synopsis:	Sort the population by fitness, fittest first.
+		Ties retain their previous order, so the ordering is
+		the same whichever method is used.  For the standard
+		ranking function, populations of GA_QSORT_RADIX_MIN
+		or more entities are radix sorted; if only the fittest
+		are required, those are first isolated by a radix
+		selection.  Otherwise, a shuffle sort is used.
+  parameters:	population *pop
+		const int num_radix	Entities to order by radix sort.
+		const int num_shuffle	Entities to order by shuffle sort.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_sort(population *pop, const int num_radix, const int num_shuffle)
+  {
+  boolean	sorted=FALSE;	/* Whether the radix sort was used. */
+#if GA_QSORT_DEBUG>1
+  int		k;		/* Loop variable. */
+  entity	**array_of_ptrs=pop->entity_iarray;
+#endif
+
+  plog(LOG_VERBOSE, "Sorting population with %d members.", pop->size);
+
+/* Restore the order of any steady-state replacements, so that ties are consistent. */
+  sort_population_on_demand(pop);
+
+#ifdef GA_QSORT_TIME
+  timer_start();
+#endif
+
+  if ( pop->rank == ga_rank_fitness && pop->size > 1 )
+    {
+    if ( pop->sort_type == GA_SORT_RADIX )
+      sorted = gaul_sort_radix(pop, pop->size);
+    else if ( pop->sort_type == GA_SORT_AUTO && pop->size >= GA_QSORT_RADIX_MIN )
+      sorted = gaul_sort_radix(pop, num_radix);
+    }
+
+  if (sorted == FALSE) gaul_sort_shuffle(pop, num_shuffle);
+
+/*
+ * Record the new ranks in the entities.
+ */
+  gaul_population_update_ranks(pop, 0, pop->size);
+
 #if GA_QSORT_DEBUG>1
 /* Check that the population is correctly sorted. */
   printf("rank 0 id %d fitness %f.\n", ga_get_entity_id_from_rank(pop, 0), array_of_ptrs[0]->fitness);
@@ -392,6 +879,119 @@ void sort_population(population *pop)
   }
 
 
+/**********************************************************************
+  sort_population()
+  synopsis:	Sort the population by fitness, fittest first.  The
+		radix sorts order the entire population, while the
+		shuffle sort only guarantees the order of the first
+		pop->stable_size+1 entities.
+		See ga_population_set_sort_type().
+  parameters:	population *pop
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+void sort_population(population *pop)
+  {
+
+  gaul_sort(pop, pop->size, pop->stable_size+1);
+
+  return;
+  }
+
+
+/**********************************************************************
+  sort_population_best()
+  synopsis:	Move the num_best fittest entities to the front of
+		the population, in order.  The remainder follow in an
+		arbitrary order, so this is appropriate when they are
+		about to be culled.  For large populations this takes
+		linear time.
+  parameters:	population *pop
+		const int num_best	Number of entities to sort.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+void sort_population_best(population *pop, const int num_best)
+  {
+
+  if (num_best < 1) return;
+
+  gaul_sort(pop, MIN(num_best, pop->size), num_best);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_sort_compare_births()
+  synopsis:	qsort() comparison of entities by fitness, fittest
+		first, with ties in the order of insertion into the
+		replacement heap.
+  parameters:	const void *a	Pointer to entity pointer.
+		const void *b	Pointer to entity pointer.
+  return:	int
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_sort_compare_births(const void *a, const void *b)
+  {
+  const entity	*ea=*((entity *const *) a);	/* First entity. */
+  const entity	*eb=*((entity *const *) b);	/* Second entity. */
+
+  if (ea->fitness > eb->fitness) return -1;
+  if (ea->fitness < eb->fitness) return 1;
+
+  return ea->birth - eb->birth;
+  }
+
+
+/**********************************************************************
+  sort_population_on_demand()
+  synopsis:	While ga_evolution_steady_state() is using the
+		replacement heap, ga_replace_by_fitness() leaves each
+		new entity in the place of the entity that it
+		replaced.  This restores the sorted order of the
+		established entities, exactly as the old bubbling
+		insertion would have left them.  A few replacements
+		are fixed by an insertion sort, many by qsort().
+		Nothing is done if the population is already sorted.
+  parameters:	population *pop
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+void sort_population_on_demand(population *pop)
+  {
+  entity	**array=pop->entity_iarray;	/* Established entities. */
+  entity	*e;				/* Entity being inserted. */
+  int		i, j;				/* Loop variables. */
+
+  if (pop->unsorted == 0) return;
+
+  if (pop->unsorted <= GA_QSORT_INSERTION_MAX)
+    {
+    for (i=1; i<pop->replace_heap_size; i++)
+      {
+      e = array[i];
+      for (j=i; j>0 && gaul_sort_compare_births(&array[j-1], &e) > 0; j--)
+        array[j] = array[j-1];
+      array[j] = e;
+      }
+    }
+  else
+    {
+    qsort(array, pop->replace_heap_size, sizeof(entity *), gaul_sort_compare_births);
+    }
+
+  gaul_population_update_ranks(pop, 0, pop->replace_heap_size);
+  pop->unsorted = 0;
+
+  return;
+  }
+
+
 /* To test+time these functions, compile with something like:
    gcc ga_qsort.c -DGA_QSORT_TIME -DGA_QSORT_COMPILE_MAIN ga_core.o \
      -o qsort `gtk-config --cflags` \
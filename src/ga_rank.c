@@ -61,3 +61,2208 @@ GAULFUNC int ga_rank_fitness(	population *alphapop, entity *alpha,
   }
 
 
+
+/**********************************************************************
+  gaul_rank_dominates()
+  synopsis:	Determine whether one fitness vector Pareto dominates
+		another.  That is, it is at least as good in every
+		dimension, and better in at least one.
+  parameters:	const double *alpha	Fitness vector A.
+		const double *beta	Fitness vector B.
+		const int num_dims	Size of fitness vectors.
+  return:	TRUE if A dominates B.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean gaul_rank_dominates( const double *alpha, const double *beta,
+                                    const int num_dims )
+  {
+  int		i;			/* Loop over dimensions. */
+  boolean	better=FALSE;		/* Whether A is better in any dimension. */
+
+  for (i=0; i<num_dims; i++)
+    {
+    if (alpha[i] < beta[i]) return FALSE;
+    if (alpha[i] > beta[i]) better = TRUE;
+    }
+
+  return better;
+  }
+
+
+/**********************************************************************
+  ga_rank_pareto()
+  synopsis:	Compares two entities by Pareto dominance of their
+		fitness vectors.
+  parameters:	population *alphapop	Population A
+		entity *alpha		Test entity A.
+		population *betapop 	Population B
+		entity *beta		Test entity B.
+  return:	1 if A dominates B, -1 if B dominates A, otherwise 0.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_rank_pareto(	population *alphapop, entity *alpha,
+			population *betapop, entity *beta )
+  {
+
+  /* Checks */
+  if (!alphapop || !betapop) die("Null pointer to population structure passed");
+  if (!alpha || !beta) die("Null pointer to entity structure passed");
+  if (alphapop->fitness_dimensions != betapop->fitness_dimensions)
+    die("Populations have incompatible fitness vectors");
+  if (!alpha->fitvector || !beta->fitvector) die("Entity has no fitness vector");
+
+  if (gaul_rank_dominates(alpha->fitvector, beta->fitvector, alphapop->fitness_dimensions))
+    return 1;
+  if (gaul_rank_dominates(beta->fitvector, alpha->fitvector, alphapop->fitness_dimensions))
+    return -1;
+
+  return 0;
+  }
+
+
+/*
+ * Record for sorting fitness vectors.
+ */
+typedef struct
+  {
+  const double	*fitvector;	/* Fitness vector. */
+  int		num_dims;	/* Size of fitness vector. */
+  int		index;		/* Original position. */
+  } ga_pareto_rec;
+
+/*
+ * Record for sorting fitness vectors along one dimension, or by
+ * crowding distance.
+ */
+typedef struct
+  {
+  double	value;		/* Sort key. */
+  int		index;		/* Original position. */
+  } ga_pareto_key;
+
+/**********************************************************************
+  gaul_rank_compare_lexical()
+  synopsis:	qsort() comparison of fitness vectors in descending
+		lexicographic order.  No vector can dominate one that
+		precedes it in this order.  Equal vectors retain
+		their original order.
+  parameters:	const void *a	Pointer to ga_pareto_rec.
+		const void *b	Pointer to ga_pareto_rec.
+  return:	int
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_rank_compare_lexical(const void *a, const void *b)
+  {
+  const ga_pareto_rec	*ra=(const ga_pareto_rec *) a;	/* First record. */
+  const ga_pareto_rec	*rb=(const ga_pareto_rec *) b;	/* Second record. */
+  int			i;				/* Loop over dimensions. */
+
+  for (i=0; i<ra->num_dims; i++)
+    {
+    if (ra->fitvector[i] > rb->fitvector[i]) return -1;
+    if (ra->fitvector[i] < rb->fitvector[i]) return 1;
+    }
+
+  return ra->index - rb->index;
+  }
+
+
+/**********************************************************************
+  gaul_rank_compare_key()
+  synopsis:	qsort() comparison of keys in ascending order.  Equal
+		keys retain their original order.
+  parameters:	const void *a	Pointer to ga_pareto_key.
+		const void *b	Pointer to ga_pareto_key.
+  return:	int
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_rank_compare_key(const void *a, const void *b)
+  {
+  const ga_pareto_key	*ka=(const ga_pareto_key *) a;	/* First key. */
+  const ga_pareto_key	*kb=(const ga_pareto_key *) b;	/* Second key. */
+
+  if (ka->value < kb->value) return -1;
+  if (ka->value > kb->value) return 1;
+
+  return ka->index - kb->index;
+  }
+
+
+/**********************************************************************
+  gaul_rank_crowding()
+  synopsis:	Find the crowding distance of each member of a set of
+		fitness vectors, as used by NSGA-II.  This is the sum,
+		over all dimensions, of the normalised distance
+		between each member's neighbours.  The extreme
+		members along any dimension have a crowding distance
+		of DBL_MAX.
+  parameters:	double **fitvectors	The fitness vectors.
+		const int *members	Subscripts of the set's members.
+		const int size		Number of members.
+		const int num_dims	Size of the fitness vectors.
+		ga_pareto_key *key	Work space, of at least size elements.
+		double *crowding	Returns crowding distances, by subscript.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_rank_crowding( double **fitvectors, const int *members,
+                                const int size, const int num_dims,
+                                ga_pareto_key *key, double *crowding )
+  {
+  int		i, j;		/* Loop variables. */
+  double	range;		/* Range of values along one dimension. */
+
+  for (j=0; j<size; j++)
+    crowding[members[j]] = 0.0;
+
+  for (i=0; i<num_dims; i++)
+    {
+    for (j=0; j<size; j++)
+      {
+      key[j].index = members[j];
+      key[j].value = fitvectors[key[j].index][i];
+      }
+
+    qsort(key, size, sizeof(ga_pareto_key), gaul_rank_compare_key);
+
+    crowding[key[0].index] = DBL_MAX;
+    crowding[key[size-1].index] = DBL_MAX;
+
+    range = key[size-1].value-key[0].value;
+    if (range > 0.0)
+      {
+      for (j=1; j<size-1; j++)
+        {
+        if (crowding[key[j].index] < DBL_MAX)
+          crowding[key[j].index] += (key[j+1].value-key[j-1].value)/range;
+        }
+      }
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_rank_pareto_fronts()
+  synopsis:	Non-dominated sorting of fitness vectors, as used by
+		NSGA-II.  Front 0 is the Pareto set, front 1 is the
+		Pareto set of the remainder, and so on.
+		This is the efficient non-dominated sort with binary
+		search (ENS-BS) of Zhang et al.  The vectors are
+		sorted lexicographically, so that each need only be
+		compared with those that precede it, and then each
+		is assigned to the first front which doesn't
+		dominate it.  This takes O(MN^2) time in the worst
+		case, but it is usually much faster.  For two
+		objectives, only the latest member of a front can
+		dominate a new vector, so O(N log N) time is needed.
+		Optionally, the crowding distance of each vector
+		within its front is also found.  The extreme members
+		of each front have a crowding distance of DBL_MAX.
+  parameters:	double **fitvectors	The fitness vectors.
+		const int num		Number of fitness vectors.
+		const int num_dims	Size of the fitness vectors.
+		int *front		Returns the front of each vector.
+		double *crowding	Returns crowding distances, or NULL.
+  return:	Number of fronts.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+int gaul_rank_pareto_fronts( double **fitvectors, const int num,
+                             const int num_dims, int *front, double *crowding )
+  {
+  ga_pareto_rec	*rec;		/* Fitness vectors in lexicographic order. */
+  ga_pareto_key	*key;		/* Members of one front along one dimension. */
+  int		*last;		/* Latest member of each front, as a subscript into rec[]. */
+  int		*prev;		/* Previous member of the same front. */
+  int		*start;		/* First member of each front, in order[]. */
+  int		*order;		/* Vectors grouped by front. */
+  int		num_fronts=0;	/* Number of fronts. */
+  int		i, j, k;	/* Loop variables. */
+  int		lo, hi, mid;	/* Binary search over fronts. */
+  boolean	dominated;	/* Whether a front dominates the new vector. */
+
+  if (num < 1) return 0;
+
+  if ( !(rec = s_malloc(sizeof(ga_pareto_rec)*num)) )
+    die("Unable to allocate memory");
+  if ( !(last = s_malloc(sizeof(int)*num)) )
+    die("Unable to allocate memory");
+  if ( !(prev = s_malloc(sizeof(int)*num)) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<num; i++)
+    {
+    rec[i].fitvector = fitvectors[i];
+    rec[i].num_dims = num_dims;
+    rec[i].index = i;
+    }
+
+  qsort(rec, num, sizeof(ga_pareto_rec), gaul_rank_compare_lexical);
+
+  for (i=0; i<num; i++)
+    {
+/* Dominance by a front implies dominance by all earlier fronts. */
+    lo = 0;
+    hi = num_fronts;
+    while (lo < hi)
+      {
+      mid = (lo+hi)/2;
+
+      dominated = FALSE;
+      for (j=last[mid]; j>=0 && dominated==FALSE; j=(num_dims==2?-1:prev[j]))
+        dominated = gaul_rank_dominates(rec[j].fitvector, rec[i].fitvector, num_dims);
+
+      if (dominated)
+        lo = mid+1;
+      else
+        hi = mid;
+      }
+
+    if (lo == num_fronts)
+      {
+      last[lo] = -1;
+      num_fronts++;
+      }
+
+    prev[i] = last[lo];
+    last[lo] = i;
+    front[rec[i].index] = lo;
+    }
+
+  if (crowding)
+    {
+    if ( !(start = s_malloc(sizeof(int)*(num_fronts+1))) )
+      die("Unable to allocate memory");
+    if ( !(order = s_malloc(sizeof(int)*num)) )
+      die("Unable to allocate memory");
+    if ( !(key = s_malloc(sizeof(ga_pareto_key)*num)) )
+      die("Unable to allocate memory");
+
+/* Group the vectors by front. */
+    for (k=0; k<=num_fronts; k++)
+      start[k] = 0;
+    for (i=0; i<num; i++)
+      start[front[i]+1]++;
+    for (k=0; k<num_fronts; k++)
+      start[k+1] += start[k];
+    for (i=0; i<num; i++)
+      order[start[front[i]]++] = i;
+    for (k=num_fronts; k>0; k--)
+      start[k] = start[k-1];
+    start[0] = 0;
+
+    for (k=0; k<num_fronts; k++)
+      gaul_rank_crowding(fitvectors, &(order[start[k]]), start[k+1]-start[k],
+                         num_dims, key, crowding);
+
+    s_free(key);
+    s_free(order);
+    s_free(start);
+    }
+
+  s_free(prev);
+  s_free(last);
+  s_free(rec);
+
+  return num_fronts;
+  }
+
+
+/**********************************************************************
+  gaul_rank_pareto_survivors()
+  synopsis:	NSGA-II style survival.  Chooses num_survivors
+		entities, front by front, from the non-dominated
+		sorting of the population's fitness vectors.  Within
+		the front which doesn't fit entirely, the entities
+		with the greatest crowding distance are preferred,
+		and then those with the lowest rank.  Alternatively,
+		SMS-EMOA style, the members of that front which
+		contribute least to its hypervolume are discarded,
+		one at a time.  The others are flagged in the cull
+		mask.
+  parameters:	population *pop
+		const int num_survivors	Number of entities to keep.
+		boolean *cull		Returns TRUE for each rank to kill.
+		const boolean hypervolume	Whether to choose by hypervolume contribution.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+void gaul_rank_pareto_survivors( population *pop, const int num_survivors,
+                                 boolean *cull, const boolean hypervolume )
+  {
+  double	**fitvectors;	/* Fitness vectors, by rank. */
+  int		*front;		/* Front of each entity. */
+  double	*crowding;	/* Crowding distance of each entity. */
+  int		*count;		/* Size of each front. */
+  ga_pareto_key	*key;		/* Entities of the partial front. */
+  double	**members;	/* Fitness vectors of the partial front. */
+  boolean	*discard;	/* Whether each member of the partial front dies. */
+  double	*reference;	/* Hypervolume reference point. */
+  int		num_fronts;	/* Number of fronts. */
+  int		partial;	/* Front which doesn't fit entirely. */
+  int		remaining;	/* Survivors still to choose. */
+  int		i, n=0;		/* Loop variables. */
+
+  if (pop->fitness_dimensions < 1 || pop->size < 1)
+    die("Population has no fitness vectors.");
+
+  if ( !(fitvectors = s_malloc(sizeof(double *)*pop->size)) )
+    die("Unable to allocate memory");
+  if ( !(front = s_malloc(sizeof(int)*pop->size)) )
+    die("Unable to allocate memory");
+  if ( !(crowding = s_malloc(sizeof(double)*pop->size)) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<pop->size; i++)
+    {
+    if (!pop->entity_iarray[i]->fitvector) die("Entity has no fitness vector.");
+    fitvectors[i] = pop->entity_iarray[i]->fitvector;
+    }
+
+  num_fronts = gaul_rank_pareto_fronts(fitvectors, pop->size,
+                                       pop->fitness_dimensions, front, crowding);
+
+  if ( !(count = s_malloc(sizeof(int)*num_fronts)) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<num_fronts; i++)
+    count[i] = 0;
+  for (i=0; i<pop->size; i++)
+    count[front[i]]++;
+
+/* Whole fronts survive while there is room for them. */
+  remaining = num_survivors;
+  for (partial=0; partial<num_fronts && count[partial]<=remaining; partial++)
+    remaining -= count[partial];
+
+  for (i=0; i<pop->size; i++)
+    cull[i] = front[i] > partial || (front[i] == partial && remaining < count[partial]);
+
+/* The members of the partial front which add most to its hypervolume survive. */
+  if (partial < num_fronts && remaining > 0 && hypervolume)
+    {
+    if ( !(key = s_malloc(sizeof(ga_pareto_key)*count[partial])) )
+      die("Unable to allocate memory");
+    if ( !(members = s_malloc(sizeof(double *)*count[partial])) )
+      die("Unable to allocate memory");
+    if ( !(discard = s_malloc(sizeof(boolean)*count[partial])) )
+      die("Unable to allocate memory");
+    if ( !(reference = s_malloc(sizeof(double)*pop->fitness_dimensions)) )
+      die("Unable to allocate memory");
+
+    gaul_rank_hypervolume_reference(pop, fitvectors, pop->size, reference);
+
+    for (i=0; i<pop->size; i++)
+      {
+      if (front[i] == partial)
+        {
+        members[n] = fitvectors[i];
+        key[n].index = i;
+        n++;
+        }
+      }
+
+    gaul_rank_hypervolume_reduce(members, n, pop->fitness_dimensions,
+                                 reference, n-remaining, discard);
+
+    for (i=0; i<n; i++)
+      cull[key[i].index] = discard[i];
+
+    s_free(reference);
+    s_free(discard);
+    s_free(members);
+    s_free(key);
+    }
+
+/* The least crowded members of the partial front fill the remaining places. */
+  if (partial < num_fronts && remaining > 0 && !hypervolume)
+    {
+    if ( !(key = s_malloc(sizeof(ga_pareto_key)*count[partial])) )
+      die("Unable to allocate memory");
+
+    for (i=0; i<pop->size; i++)
+      {
+      if (front[i] == partial)
+        {
+        key[n].value = -crowding[i];
+        key[n].index = i;
+        n++;
+        }
+      }
+
+    qsort(key, n, sizeof(ga_pareto_key), gaul_rank_compare_key);
+
+    for (i=0; i<remaining; i++)
+      cull[key[i].index] = FALSE;
+
+    s_free(key);
+    }
+
+  plog(LOG_VERBOSE, "%d Pareto fronts, of which %d survive entirely.", num_fronts, partial);
+
+  s_free(count);
+  s_free(crowding);
+  s_free(front);
+  s_free(fitvectors);
+
+  return;
+  }
+
+
+
+/**********************************************************************
+  gaul_archive_build()
+  synopsis:	Recursively build a balanced k-d tree from the given
+		nodes, by splitting at the median along successive
+		dimensions.  key[] is work space for sorting the
+		nodes.
+  parameters:	ga_archive_t *archive
+		int *subset		Nodes to include.
+		const int num		Number of nodes.
+		const int split		Dimension to split along.
+		ga_pareto_key *key	Work space, of at least num elements.
+  return:	Root node of the subtree, or -1.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_archive_build( ga_archive_t *archive, int *subset,
+                               const int num, const int split,
+                               ga_pareto_key *key )
+  {
+  int		num_dims=archive->num_dims;	/* Size of fitness vectors. */
+  int		mid=num/2;		/* Median. */
+  int		n;			/* The new node. */
+  int		child;			/* A child node. */
+  int		i, d;			/* Loop variables. */
+  double	*lo, *hi;		/* Bounds of the subtree. */
+  double	*clo, *chi;		/* Bounds of the child's subtree. */
+
+  if (num < 1) return -1;
+
+  for (i=0; i<num; i++)
+    {
+    key[i].index = subset[i];
+    key[i].value = archive->box[3*num_dims*subset[i]+split];
+    }
+
+  qsort(key, num, sizeof(ga_pareto_key), gaul_rank_compare_key);
+
+  for (i=0; i<num; i++)
+    subset[i] = key[i].index;
+
+  n = subset[mid];
+  archive->node[n].split = split;
+  archive->node[n].left = gaul_archive_build(archive, subset, mid,
+                                             (split+1)%num_dims, key);
+  archive->node[n].right = gaul_archive_build(archive, &(subset[mid+1]),
+                                              num-mid-1, (split+1)%num_dims, key);
+
+/* The subtree bounds enclose the node and both child subtrees. */
+  lo = &(archive->box[3*num_dims*n+num_dims]);
+  hi = &(archive->box[3*num_dims*n+2*num_dims]);
+  memcpy(lo, &(archive->box[3*num_dims*n]), sizeof(double)*num_dims);
+  memcpy(hi, &(archive->box[3*num_dims*n]), sizeof(double)*num_dims);
+
+  for (i=0; i<2; i++)
+    {
+    child = i==0?archive->node[n].left:archive->node[n].right;
+    if (child >= 0)
+      {
+      clo = &(archive->box[3*num_dims*child+num_dims]);
+      chi = &(archive->box[3*num_dims*child+2*num_dims]);
+      for (d=0; d<num_dims; d++)
+        {
+        if (clo[d] < lo[d]) lo[d] = clo[d];
+        if (chi[d] > hi[d]) hi[d] = chi[d];
+        }
+      }
+    }
+
+  return n;
+  }
+
+
+/**********************************************************************
+  gaul_archive_rebuild()
+  synopsis:	Discard the nodes of removed entities, and rebuild
+		the archive's k-d tree so that it is balanced.
+  parameters:	ga_archive_t *archive
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_archive_rebuild(ga_archive_t *archive)
+  {
+  int		num_dims=archive->num_dims;	/* Size of fitness vectors. */
+  int		i, n=0;			/* Loop variables. */
+  ga_pareto_key	*key;			/* Work space for sorting nodes. */
+
+  for (i=0; i<archive->num_nodes; i++)
+    {
+    if (archive->node[i].entity)
+      {
+      if (n != i)
+        {
+        archive->node[n] = archive->node[i];
+        memcpy(&(archive->box[3*num_dims*n]), &(archive->box[3*num_dims*i]),
+               sizeof(double)*num_dims);
+        }
+      archive->stack[n] = n;
+      n++;
+      }
+    }
+
+  archive->num_nodes = n;
+  archive->num_removed = 0;
+  archive->num_inserted = 0;
+
+  if ( !(key = s_malloc(sizeof(ga_pareto_key)*(n+1))) )
+    die("Unable to allocate memory");
+
+  archive->root = gaul_archive_build(archive, archive->stack, n, 0, key);
+
+  s_free(key);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_archive_remove()
+  synopsis:	Remove an archived entity.  Its node remains in the
+		k-d tree until the next rebuild.
+  parameters:	ga_archive_t *archive
+		const int n		Node of entity to remove.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_archive_remove(ga_archive_t *archive, const int n)
+  {
+
+  ga_entity_dereference(archive->pop, archive->node[n].entity);
+  archive->node[n].entity = NULL;
+  archive->num_removed++;
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_archive_insert()
+  synopsis:	Offer a fitness vector, and its entity, to the
+		archive.  It is rejected if any archived vector is at
+		least as good in every dimension.  Otherwise, a copy
+		of the entity is archived, and any archived entities
+		which it dominates are removed.
+		The subtree bounds of the k-d tree allow both queries
+		to skip any subtree which can't contain a relevant
+		vector, so that each insertion usually visits only a
+		few nodes beyond the path from the root.
+  parameters:	ga_archive_t *archive
+		entity *e		Entity to offer.
+  return:	TRUE if the entity was archived.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean gaul_archive_insert(ga_archive_t *archive, entity *e)
+  {
+  int		num_dims=archive->num_dims;	/* Size of fitness vectors. */
+  const double	*p=e->fitvector;	/* The offered fitness vector. */
+  double	*q;			/* An archived fitness vector. */
+  double	*lo, *hi;		/* Subtree bounds. */
+  int		sp;			/* Stack pointer. */
+  int		n, child;		/* Nodes. */
+  int		d;			/* Loop over dimensions. */
+  int		depth=0;		/* Depth of the new node. */
+  int		limit=8;		/* Depth beyond which the tree is unbalanced. */
+  entity	*dolly;			/* The archived copy. */
+
+/*
+ * Is the vector weakly dominated by any archived vector?  No vector in
+ * a subtree can be if, along any dimension, the whole subtree is worse.
+ */
+  sp = 0;
+  if (archive->root >= 0) archive->stack[sp++] = archive->root;
+
+  while (sp > 0)
+    {
+    n = archive->stack[--sp];
+    hi = &(archive->box[3*num_dims*n+2*num_dims]);
+
+    for (d=0; d<num_dims && hi[d]>=p[d]; d++);
+    if (d < num_dims) continue;
+
+    if (archive->node[n].entity)
+      {
+      q = &(archive->box[3*num_dims*n]);
+      for (d=0; d<num_dims && q[d]>=p[d]; d++);
+      if (d == num_dims) return FALSE;
+      }
+
+    if (archive->node[n].left >= 0) archive->stack[sp++] = archive->node[n].left;
+    if (archive->node[n].right >= 0) archive->stack[sp++] = archive->node[n].right;
+    }
+
+/*
+ * Remove any archived vectors which this one dominates.  Likewise, a
+ * subtree may be skipped if, along any dimension, it is all better.
+ */
+  if (archive->root >= 0) archive->stack[sp++] = archive->root;
+
+  while (sp > 0)
+    {
+    n = archive->stack[--sp];
+    lo = &(archive->box[3*num_dims*n+num_dims]);
+
+    for (d=0; d<num_dims && lo[d]<=p[d]; d++);
+    if (d < num_dims) continue;
+
+    if (archive->node[n].entity)
+      {
+      q = &(archive->box[3*num_dims*n]);
+      for (d=0; d<num_dims && q[d]<=p[d]; d++);
+      if (d == num_dims) gaul_archive_remove(archive, n);
+      }
+
+    if (archive->node[n].left >= 0) archive->stack[sp++] = archive->node[n].left;
+    if (archive->node[n].right >= 0) archive->stack[sp++] = archive->node[n].right;
+    }
+
+/*
+ * Archive a copy of the entity.
+ */
+  dolly = ga_entity_clone(archive->pop, e);
+  memcpy(dolly->fitvector, p, sizeof(double)*num_dims);
+
+  if (archive->num_nodes == archive->max_nodes)
+    {
+    archive->max_nodes *= 2;
+    archive->node = s_realloc(archive->node, sizeof(ga_archive_node)*archive->max_nodes);
+    archive->box = s_realloc(archive->box, sizeof(double)*3*num_dims*archive->max_nodes);
+    archive->stack = s_realloc(archive->stack, sizeof(int)*archive->max_nodes);
+    }
+
+  n = archive->num_nodes++;
+  archive->node[n].entity = dolly;
+  archive->node[n].left = -1;
+  archive->node[n].right = -1;
+  archive->node[n].split = 0;
+  memcpy(&(archive->box[3*num_dims*n]), p, sizeof(double)*num_dims);
+  memcpy(&(archive->box[3*num_dims*n+num_dims]), p, sizeof(double)*num_dims);
+  memcpy(&(archive->box[3*num_dims*n+2*num_dims]), p, sizeof(double)*num_dims);
+
+/*
+ * Descend to a leaf, enlarging the subtree bounds along the way.
+ */
+  child = archive->root;
+  if (child < 0) archive->root = n;
+
+  while (child >= 0)
+    {
+    depth++;
+    lo = &(archive->box[3*num_dims*child+num_dims]);
+    hi = &(archive->box[3*num_dims*child+2*num_dims]);
+    for (d=0; d<num_dims; d++)
+      {
+      if (p[d] < lo[d]) lo[d] = p[d];
+      if (p[d] > hi[d]) hi[d] = p[d];
+      }
+
+    q = &(archive->box[3*num_dims*child]);
+    d = archive->node[child].split;
+    if (p[d] < q[d])
+      {
+      if (archive->node[child].left < 0)
+        {
+        archive->node[child].left = n;
+        child = -1;
+        }
+      else
+        {
+        child = archive->node[child].left;
+        }
+      }
+    else
+      {
+      if (archive->node[child].right < 0)
+        {
+        archive->node[child].right = n;
+        child = -1;
+        }
+      else
+        {
+        child = archive->node[child].right;
+        }
+      }
+
+    if (child < 0) archive->node[n].split = (d+1)%num_dims;
+    }
+
+  archive->num_inserted++;
+
+/*
+ * Rebuild once most nodes are dead, or when the tree has become
+ * unbalanced and enough insertions have occurred to pay for it.
+ */
+  for (d=archive->num_nodes; d>1; d/=2) limit += 3;
+
+  if ( archive->num_removed*2 > archive->num_nodes ||
+       (depth > limit && archive->num_inserted*4 > archive->num_nodes) )
+    gaul_archive_rebuild(archive);
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  gaul_archive_bound()
+  synopsis:	Reduce the archive to its maximum size, once it has
+		more than limit entities, by removing the entities
+		with the smallest crowding distances.  The extreme
+		entities along each dimension are always kept.
+  parameters:	ga_archive_t *archive
+		const int limit		Size which triggers the reduction.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_archive_bound(ga_archive_t *archive, const int limit)
+  {
+  int		num=archive->num_nodes-archive->num_removed;	/* Number of archived entities. */
+  double	**fitvectors;		/* Archived fitness vectors. */
+  int		*members;		/* Subscripts of the archived vectors. */
+  double	*crowding;		/* Crowding distance of each vector. */
+  ga_pareto_key	*key;			/* Vectors by crowding distance. */
+  int		i, n=0;			/* Loop variables. */
+
+  if (archive->max_size < 1 || num <= limit) return;
+
+  if ( !(fitvectors = s_malloc(sizeof(double *)*num)) )
+    die("Unable to allocate memory");
+  if ( !(members = s_malloc(sizeof(int)*num)) )
+    die("Unable to allocate memory");
+  if ( !(crowding = s_malloc(sizeof(double)*num)) )
+    die("Unable to allocate memory");
+  if ( !(key = s_malloc(sizeof(ga_pareto_key)*num)) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<archive->num_nodes; i++)
+    {
+    if (archive->node[i].entity)
+      {
+      fitvectors[n] = &(archive->box[3*archive->num_dims*i]);
+      members[n] = n;
+      n++;
+      }
+    }
+
+/* The archive is mutually non-dominated, so it is a single front. */
+  gaul_rank_crowding(fitvectors, members, num, archive->num_dims, key, crowding);
+
+  n = 0;
+  for (i=0; i<archive->num_nodes; i++)
+    {
+    if (archive->node[i].entity)
+      {
+      key[n].value = crowding[n];
+      key[n].index = i;
+      n++;
+      }
+    }
+
+  qsort(key, num, sizeof(ga_pareto_key), gaul_rank_compare_key);
+
+  for (i=0; i<num-archive->max_size; i++)
+    gaul_archive_remove(archive, key[i].index);
+
+  if (archive->num_removed*2 > archive->num_nodes)
+    gaul_archive_rebuild(archive);
+
+  s_free(key);
+  s_free(crowding);
+  s_free(members);
+  s_free(fitvectors);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_archive_free()
+  synopsis:	Free a population's archive, and the entities in it.
+  parameters:	population *pop
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+void gaul_archive_free(population *pop)
+  {
+  ga_archive_t	*archive=pop->archive;	/* The archive. */
+
+  if (!archive) return;
+
+/* The user data is shared with pop, unless the archive owns a copy. */
+  if (!archive->pop->population_data_destructor)
+    archive->pop->data = NULL;
+
+  ga_extinction(archive->pop);
+
+  s_free(archive->node);
+  s_free(archive->box);
+  s_free(archive->stack);
+  s_free(archive);
+
+  pop->archive = NULL;
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_population_set_archive()
+  synopsis:	Maintain an external archive of the non-dominated
+		entities, by Pareto dominance of their fitness
+		vectors, found by an optimisation.  Unlike the
+		population itself, entities in the archive are only
+		removed when a better entity is found, or if the
+		archive exceeds max_size; in which case the most
+		crowded are removed.  The generational GA routines
+		update the archive prior to each culling.  Otherwise,
+		see ga_population_archive_update().
+		If the archive already exists, only its maximum size
+		is changed.
+  parameters:	population *pop
+		const int max_size	Maximum size of the archive, or 0 for no limit.
+  return:	success
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC boolean ga_population_set_archive(population *pop, const int max_size)
+  {
+  ga_archive_t	*archive;	/* The new archive. */
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+  if ( pop->fitness_dimensions < 1 ) die("Population has no fitness vectors.");
+  if ( max_size < 0 ) return FALSE;
+
+  if (pop->archive)
+    {
+    pop->archive->max_size = max_size;
+    gaul_archive_bound(pop->archive, max_size);
+    return TRUE;
+    }
+
+  if ( !(archive = s_malloc(sizeof(ga_archive_t))) )
+    die("Unable to allocate memory");
+
+  archive->pop = ga_population_clone_empty(pop);
+  archive->pop->fitness_dimensions = pop->fitness_dimensions;
+  archive->max_size = max_size;
+  archive->num_dims = pop->fitness_dimensions;
+  archive->max_nodes = 16;
+  if ( !(archive->node = s_malloc(sizeof(ga_archive_node)*archive->max_nodes)) )
+    die("Unable to allocate memory");
+  if ( !(archive->box = s_malloc(sizeof(double)*3*archive->num_dims*archive->max_nodes)) )
+    die("Unable to allocate memory");
+  if ( !(archive->stack = s_malloc(sizeof(int)*archive->max_nodes)) )
+    die("Unable to allocate memory");
+  archive->root = -1;
+  archive->num_nodes = 0;
+  archive->num_removed = 0;
+  archive->num_inserted = 0;
+
+  pop->archive = archive;
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  ga_population_get_archive()
+  synopsis:	Gets the population which holds a population's
+		archive.  This may be used with the usual functions,
+		for example ga_get_entity_from_rank() and
+		ga_population_write(), but it is owned by the
+		archive.  Its entities must not be removed, and it
+		must not be passed to ga_extinction().  The archived
+		entities are not in any particular order.
+  parameters:	population *pop
+  return:	Archive population, or NULL if there is no archive.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC population *ga_population_get_archive(population *pop)
+  {
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+
+  return pop->archive?pop->archive->pop:NULL;
+  }
+
+
+/**********************************************************************
+  ga_population_archive_entity()
+  synopsis:	Offer a single entity to a population's archive.  A
+		copy is archived if no archived entity is at least as
+		good in every dimension.  So that the cost of the
+		reduction is shared between many insertions, the
+		archive is only reduced to its maximum size once it
+		exceeds that by an eighth.
+  parameters:	population *pop
+		entity *e	An evaluated entity.
+  return:	TRUE if the entity was archived.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC boolean ga_population_archive_entity(population *pop, entity *e)
+  {
+  boolean	archived;	/* Whether entity was archived. */
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+  if ( !e ) die("Null pointer to entity structure passed.");
+  if ( !pop->archive ) die("Population has no archive.");
+  if ( !e->fitvector ) die("Entity has no fitness vector.");
+
+  archived = gaul_archive_insert(pop->archive, e);
+  if (archived)
+    gaul_archive_bound(pop->archive, pop->archive->max_size+pop->archive->max_size/8);
+
+  return archived;
+  }
+
+
+/**********************************************************************
+  ga_population_archive_update()
+  synopsis:	Offer every evaluated entity in a population to its
+		archive.  The archive is then reduced to its maximum
+		size, if required.
+  parameters:	population *pop
+  return:	Number of entities archived.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int ga_population_archive_update(population *pop)
+  {
+  int		i;		/* Loop over entities. */
+  int		count=0;	/* Number of entities archived. */
+  entity	*e;		/* Entity to offer. */
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+  if ( !pop->archive ) die("Population has no archive.");
+
+  for (i=0; i<pop->size; i++)
+    {
+    e = pop->entity_iarray[i];
+    if (e->fitness != GA_MIN_FITNESS && e->fitvector)
+      {
+      if (gaul_archive_insert(pop->archive, e)) count++;
+      }
+    }
+
+  gaul_archive_bound(pop->archive, pop->archive->max_size);
+
+  plog(LOG_VERBOSE, "%d entities archived; archive size = %d.",
+       count, pop->archive->pop->size);
+
+  return count;
+  }
+
+
+/**********************************************************************
+  Hypervolume calculations.
+
+  The hypervolume of a set of fitness vectors is the volume of the
+  region which they dominate, bounded by a reference point which is
+  worse along every dimension.  Internally, the vectors are held
+  contiguously, relative to the reference point, and sorted in
+  descending order of their last element.  Vectors which are not
+  strictly better than the reference point in every dimension
+  dominate no volume, and are omitted.
+ **********************************************************************/
+
+/**********************************************************************
+  gaul_hv_prepare()
+  synopsis:	Copy the fitness vectors which dominate any volume,
+		relative to the reference point, in descending order
+		of their last element.
+  parameters:	double **fitvectors	The fitness vectors.
+		const int num		Number of fitness vectors.
+		const int num_dims	Size of the fitness vectors.
+		const double *reference	The reference point.
+		double **points		Returns the relative vectors.
+		int **map		Returns the original subscripts.
+  return:	Number of relative vectors.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_hv_prepare( double **fitvectors, const int num,
+                            const int num_dims, const double *reference,
+                            double **points, int **map )
+  {
+  ga_pareto_key	*key;			/* Vectors by last element. */
+  int		last=num_dims-1;	/* Last dimension. */
+  int		i, j, d;		/* Loop variables. */
+  int		n=0;			/* Number of relative vectors. */
+
+  if ( !(key = s_malloc(sizeof(ga_pareto_key)*(num+1))) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<num; i++)
+    {
+    for (d=0; d<num_dims && fitvectors[i][d]>reference[d]; d++);
+    if (d == num_dims)
+      {
+      key[n].value = reference[last]-fitvectors[i][last];
+      key[n].index = i;
+      n++;
+      }
+    }
+
+  qsort(key, n, sizeof(ga_pareto_key), gaul_rank_compare_key);
+
+  if ( !(*points = s_malloc(sizeof(double)*num_dims*(n+1))) )
+    die("Unable to allocate memory");
+  if ( !(*map = s_malloc(sizeof(int)*(n+1))) )
+    die("Unable to allocate memory");
+
+  for (j=0; j<n; j++)
+    {
+    i = key[j].index;
+    (*map)[j] = i;
+    for (d=0; d<num_dims; d++)
+      (*points)[j*num_dims+d] = fitvectors[i][d]-reference[d];
+    }
+
+  s_free(key);
+
+  return n;
+  }
+
+
+/**********************************************************************
+  gaul_hv_covers()
+  synopsis:	Determine whether one relative vector is at least as
+		good as another in every dimension.
+  parameters:	const double *alpha	Vector A.
+		const double *beta	Vector B.
+		const int num_dims	Size of vectors.
+  return:	TRUE if A weakly dominates B.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean gaul_hv_covers( const double *alpha, const double *beta,
+                               const int num_dims )
+  {
+  int		d;		/* Loop over dimensions. */
+
+  for (d=0; d<num_dims && alpha[d]>=beta[d]; d++);
+
+  return d == num_dims;
+  }
+
+
+/**********************************************************************
+  gaul_hv_box()
+  synopsis:	Volume dominated by a single relative vector.
+  parameters:	const double *point	The relative vector.
+		const int num_dims	Size of vector.
+  return:	Volume.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double gaul_hv_box(const double *point, const int num_dims)
+  {
+  double	vol=1.0;	/* The volume. */
+  int		d;		/* Loop over dimensions. */
+
+  for (d=0; d<num_dims; d++)
+    vol *= point[d];
+
+  return vol;
+  }
+
+
+/**********************************************************************
+  gaul_hv_limit()
+  synopsis:	Find the limit set of one relative vector, that is,
+		the part of the region dominated by each of the
+		others which lies within the region dominated by
+		this one.  Only the vectors from first onwards, and
+		which are live, are considered.  The limit set is
+		produced in descending order of its last element.
+		For more than three dimensions, any member which is
+		weakly dominated by another is discarded, since this
+		greatly reduces the work of the WFG recursion.
+  parameters:	const double *points	Sorted relative vectors.
+		const int num		Number of vectors.
+		const int num_dims	Size of vectors.
+		const int k		The vector whose limit set is required.
+		const int first		First vector to consider.
+		const boolean *live	Whether each vector is present, or NULL.
+		double *limit		Returns the limit set.
+  return:	Size of limit set.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_hv_limit( const double *points, const int num,
+                          const int num_dims, const int k, const int first,
+                          const boolean *live, double *limit )
+  {
+  const double	*p=&(points[k*num_dims]);	/* The vector. */
+  const double	*r;			/* Another vector. */
+  double	*q;			/* New member of limit set. */
+  int		j, t, kept;		/* Loop variables. */
+  int		d;			/* Loop over dimensions. */
+  int		m=0;			/* Size of limit set. */
+  boolean	dominated;		/* Whether new member is weakly dominated. */
+
+  for (j=first; j<num; j++)
+    {
+    if (j == k || (live && !live[j])) continue;
+
+    r = &(points[j*num_dims]);
+    q = &(limit[m*num_dims]);
+    for (d=0; d<num_dims; d++)
+      q[d] = r[d]<p[d]?r[d]:p[d];
+
+    if (num_dims > 3)
+      {
+      dominated = FALSE;
+      for (t=0; t<m && dominated==FALSE; t++)
+        dominated = gaul_hv_covers(&(limit[t*num_dims]), q, num_dims);
+
+      if (dominated) continue;
+
+/* Discard any members that the new one dominates, preserving the order. */
+      kept = 0;
+      for (t=0; t<m; t++)
+        {
+        if (!gaul_hv_covers(q, &(limit[t*num_dims]), num_dims))
+          {
+          if (kept != t)
+            memcpy(&(limit[kept*num_dims]), &(limit[t*num_dims]), sizeof(double)*num_dims);
+          kept++;
+          }
+        }
+
+      if (kept != m)
+        memcpy(&(limit[kept*num_dims]), q, sizeof(double)*num_dims);
+      m = kept;
+      }
+
+    m++;
+    }
+
+  return m;
+  }
+
+
+/**********************************************************************
+  gaul_hv_sweep3()
+  synopsis:	Hypervolume in three dimensions.  The vectors are
+		swept in descending order of their last element,
+		while the area dominated by those seen so far, in the
+		first two dimensions, is maintained as a staircase.
+		This takes O(n log n) time, plus the time to shift
+		the staircase, which is rarely significant.
+  parameters:	const double *points	Sorted relative vectors.
+		const int num		Number of vectors.
+  return:	Hypervolume.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double gaul_hv_sweep3(const double *points, const int num)
+  {
+  double	*sx, *sy;	/* The staircase, in ascending order of x. */
+  int		size=0;		/* Number of steps. */
+  double	area=0.0;	/* Area under the staircase. */
+  double	vol=0.0;	/* The hypervolume. */
+  double	x, y, z;	/* Current vector. */
+  double	zprev;		/* Previous value of z. */
+  double	left;		/* Start of region replaced by the new step. */
+  double	prev;		/* Start of current strip. */
+  double	before, after;	/* Area of replaced region, before and after. */
+  int		lo, hi, mid;	/* Binary search. */
+  int		start, end;	/* Steps replaced by the new step. */
+  int		i, k;		/* Loop variables. */
+
+  if ( !(sx = s_malloc(sizeof(double)*num)) )
+    die("Unable to allocate memory");
+  if ( !(sy = s_malloc(sizeof(double)*num)) )
+    die("Unable to allocate memory");
+
+  zprev = points[2];
+
+  for (i=0; i<num; i++)
+    {
+    x = points[3*i];
+    y = points[3*i+1];
+    z = points[3*i+2];
+
+    vol += area*(zprev-z);
+    zprev = z;
+
+/* The first step at least as far along as this vector. */
+    lo = 0;
+    hi = size;
+    while (lo < hi)
+      {
+      mid = (lo+hi)/2;
+      if (sx[mid] < x)
+        lo = mid+1;
+      else
+        hi = mid;
+      }
+
+/* Skip vectors which are under the staircase. */
+    if (lo < size && sy[lo] >= y) continue;
+
+/* Steps which are dominated by this vector are replaced by it. */
+    end = (lo < size && sx[lo] == x)?lo+1:lo;
+    start = lo;
+    while (start > 0 && sy[start-1] <= y) start--;
+
+    left = start>0?sx[start-1]:0.0;
+    before = 0.0;
+    prev = left;
+    for (k=start; k<end; k++)
+      {
+      before += (sx[k]-prev)*sy[k];
+      prev = sx[k];
+      }
+    after = (x-left)*y;
+
+    if (end < size)
+      {
+      before += (sx[end]-prev)*sy[end];
+      after += (sx[end]-x)*sy[end];
+      }
+
+    area += after-before;
+
+    memmove(&(sx[start+1]), &(sx[end]), sizeof(double)*(size-end));
+    memmove(&(sy[start+1]), &(sy[end]), sizeof(double)*(size-end));
+    size += 1-(end-start);
+    sx[start] = x;
+    sy[start] = y;
+    }
+
+  vol += area*zprev;
+
+  s_free(sy);
+  s_free(sx);
+
+  return vol;
+  }
+
+
+/**********************************************************************
+  gaul_hv_sorted()
+  synopsis:	Hypervolume of sorted relative vectors.  Exact
+		sweeps are used in two and three dimensions, and the
+		WFG algorithm of While et al. otherwise.  In WFG, the
+		hypervolume is the sum of the exclusive hypervolumes
+		of each vector with respect to those which follow it.
+		Each exclusive hypervolume is the volume dominated by
+		the vector, less the hypervolume of its limit set.
+  parameters:	double *points		Sorted relative vectors.
+		const int num		Number of vectors.
+		const int num_dims	Size of vectors.
+  return:	Hypervolume.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double gaul_hv_sorted( double *points, const int num,
+                              const int num_dims )
+  {
+  double	vol=0.0;	/* The hypervolume. */
+  double	xmax=0.0;	/* Furthest extent along first dimension. */
+  double	*limit;		/* Limit set. */
+  int		i, m;		/* Loop variable, size of limit set. */
+
+  if (num < 1) return 0.0;
+  if (num == 1) return gaul_hv_box(points, num_dims);
+  if (num_dims == 1) return points[0];
+
+  if (num_dims == 2)
+    {
+    for (i=0; i<num; i++)
+      {
+      if (points[2*i] > xmax)
+        {
+        vol += points[2*i+1]*(points[2*i]-xmax);
+        xmax = points[2*i];
+        }
+      }
+    return vol;
+    }
+
+  if (num_dims == 3) return gaul_hv_sweep3(points, num);
+
+  if ( !(limit = s_malloc(sizeof(double)*num_dims*num)) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<num; i++)
+    {
+    m = gaul_hv_limit(points, num, num_dims, i, i+1, NULL, limit);
+    vol += gaul_hv_box(&(points[i*num_dims]), num_dims)
+           - gaul_hv_sorted(limit, m, num_dims);
+    }
+
+  s_free(limit);
+
+  return vol;
+  }
+
+
+/**********************************************************************
+  gaul_hv_exclusive()
+  synopsis:	Exclusive hypervolume contribution of one relative
+		vector.  That is, the hypervolume which would be lost
+		if it was removed from the set.
+  parameters:	const double *points	Sorted relative vectors.
+		const int num		Number of vectors.
+		const int num_dims	Size of vectors.
+		const int k		The vector of interest.
+		const boolean *live	Whether each vector is present, or NULL.
+		double *limit		Work space, of num vectors.
+  return:	Exclusive hypervolume.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double gaul_hv_exclusive( const double *points, const int num,
+                                 const int num_dims, const int k,
+                                 const boolean *live, double *limit )
+  {
+  const double	*p=&(points[k*num_dims]);	/* The vector. */
+  double	vol;			/* Exclusive hypervolume. */
+  int		j, m;			/* Loop variable, size of limit set. */
+
+/* Nothing is lost if another vector is at least as good. */
+  for (j=0; j<num; j++)
+    {
+    if ( j != k && (!live || live[j]) &&
+         gaul_hv_covers(&(points[j*num_dims]), p, num_dims) )
+      return 0.0;
+    }
+
+  m = gaul_hv_limit(points, num, num_dims, k, 0, live, limit);
+  vol = gaul_hv_box(p, num_dims) - gaul_hv_sorted(limit, m, num_dims);
+
+  return vol>0.0?vol:0.0;
+  }
+
+
+/**********************************************************************
+  Exclusive hypervolume contributions in two and three dimensions.
+
+  The vectors are swept in descending order of their last element,
+  in three dimensions, while the region dominated by those seen so
+  far, in the first two dimensions, is maintained as a staircase.
+  Between successive values of the last element, each step of the
+  staircase exclusively dominates the rectangle between it and its
+  neighbours, less the region dominated by those vectors which are
+  dominated by that step alone.  These are kept, in ascending order
+  of x, as a staircase of their own, with the area which it
+  dominates.  A vector which is dominated by two or more others
+  never affects any contribution again, and is discarded.  The area
+  of a step only changes when its neighbours, or the vectors which
+  it alone dominates, change, and the contribution of that area is
+  only accumulated then.  This is the algorithm of Emmerich and
+  Fonseca.  In two dimensions, the last element is treated as 1.
+ **********************************************************************/
+
+typedef struct
+  {
+  const double	*points;	/* Sorted relative vectors. */
+  int		num_dims;	/* Size of vectors. */
+  int		*stair;		/* Steps, in ascending order of x. */
+  int		size;		/* Number of steps. */
+  int		**sec;		/* Vectors dominated by each step alone. */
+  int		*sec_num;	/* Number of such vectors. */
+  int		*sec_max;	/* Space for such vectors. */
+  double	*sec_area;	/* Area dominated by such vectors. */
+  double	*area;		/* Current exclusive area of each step. */
+  double	*since;		/* Last element when that area was accumulated. */
+  double	*contribution;	/* Accumulated contributions. */
+  } ga_hv_sweep;
+
+#define GA_HV_X(sw, k)	((sw)->points[(k)*(sw)->num_dims])
+#define GA_HV_Y(sw, k)	((sw)->points[(k)*(sw)->num_dims+1])
+
+/**********************************************************************
+  gaul_hv_sweep_search()
+  synopsis:	Find the first member of a staircase which is at
+		least as far along the first dimension as x.
+  parameters:	const ga_hv_sweep *sw
+		const int *ids		The staircase.
+		const int num		Size of staircase.
+		const double x		Position to find.
+  return:	Position within staircase.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int gaul_hv_sweep_search( const ga_hv_sweep *sw, const int *ids,
+                                 const int num, const double x )
+  {
+  int		lo=0, hi=num, mid;	/* Binary search. */
+
+  while (lo < hi)
+    {
+    mid = (lo+hi)/2;
+    if (GA_HV_X(sw, ids[mid]) < x)
+      lo = mid+1;
+    else
+      hi = mid;
+    }
+
+  return lo;
+  }
+
+
+/**********************************************************************
+  gaul_hv_sweep_flush()
+  synopsis:	Accumulate the contribution of a step's current
+		area, down to the given value of the last element.
+  parameters:	ga_hv_sweep *sw
+		const int k		The vector.
+		const double z		Current value of last element.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_hv_sweep_flush(ga_hv_sweep *sw, const int k, const double z)
+  {
+
+  sw->contribution[k] += sw->area[k]*(sw->since[k]-z);
+  sw->since[k] = z;
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_hv_sweep_refresh()
+  synopsis:	Accumulate the contribution of a step, then find its
+		new exclusive area.  The vectors which it alone
+		dominates all lie between its neighbours, so the
+		region that they dominate beyond the neighbours is
+		simply subtracted from the area that they dominate.
+  parameters:	ga_hv_sweep *sw
+		const int s		Position of step.
+		const double z		Current value of last element.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_hv_sweep_refresh(ga_hv_sweep *sw, const int s, const double z)
+  {
+  int		k=sw->stair[s];	/* The vector. */
+  int		n=sw->sec_num[k];	/* Vectors which it alone dominates. */
+  double	xl, yr;		/* Extent of neighbours. */
+  double	shadow=0.0;	/* Area dominated by those vectors. */
+  double	area;		/* New exclusive area. */
+
+  gaul_hv_sweep_flush(sw, k, z);
+
+  xl = s>0?GA_HV_X(sw, sw->stair[s-1]):0.0;
+  yr = s<sw->size-1?GA_HV_Y(sw, sw->stair[s+1]):0.0;
+
+  if (n > 0)
+    shadow = sw->sec_area[k] - xl*GA_HV_Y(sw, sw->sec[k][0])
+             - GA_HV_X(sw, sw->sec[k][n-1])*yr + xl*yr;
+
+  area = (GA_HV_X(sw, k)-xl)*(GA_HV_Y(sw, k)-yr) - shadow;
+  sw->area[k] = area>0.0?area:0.0;
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_hv_sweep_reserve()
+  synopsis:	Ensure that the vectors dominated by one step alone
+		have space for the given number.
+  parameters:	ga_hv_sweep *sw
+		const int k		The vector.
+		const int num		Number required.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_hv_sweep_reserve(ga_hv_sweep *sw, const int k, const int num)
+  {
+
+  if (num > sw->sec_max[k])
+    {
+    sw->sec_max[k] = num>2*sw->sec_max[k]?num:2*sw->sec_max[k];
+    if ( !(sw->sec[k] = s_realloc(sw->sec[k], sizeof(int)*sw->sec_max[k])) )
+      die("Unable to allocate memory");
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_hv_sweep_shadow()
+  synopsis:	Add a vector to those dominated by one step alone,
+		unless one of them already dominates it.  Any that
+		it dominates are discarded.
+  parameters:	ga_hv_sweep *sw
+		const int k		The step.
+		const int q		The new vector.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_hv_sweep_shadow(ga_hv_sweep *sw, const int k, const int q)
+  {
+  int		*ids=sw->sec[k];	/* The staircase. */
+  int		n=sw->sec_num[k];	/* Size of staircase. */
+  double	x=GA_HV_X(sw, q), y=GA_HV_Y(sw, q);	/* The new vector. */
+  double	left, prev;	/* Start of replaced region, and of current strip. */
+  double	before, after;	/* Area of replaced region, before and after. */
+  int		lo;		/* First member at least as far along as x. */
+  int		start, end;	/* Members replaced by the new vector. */
+  int		i;		/* Loop over members. */
+
+  lo = gaul_hv_sweep_search(sw, ids, n, x);
+
+  if (lo < n && GA_HV_Y(sw, ids[lo]) >= y) return;
+
+  end = (lo < n && GA_HV_X(sw, ids[lo]) == x)?lo+1:lo;
+  start = lo;
+  while (start > 0 && GA_HV_Y(sw, ids[start-1]) <= y) start--;
+
+  left = start>0?GA_HV_X(sw, ids[start-1]):0.0;
+  before = 0.0;
+  prev = left;
+  for (i=start; i<end; i++)
+    {
+    before += (GA_HV_X(sw, ids[i])-prev)*GA_HV_Y(sw, ids[i]);
+    prev = GA_HV_X(sw, ids[i]);
+    }
+  after = (x-left)*y;
+
+  if (end < n)
+    {
+    before += (GA_HV_X(sw, ids[end])-prev)*GA_HV_Y(sw, ids[end]);
+    after += (GA_HV_X(sw, ids[end])-x)*GA_HV_Y(sw, ids[end]);
+    }
+
+  sw->sec_area[k] += after-before;
+
+  gaul_hv_sweep_reserve(sw, k, n+1);
+  ids = sw->sec[k];
+  memmove(&(ids[start+1]), &(ids[end]), sizeof(int)*(n-end));
+  ids[start] = q;
+  sw->sec_num[k] = n+1-(end-start);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_hv_sweep_insert()
+  synopsis:	Add a vector to the sweep.  It is discarded if two
+		others dominate it, becomes one of those dominated
+		by a step alone if one other does, and otherwise
+		becomes a step.  A new step replaces the steps that
+		it dominates, which become those that it alone
+		dominates, and its neighbours lose any of theirs that
+		it dominates.
+  parameters:	ga_hv_sweep *sw
+		const int q		The new vector.
+		const double z		Its last element.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_hv_sweep_insert(ga_hv_sweep *sw, const int q, const double z)
+  {
+  int		*stair=sw->stair;	/* The staircase. */
+  double	x=GA_HV_X(sw, q), y=GA_HV_Y(sw, q);	/* The new vector. */
+  int		lo;		/* First step at least as far along as x. */
+  int		start, end;	/* Steps replaced by the new vector. */
+  int		s, k, i, n;	/* Loop variables. */
+
+  lo = gaul_hv_sweep_search(sw, stair, sw->size, x);
+
+  if (lo < sw->size && GA_HV_Y(sw, stair[lo]) >= y)
+    {
+    if (lo+1 < sw->size && GA_HV_Y(sw, stair[lo+1]) >= y) return;
+
+    gaul_hv_sweep_shadow(sw, stair[lo], q);
+    gaul_hv_sweep_refresh(sw, lo, z);
+    return;
+    }
+
+  end = (lo < sw->size && GA_HV_X(sw, stair[lo]) == x)?lo+1:lo;
+  start = lo;
+  while (start > 0 && GA_HV_Y(sw, stair[start-1]) <= y) start--;
+
+/* The replaced steps are dominated by the new step alone. */
+  gaul_hv_sweep_reserve(sw, q, end-start);
+  sw->sec_num[q] = end-start;
+  sw->sec_area[q] = 0.0;
+  for (s=start; s<end; s++)
+    {
+    k = stair[s];
+    gaul_hv_sweep_flush(sw, k, z);
+    sw->area[k] = 0.0;
+    sw->sec_num[k] = 0;
+    sw->sec[q][s-start] = k;
+    sw->sec_area[q] += (GA_HV_X(sw, k)-(s>start?GA_HV_X(sw, stair[s-1]):0.0))*GA_HV_Y(sw, k);
+    }
+
+  memmove(&(stair[start+1]), &(stair[end]), sizeof(int)*(sw->size-end));
+  sw->size += 1-(end-start);
+  stair[start] = q;
+  sw->since[q] = z;
+
+/* The left neighbour loses the vectors below the new step. */
+  if (start > 0)
+    {
+    k = stair[start-1];
+    n = sw->sec_num[k];
+    while (n > 0 && GA_HV_Y(sw, sw->sec[k][n-1]) <= y)
+      {
+      n--;
+      sw->sec_area[k] -= (GA_HV_X(sw, sw->sec[k][n])-(n>0?GA_HV_X(sw, sw->sec[k][n-1]):0.0))
+                         * GA_HV_Y(sw, sw->sec[k][n]);
+      }
+    sw->sec_num[k] = n;
+    }
+
+/* The right neighbour loses the vectors before the new step. */
+  if (start+1 < sw->size)
+    {
+    k = stair[start+1];
+    n = sw->sec_num[k];
+    for (i=0; i<n && GA_HV_X(sw, sw->sec[k][i]) <= x; i++)
+      sw->sec_area[k] -= (GA_HV_X(sw, sw->sec[k][i])-(i>0?GA_HV_X(sw, sw->sec[k][i-1]):0.0))
+                         * GA_HV_Y(sw, sw->sec[k][i]);
+    if (i > 0)
+      {
+      if (i < n)
+        sw->sec_area[k] += GA_HV_X(sw, sw->sec[k][i-1])*GA_HV_Y(sw, sw->sec[k][i]);
+      memmove(&(sw->sec[k][0]), &(sw->sec[k][i]), sizeof(int)*(n-i));
+      sw->sec_num[k] = n-i;
+      }
+    }
+
+  for (s=start>0?start-1:0; s<=start+1 && s<sw->size; s++)
+    gaul_hv_sweep_refresh(sw, s, z);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_hv_contributions_sweep()
+  synopsis:	Exclusive hypervolume contributions in two or three
+		dimensions.  This takes O(n log n) time, plus the
+		time to shift the staircases, which is rarely
+		significant.
+  parameters:	const double *points	Sorted relative vectors.
+		const int num		Number of vectors.
+		const int num_dims	Size of vectors, 2 or 3.
+		double *contribution	Returns the contribution of each vector.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_hv_contributions_sweep( const double *points, const int num,
+                                         const int num_dims,
+                                         double *contribution )
+  {
+  ga_hv_sweep	sw;		/* Sweep state. */
+  int		i, s;		/* Loop variables. */
+
+  sw.points = points;
+  sw.num_dims = num_dims;
+  sw.size = 0;
+  sw.contribution = contribution;
+
+  if ( !(sw.stair = s_malloc(sizeof(int)*num)) )
+    die("Unable to allocate memory");
+  if ( !(sw.sec = s_malloc(sizeof(int *)*num)) )
+    die("Unable to allocate memory");
+  if ( !(sw.sec_num = s_malloc(sizeof(int)*num)) )
+    die("Unable to allocate memory");
+  if ( !(sw.sec_max = s_malloc(sizeof(int)*num)) )
+    die("Unable to allocate memory");
+  if ( !(sw.sec_area = s_malloc(sizeof(double)*num)) )
+    die("Unable to allocate memory");
+  if ( !(sw.area = s_malloc(sizeof(double)*num)) )
+    die("Unable to allocate memory");
+  if ( !(sw.since = s_malloc(sizeof(double)*num)) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<num; i++)
+    {
+    sw.sec[i] = NULL;
+    sw.sec_num[i] = 0;
+    sw.sec_max[i] = 0;
+    sw.sec_area[i] = 0.0;
+    sw.area[i] = 0.0;
+    sw.since[i] = 0.0;
+    contribution[i] = 0.0;
+    }
+
+  for (i=0; i<num; i++)
+    gaul_hv_sweep_insert(&sw, i, num_dims==3?points[3*i+2]:1.0);
+
+  for (s=0; s<sw.size; s++)
+    gaul_hv_sweep_flush(&sw, sw.stair[s], 0.0);
+
+  for (i=0; i<num; i++)
+    {
+    if (contribution[i] < 0.0) contribution[i] = 0.0;
+    if (sw.sec[i]) s_free(sw.sec[i]);
+    }
+
+  s_free(sw.since);
+  s_free(sw.area);
+  s_free(sw.sec_area);
+  s_free(sw.sec_max);
+  s_free(sw.sec_num);
+  s_free(sw.sec);
+  s_free(sw.stair);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_hv_contributions()
+  synopsis:	Exclusive hypervolume contribution of every relative
+		vector.  Sweeps are used in up to three dimensions,
+		and gaul_hv_exclusive() for each vector otherwise.
+  parameters:	const double *points	Sorted relative vectors.
+		const int num		Number of vectors.
+		const int num_dims	Size of vectors.
+		double *limit		Work space, of num vectors.
+		double *contribution	Returns the contribution of each vector.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void gaul_hv_contributions( const double *points, const int num,
+                                   const int num_dims, double *limit,
+                                   double *contribution )
+  {
+  int		k;		/* Loop over vectors. */
+
+  if (num < 1) return;
+
+  if (num_dims == 1)
+    {
+    for (k=0; k<num; k++)
+      contribution[k] = 0.0;
+    if (num > 0)
+      contribution[0] = num>1?points[0]-points[1]:points[0];
+    }
+  else if (num_dims <= 3)
+    {
+    gaul_hv_contributions_sweep(points, num, num_dims, contribution);
+    }
+  else
+    {
+    for (k=0; k<num; k++)
+      contribution[k] = gaul_hv_exclusive(points, num, num_dims, k, NULL, limit);
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_hv_heap_down()
+  synopsis:	Restore the order of a min-heap of hypervolume
+		contributions.  Ties are broken in favour of the
+		vector with the greatest original subscript.
+  parameters:	ga_pareto_key *heap	The heap.
+		const int size		Size of heap.
+		int pos			Position of key to move down.
+		const int *map		Original subscripts of vectors.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+#define GA_HV_BEFORE(a, b)	( (a).value < (b).value || \
+                                  ( (a).value == (b).value && \
+                                    map[(a).index] > map[(b).index] ) )
+
+static void gaul_hv_heap_down( ga_pareto_key *heap, const int size,
+                               int pos, const int *map )
+  {
+  ga_pareto_key	moving=heap[pos];	/* Key being moved. */
+  int		child;			/* Child position. */
+
+  while ((child = 2*pos+1) < size)
+    {
+    if (child+1 < size && GA_HV_BEFORE(heap[child+1], heap[child]))
+      child++;
+    if (!GA_HV_BEFORE(heap[child], moving))
+      break;
+    heap[pos] = heap[child];
+    pos = child;
+    }
+
+  heap[pos] = moving;
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_rank_hypervolume_reduce()
+  synopsis:	SMS-EMOA style reduction.  Repeatedly discards the
+		fitness vector which contributes least to the
+		hypervolume of those remaining.  Vectors which
+		dominate no volume are discarded first.  Ties are
+		broken by discarding the vector with the greatest
+		subscript.
+		Removing a vector can never reduce the contributions
+		of the others, so the contributions are kept in a
+		min-heap and only recalculated when they reach the
+		top of the heap.  A recalculated contribution at the
+		top of the heap is the least, so only the vectors
+		near the one removed are usually recalculated.
+  parameters:	double **fitvectors	The fitness vectors.
+		const int num		Number of fitness vectors.
+		const int num_dims	Size of the fitness vectors.
+		const double *reference	The reference point.
+		const int num_remove	Number of vectors to discard.
+		boolean *cull		Returns TRUE for each vector to discard.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+void gaul_rank_hypervolume_reduce( double **fitvectors, const int num,
+                                   const int num_dims, const double *reference,
+                                   const int num_remove, boolean *cull )
+  {
+  double	*points;	/* Relative vectors. */
+  int		*map;		/* Original subscripts of relative vectors. */
+  double	*limit;		/* Work space for limit sets. */
+  double	*exclusive;	/* Initial contributions. */
+  boolean	*live;		/* Whether each relative vector remains. */
+  int		*stamp;		/* Removals when each contribution was found. */
+  ga_pareto_key	*heap;		/* Contributions. */
+  int		n;		/* Number of relative vectors. */
+  int		size;		/* Size of heap. */
+  int		removed=0;	/* Number of vectors discarded. */
+  int		i, k;		/* Loop variables. */
+
+  for (i=0; i<num; i++)
+    cull[i] = TRUE;
+
+  n = gaul_hv_prepare(fitvectors, num, num_dims, reference, &points, &map);
+
+  for (k=0; k<n; k++)
+    cull[map[k]] = FALSE;
+
+/* Vectors which dominate no volume are discarded first. */
+  for (i=num-1; i>=0; i--)
+    {
+    if (cull[i])
+      {
+      if (removed < num_remove)
+        removed++;
+      else
+        cull[i] = FALSE;
+      }
+    }
+
+  if (removed < num_remove)
+    {
+    if ( !(limit = s_malloc(sizeof(double)*num_dims*n)) )
+      die("Unable to allocate memory");
+    if ( !(live = s_malloc(sizeof(boolean)*n)) )
+      die("Unable to allocate memory");
+    if ( !(stamp = s_malloc(sizeof(int)*n)) )
+      die("Unable to allocate memory");
+    if ( !(heap = s_malloc(sizeof(ga_pareto_key)*n)) )
+      die("Unable to allocate memory");
+
+    if ( !(exclusive = s_malloc(sizeof(double)*n)) )
+      die("Unable to allocate memory");
+
+    gaul_hv_contributions(points, n, num_dims, limit, exclusive);
+
+    for (k=0; k<n; k++)
+      {
+      live[k] = TRUE;
+      stamp[k] = removed;
+      heap[k].value = exclusive[k];
+      heap[k].index = k;
+      }
+
+    s_free(exclusive);
+
+    size = n;
+    for (i=size/2-1; i>=0; i--)
+      gaul_hv_heap_down(heap, size, i, map);
+
+    while (removed < num_remove)
+      {
+      k = heap[0].index;
+
+      if (stamp[k] == removed)
+        {
+        live[k] = FALSE;
+        cull[map[k]] = TRUE;
+        removed++;
+        heap[0] = heap[--size];
+        }
+      else
+        {
+        heap[0].value = gaul_hv_exclusive(points, n, num_dims, k, live, limit);
+        stamp[k] = removed;
+        }
+
+      gaul_hv_heap_down(heap, size, 0, map);
+      }
+
+    s_free(heap);
+    s_free(stamp);
+    s_free(live);
+    s_free(limit);
+    }
+
+  s_free(map);
+  s_free(points);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_rank_hypervolume_reference()
+  synopsis:	Find the reference point for a population's
+		hypervolume calculations.  Unless one has been set
+		with ga_population_set_hypervolume_reference(), this
+		is the worst value along each dimension, less one,
+		as for SMS-EMOA.
+  parameters:	population *pop
+		double **fitvectors	The fitness vectors.
+		const int num		Number of fitness vectors.
+		double *reference	Returns the reference point.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+void gaul_rank_hypervolume_reference( population *pop, double **fitvectors,
+                                      const int num, double *reference )
+  {
+  int		i, d;		/* Loop variables. */
+
+  if (pop->hypervolume_reference)
+    {
+    memcpy(reference, pop->hypervolume_reference, sizeof(double)*pop->fitness_dimensions);
+    return;
+    }
+
+  for (d=0; d<pop->fitness_dimensions; d++)
+    {
+    reference[d] = num>0?fitvectors[0][d]:0.0;
+    for (i=1; i<num; i++)
+      if (fitvectors[i][d] < reference[d]) reference[d] = fitvectors[i][d];
+    reference[d] -= 1.0;
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_hypervolume()
+  synopsis:	Hypervolume indicator of a set of fitness vectors.
+		This is the volume of the region which they dominate,
+		bounded by a reference point.  Larger fitness values
+		are better, so the reference point should be less
+		than every vector along each dimension.  The
+		vectors need not be mutually non-dominated.
+		Exact sweeps are used for two and three dimensions,
+		taking O(n log n) time, and the WFG algorithm for
+		more dimensions.
+  parameters:	double **fitvectors	The fitness vectors.
+		const int num		Number of fitness vectors.
+		const int num_dims	Size of the fitness vectors.
+		const double *reference	The reference point.
+  return:	Hypervolume.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC double ga_hypervolume( double **fitvectors, const int num,
+                                const int num_dims, const double *reference )
+  {
+  double	*points;	/* Relative vectors. */
+  int		*map;		/* Original subscripts of relative vectors. */
+  int		n;		/* Number of relative vectors. */
+  double	vol;		/* The hypervolume. */
+
+  if (!fitvectors && num > 0) die("Null pointer to fitness vectors passed.");
+  if (!reference) die("Null pointer to reference point passed.");
+  if (num_dims < 1) die("Invalid number of dimensions.");
+
+  n = gaul_hv_prepare(fitvectors, num, num_dims, reference, &points, &map);
+  vol = gaul_hv_sorted(points, n, num_dims);
+
+  s_free(map);
+  s_free(points);
+
+  return vol;
+  }
+
+
+/**********************************************************************
+  ga_hypervolume_contributions()
+  synopsis:	Exclusive hypervolume contribution of each of a set
+		of fitness vectors.  This is the hypervolume which
+		would be lost by removing that vector alone.  In up
+		to three dimensions, all of the contributions are
+		found by a single sweep, taking O(n log n) time in
+		total.  Otherwise, each is found as the volume
+		dominated by the vector, less the hypervolume of its
+		limit set.
+  parameters:	double **fitvectors	The fitness vectors.
+		const int num		Number of fitness vectors.
+		const int num_dims	Size of the fitness vectors.
+		const double *reference	The reference point.
+		double *contribution	Returns the contribution of each vector.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_hypervolume_contributions( double **fitvectors, const int num,
+                                            const int num_dims,
+                                            const double *reference,
+                                            double *contribution )
+  {
+  double	*points;	/* Relative vectors. */
+  int		*map;		/* Original subscripts of relative vectors. */
+  double	*limit;		/* Work space for limit sets. */
+  double	*exclusive;	/* Contributions of relative vectors. */
+  int		n;		/* Number of relative vectors. */
+  int		i, k;		/* Loop variables. */
+
+  if (!fitvectors && num > 0) die("Null pointer to fitness vectors passed.");
+  if (!reference) die("Null pointer to reference point passed.");
+  if (!contribution && num > 0) die("Null pointer to contributions passed.");
+  if (num_dims < 1) die("Invalid number of dimensions.");
+
+  for (i=0; i<num; i++)
+    contribution[i] = 0.0;
+
+  n = gaul_hv_prepare(fitvectors, num, num_dims, reference, &points, &map);
+
+  if ( !(limit = s_malloc(sizeof(double)*num_dims*(n+1))) )
+    die("Unable to allocate memory");
+  if ( !(exclusive = s_malloc(sizeof(double)*(n+1))) )
+    die("Unable to allocate memory");
+
+  gaul_hv_contributions(points, n, num_dims, limit, exclusive);
+
+  for (k=0; k<n; k++)
+    contribution[map[k]] = exclusive[k];
+
+  s_free(exclusive);
+  s_free(limit);
+  s_free(map);
+  s_free(points);
+
+  return;
+  }
+
+
+/**********************************************************************
+  ga_population_set_hypervolume_reference()
+  synopsis:	Set the reference point for a population's
+		hypervolume calculations.  This is required by
+		ga_population_hypervolume(), so that values are
+		comparable between generations.  Otherwise, the
+		GA_ELITISM_HYPERVOLUME_SURVIVE elitism mode and
+		ga_replace_by_hypervolume() use the worst value along
+		each dimension, less one.  Pass NULL to revert to
+		that.
+  parameters:	population *pop
+		const double *reference	The reference point, or NULL.
+  return:	success
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC boolean ga_population_set_hypervolume_reference( population *pop,
+                                                  const double *reference )
+  {
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+  if ( pop->fitness_dimensions < 1 ) die("Population has no fitness vectors.");
+
+  if (!reference)
+    {
+    if (pop->hypervolume_reference) s_free(pop->hypervolume_reference);
+    pop->hypervolume_reference = NULL;
+    return TRUE;
+    }
+
+  if ( !pop->hypervolume_reference &&
+       !(pop->hypervolume_reference = s_malloc(sizeof(double)*pop->fitness_dimensions)) )
+    die("Unable to allocate memory");
+
+  memcpy(pop->hypervolume_reference, reference, sizeof(double)*pop->fitness_dimensions);
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  ga_population_hypervolume()
+  synopsis:	Hypervolume indicator of the evaluated entities in a
+		population, with respect to its reference point.
+		This is suitable for monitoring the convergence of
+		a multiobjective optimisation, from the generation
+		hook for example.
+  parameters:	population *pop
+  return:	Hypervolume.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC double ga_population_hypervolume(population *pop)
+  {
+  double	**fitvectors;	/* The fitness vectors. */
+  int		i, n=0;		/* Loop variables. */
+  double	vol;		/* The hypervolume. */
+
+  if ( !pop ) die("Null pointer to population structure passed.");
+  if ( !pop->hypervolume_reference ) die("Population has no hypervolume reference point.");
+
+  if ( !(fitvectors = s_malloc(sizeof(double *)*(pop->size+1))) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<pop->size; i++)
+    {
+    if ( pop->entity_iarray[i]->fitvector &&
+         pop->entity_iarray[i]->fitness != GA_MIN_FITNESS )
+      fitvectors[n++] = pop->entity_iarray[i]->fitvector;
+    }
+
+  vol = ga_hypervolume(fitvectors, n, pop->fitness_dimensions,
+                       pop->hypervolume_reference);
+
+  s_free(fitvectors);
+
+  return vol;
+  }
@@ -38,48 +38,252 @@
 
 #include "gaul/ga_core.h"
 
+/*
+ * Ordering of the replacement heap.  The least fit entity is at the
+ * top, and ties are broken in favour of the most recent insertion,
+ * which is the entity that a sorted population would hold last.
+ */
+#define GA_HEAP_WORSE(a, b)	( (a)->fitness < (b)->fitness || \
+                                  ( (a)->fitness == (b)->fitness && \
+                                    (a)->birth > (b)->birth ) )
+
+/**********************************************************************
+  gaul_replace_heap_place()
+  synopsis:	Store an entity in the replacement heap.
+  parameters:	population *pop
+		entity *e
+		const int pos	Heap position.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void gaul_replace_heap_place(population *pop, entity *e, const int pos)
+  {
+  pop->replace_heap[pos] = e;
+  e->heap_pos = pos;
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_replace_heap_up()
+  synopsis:	Sift an entity towards the top of the replacement heap.
+  parameters:	population *pop
+		int pos		Heap position of the entity.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void gaul_replace_heap_up(population *pop, int pos)
+  {
+  entity	*e=pop->replace_heap[pos];	/* Entity being sifted. */
+  int		parent;				/* Heap position of parent. */
+
+  while (pos > 0)
+    {
+    parent = (pos-1)/2;
+    if (!GA_HEAP_WORSE(e, pop->replace_heap[parent])) break;
+    gaul_replace_heap_place(pop, pop->replace_heap[parent], pos);
+    pos = parent;
+    }
+
+  gaul_replace_heap_place(pop, e, pos);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_replace_heap_down()
+  synopsis:	Sift an entity towards the bottom of the replacement
+		heap.
+  parameters:	population *pop
+		int pos		Heap position of the entity.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void gaul_replace_heap_down(population *pop, int pos)
+  {
+  entity	*e=pop->replace_heap[pos];	/* Entity being sifted. */
+  int		child;				/* Heap position of worse child. */
+
+  while ((child = 2*pos+1) < pop->replace_heap_size)
+    {
+    if ( child+1 < pop->replace_heap_size &&
+         GA_HEAP_WORSE(pop->replace_heap[child+1], pop->replace_heap[child]) )
+      child++;
+    if (!GA_HEAP_WORSE(pop->replace_heap[child], e)) break;
+    gaul_replace_heap_place(pop, pop->replace_heap[child], pos);
+    pos = child;
+    }
+
+  gaul_replace_heap_place(pop, e, pos);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_replace_heap_build()
+  synopsis:	Index the sorted population with a replacement heap,
+		so that ga_replace_by_fitness() needs O(log n) time
+		rather than O(n) time.  While the heap is in use,
+		entity_iarray[] is only sorted when ranks are
+		requested.  The population must have been sorted.
+  parameters:	population *pop
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_replace_heap_build(population *pop)
+  {
+  int		i;		/* Loop over entities. */
+
+  gaul_replace_heap_free(pop);
+
+  if ( !(pop->replace_heap = s_malloc(sizeof(entity *)*pop->max_size)) )
+    die("Unable to allocate memory");
+
+  pop->replace_heap_size = pop->size;
+  pop->replace_heap_births = pop->size;
+
+  for (i=0; i<pop->size; i++)
+    {
+    pop->entity_iarray[i]->birth = i;
+    gaul_replace_heap_place(pop, pop->entity_iarray[i], i);
+    }
+
+  for (i=pop->size/2-1; i>=0; i--)
+    gaul_replace_heap_down(pop, i);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_replace_heap_free()
+  synopsis:	Stop using the replacement heap.  Any pending sort
+		of entity_iarray[] should be performed first.
+  parameters:	population *pop
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_replace_heap_free(population *pop)
+  {
+  int		i;		/* Loop over heap. */
+
+  if (!pop->replace_heap) return;
+
+  for (i=0; i<pop->replace_heap_size; i++)
+    pop->replace_heap[i]->heap_pos = -1;
+
+  s_free(pop->replace_heap);
+  pop->replace_heap = NULL;
+  pop->replace_heap_size = 0;
+  pop->unsorted = 0;
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_replace_heap_remove()
+  synopsis:	Remove an entity from the replacement heap.  This
+		is needed if something other than
+		ga_replace_by_fitness() kills an established entity.
+  parameters:	population *pop
+		entity *dying
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_replace_heap_remove(population *pop, entity *dying)
+  {
+  int		pos=dying->heap_pos;	/* Heap position of dying entity. */
+  entity	*last;			/* Entity filling the gap. */
+
+  dying->heap_pos = -1;
+  pop->replace_heap_size--;
+
+  if (pos == pop->replace_heap_size) return;
+
+  last = pop->replace_heap[pop->replace_heap_size];
+  gaul_replace_heap_place(pop, last, pos);
+
+  if (pos > 0 && GA_HEAP_WORSE(last, pop->replace_heap[(pos-1)/2]))
+    gaul_replace_heap_up(pop, pos);
+  else
+    gaul_replace_heap_down(pop, pos);
+
+  return;
+  }
+
+
 /**********************************************************************
   ga_replace_by_fitness()
   synopsis:	Replace by fitness.  (i.e. New entity gets inserted
 		into population, according to fitness, and least fit
 		entity dies.)
+		During ga_evolution_steady_state(), the least fit
+		entity is found from the replacement heap, and
+		entity_iarray[] is sorted later, on demand.
   parameters:
   return:
-  last updated: 11 Apr 2002
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC void ga_replace_by_fitness(population *pop, entity *child)
   {
   int		i, j;		/* Loop over entities. */
-  entity	*tmp;		/* For swapping. */
+  entity	*worst;		/* Least fit established entity. */
 
   /* Find child's current rank, which will be somewhere near the bottom. */
-  i=pop->size;
-  do
-    {
-    i--;
-    } while (i>=pop->orig_size && !(child == pop->entity_iarray[i]));
+  i = gaul_entity_position(pop, child);
 
   if (i<pop->orig_size) die("Dodgy replacement requested.");
 
+  if (pop->replace_heap && pop->replace_heap_size == pop->orig_size)
+    {
+    worst = pop->replace_heap[0];
+
+    if (child->fitness >= worst->fitness)
+      {
+      /* Child takes the place of the least fit entity. */
+      j = gaul_entity_position(pop, worst);
+      gaul_entity_swap_rank(pop, j, i);
+
+      worst->heap_pos = -1;
+      child->birth = pop->replace_heap_births++;
+      gaul_replace_heap_place(pop, child, 0);
+      gaul_replace_heap_down(pop, 0);
+
+      pop->unsorted++;
+      }
+
+    /* Kill off child/replaced entity. */
+    ga_entity_dereference_by_rank(pop, i);
+
+    return;
+    }
+
+  sort_population_on_demand(pop);
+
   if (child->fitness >= pop->entity_iarray[pop->orig_size-1]->fitness)
     {
-    tmp = pop->entity_iarray[pop->orig_size-1];
-    pop->entity_iarray[pop->orig_size-1] = pop->entity_iarray[i];
-    pop->entity_iarray[i] = tmp;
+    gaul_entity_swap_rank(pop, pop->orig_size-1, i);
 
     /* Shuffle entity to rightful location. */
     j = pop->orig_size-1;
     while (j>0 && pop->entity_iarray[j]->fitness > pop->entity_iarray[j-1]->fitness)
       {
-      tmp = pop->entity_iarray[j];
-      pop->entity_iarray[j] = pop->entity_iarray[j-1];
-      pop->entity_iarray[j-1] = tmp;
+      gaul_entity_swap_rank(pop, j, j-1);
       j--;
       }
 
-    /* Rank of replaced entity. */
-    i = pop->orig_size-1;
+    /* The replaced entity now holds the child's old rank, i. */
     }
 
   /* Kill off child/replaced entity. */
@@ -89,3 +293,110 @@ GAULFUNC void ga_replace_by_fitness(population *pop, entity *child)
   }
 
 
+
+
+/**********************************************************************
+  ga_replace_by_hypervolume()
+  synopsis:	Replace by hypervolume contribution, as in the
+		steady-state SMS-EMOA.  The child and the established
+		entities are sorted into Pareto fronts, and the member
+		of the worst front which contributes least to that
+		front's hypervolume dies.  The child dies if it ties
+		with an established entity.  The reference point is
+		set by ga_population_set_hypervolume_reference(), or
+		else is the worst value along each dimension, less
+		one.  This requires fitness vectors.
+  parameters:
+  return:
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void ga_replace_by_hypervolume(population *pop, entity *child)
+  {
+  int		i, j;		/* Loop over entities. */
+  int		num;		/* Number of candidates. */
+  int		num_dims;	/* Size of fitness vectors. */
+  double	**fitvectors;	/* Candidates' fitness vectors, child last. */
+  int		*front;		/* Front of each candidate. */
+  int		num_fronts;	/* Number of fronts. */
+  double	**members;	/* Fitness vectors of the worst front. */
+  int		*rank;		/* Ranks of the worst front's members. */
+  boolean	*cull;		/* Which member dies. */
+  double	*reference;	/* Reference point. */
+  int		n=0;		/* Size of worst front. */
+  int		victim;		/* Rank of entity to die. */
+
+  /* Find child's current rank, which will be somewhere near the bottom. */
+  i = gaul_entity_position(pop, child);
+
+  if (i<pop->orig_size) die("Dodgy replacement requested.");
+  if (pop->fitness_dimensions < 1) die("Population has no fitness vectors.");
+
+  if (child->fitness == GA_MIN_FITNESS)
+    {
+    ga_entity_dereference_by_rank(pop, i);
+    return;
+    }
+
+  num_dims = pop->fitness_dimensions;
+  num = pop->orig_size+1;
+
+  if ( !(fitvectors = s_malloc(sizeof(double *)*num)) )
+    die("Unable to allocate memory");
+  if ( !(members = s_malloc(sizeof(double *)*num)) )
+    die("Unable to allocate memory");
+  if ( !(front = s_malloc(sizeof(int)*num)) )
+    die("Unable to allocate memory");
+  if ( !(rank = s_malloc(sizeof(int)*num)) )
+    die("Unable to allocate memory");
+  if ( !(cull = s_malloc(sizeof(boolean)*num)) )
+    die("Unable to allocate memory");
+  if ( !(reference = s_malloc(sizeof(double)*num_dims)) )
+    die("Unable to allocate memory");
+
+  for (j=0; j<pop->orig_size; j++)
+    fitvectors[j] = pop->entity_iarray[j]->fitvector;
+  fitvectors[pop->orig_size] = child->fitvector;
+
+  for (j=0; j<num; j++)
+    if (!fitvectors[j]) die("Entity has no fitness vector.");
+
+  num_fronts = gaul_rank_pareto_fronts(fitvectors, num, num_dims, front, NULL);
+
+  for (j=0; j<num; j++)
+    {
+    if (front[j] == num_fronts-1)
+      {
+      members[n] = fitvectors[j];
+      rank[n] = j<pop->orig_size?j:i;
+      n++;
+      }
+    }
+
+  victim = rank[n-1];
+  if (n > 1)
+    {
+    gaul_rank_hypervolume_reference(pop, fitvectors, num, reference);
+    gaul_rank_hypervolume_reduce(members, n, num_dims, reference, 1, cull);
+    for (j=0; j<n; j++)
+      if (cull[j]) victim = rank[j];
+    }
+
+  s_free(reference);
+  s_free(cull);
+  s_free(rank);
+  s_free(front);
+  s_free(members);
+  s_free(fitvectors);
+
+  if (victim != i)
+    {
+    gaul_entity_swap_rank(pop, victim, i);
+    pop->unsorted++;
+    }
+
+  /* Kill off child/replaced entity. */
+  ga_entity_dereference_by_rank(pop, i);
+
+  return;
+  }
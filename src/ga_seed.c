@@ -205,13 +205,12 @@ GAULFUNC boolean ga_seed_char_random(population *pop, entity *adam)
   parameters:	population *pop
 		entity *adam
   return:	success
-  last updated: 16/06/01
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_seed_double_random(population *pop, entity *adam)
   {
   int		chromo;		/* Index of chromosome to seed */
-  int		point;		/* Index of allele to seed */
 
 /* Checks. */
   if (!pop) die("Null pointer to population structure passed.");
@@ -220,11 +219,9 @@ GAULFUNC boolean ga_seed_double_random(population *pop, entity *adam)
 /* Seeding. */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
-      {
-      ((double *)adam->chromosome[chromo])[point] =
-        random_double_range(pop->allele_min_double,pop->allele_max_double);
-      }
+    random_fill_double_range((double *)adam->chromosome[chromo],
+                             pop->len_chromosomes,
+                             pop->allele_min_double, pop->allele_max_double);
     }
 
   return TRUE;
@@ -239,13 +236,12 @@ GAULFUNC boolean ga_seed_double_random(population *pop, entity *adam)
   parameters:	population *pop
 		entity *adam
   return:	success
-  last updated: 02 Jul 2003
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_seed_double_random_unit_gaussian(population *pop, entity *adam)
   {
   int		chromo;		/* Index of chromosome to seed */
-  int		point;		/* Index of allele to seed */
 
 /* Checks. */
   if (!pop) die("Null pointer to population structure passed.");
@@ -254,10 +250,8 @@ GAULFUNC boolean ga_seed_double_random_unit_gaussian(population *pop, entity *ad
 /* Seeding. */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
-      {
-      ((double *)adam->chromosome[chromo])[point] = random_unit_gaussian();
-      }
+    random_fill_unit_gaussian((double *)adam->chromosome[chromo],
+                              pop->len_chromosomes);
     }
 
   return TRUE;
@@ -330,13 +324,12 @@ GAULFUNC boolean ga_seed_printable_random(population *pop, entity *adam)
   parameters:	population *pop
 		entity *adam
   return:	success
-  last updated: 30/06/01
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_seed_bitstring_random(population *pop, entity *adam)
   {
   int		chromo;		/* Index of chromosome to seed */
-  int		point;		/* Index of allele to seed */
 
 /* Checks. */
   if (!pop) die("Null pointer to population structure passed.");
@@ -345,10 +338,8 @@ GAULFUNC boolean ga_seed_bitstring_random(population *pop, entity *adam)
 /* Seeding. */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
-      {
-      ga_bit_randomize(adam->chromosome[chromo],point);
-      }
+    random_fill_bitmask((gaulbyte *)adam->chromosome[chromo],
+                        pop->len_chromosomes, 0.5);
     }
 
   return TRUE;
@@ -361,13 +352,12 @@ GAULFUNC boolean ga_seed_bitstring_random(population *pop, entity *adam)
   parameters:	population *pop
 		entity *adam
   return:	success
-  last updated: 10 Aug 2004
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_seed_bitstring_zero(population *pop, entity *adam)
   {
   int		chromo;		/* Index of chromosome to seed */
-  int		point;		/* Index of allele to seed */
 
 /* Checks. */
   if (!pop) die("Null pointer to population structure passed.");
@@ -376,10 +366,7 @@ GAULFUNC boolean ga_seed_bitstring_zero(population *pop, entity *adam)
 /* Seeding. */
   for (chromo=0; chromo<pop->num_chromosomes; chromo++)
     {
-    for (point=0; point<pop->len_chromosomes; point++)
-      {
-      ga_bit_clear(adam->chromosome[chromo],point);
-      }
+    ga_bit_clear_range(adam->chromosome[chromo], 0, pop->len_chromosomes);
     }
 
   return TRUE;
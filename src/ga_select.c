@@ -146,6 +146,185 @@ static double gaul_select_sum_sq_fitness( population *pop )
   }
 
 
+/**********************************************************************
+  gaul_select_min_fitness()
+  synopsis:	Determine lowest entity fitness.
+  parameters:	population *pop
+  return:	double minimum
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static double gaul_select_min_fitness( population *pop )
+  {
+  int           i;		/* Loop over all entities. */
+  double        minval;		/* Lowest fitness. */
+
+  minval = pop->entity_iarray[0]->fitness;
+
+  for (i=1; i<pop->orig_size; i++)
+    {
+    if (pop->entity_iarray[i]->fitness < minval)
+      minval = pop->entity_iarray[i]->fitness;
+    }
+
+  return minval;
+  }
+
+
+/**********************************************************************
+  gaul_select_alias_build()
+  synopsis:	Build a Walker alias table for the roulette wheel,
+		using Vose's O(n) construction.  Entity i is drawn
+		with probability proportional to its fitness minus
+		offset.  Negative weights are treated as zero, and
+		if no entity has a positive weight the draws are
+		uniform.  The table only depends upon the first
+		pop->orig_size entities, and it isn't modified by
+		gaul_select_alias_draw(), so a table may be shared
+		by any number of concurrent draws.
+  parameters:	population *pop
+		const double offset	Subtracted from each fitness.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void gaul_select_alias_build( population *pop, const double offset )
+  {
+  int		n=pop->orig_size;	/* Size of table. */
+  double	*prob;			/* Probability of keeping each slot. */
+  int		*alias;			/* Alternative for each slot. */
+  int		*work;			/* Small slots from the front, large from the back. */
+  int		num_small=0, large=n;	/* Stack extents in work[]. */
+  int		i, s, l;		/* Loop variable, small and large slots. */
+  double	sum=0.0;		/* Total weight. */
+
+  if (pop->selectdata.alias_max < n)
+    {
+    if (pop->selectdata.alias_prob)
+      {
+      s_free(pop->selectdata.alias_prob);
+      s_free(pop->selectdata.alias_index);
+      }
+    if ( !(pop->selectdata.alias_prob = s_malloc(sizeof(double)*n)) )
+      die("Unable to allocate memory");
+    if ( !(pop->selectdata.alias_index = s_malloc(sizeof(int)*n)) )
+      die("Unable to allocate memory");
+    pop->selectdata.alias_max = n;
+    }
+
+  prob = pop->selectdata.alias_prob;
+  alias = pop->selectdata.alias_index;
+
+  for (i=0; i<n; i++)
+    {
+    prob[i] = pop->entity_iarray[i]->fitness-offset;
+    if (!(prob[i] > 0.0)) prob[i] = 0.0;
+    sum += prob[i];
+    alias[i] = i;
+    }
+
+  if (!(sum > 0.0 && sum <= DBL_MAX))
+    { /* Nothing to distinguish the entities. */
+    for (i=0; i<n; i++)
+      prob[i] = 1.0;
+    return;
+    }
+
+  if ( !(work = s_malloc(sizeof(int)*n)) )
+    die("Unable to allocate memory");
+
+  for (i=0; i<n; i++)
+    {
+    prob[i] *= n/sum;
+    if (prob[i] < 1.0)
+      work[num_small++] = i;
+    else
+      work[--large] = i;
+    }
+
+/*
+ * Pair each under-full slot with an over-full one, which donates
+ * the shortfall and may itself become under-full.
+ */
+  while (num_small > 0 && large < n)
+    {
+    s = work[--num_small];
+    l = work[large];
+    alias[s] = l;
+    prob[l] = (prob[l]+prob[s])-1.0;
+    if (prob[l] < 1.0)
+      {
+      large++;
+      work[num_small++] = l;
+      }
+    }
+
+/* Anything left over is full, give or take rounding errors. */
+  while (num_small > 0)
+    prob[work[--num_small]] = 1.0;
+  while (large < n)
+    prob[work[large++]] = 1.0;
+
+  s_free(work);
+
+  return;
+  }
+
+
+/**********************************************************************
+  gaul_select_alias_draw()
+  synopsis:	Spin the roulette wheel, in O(1) time, using the
+		alias table from gaul_select_alias_build().
+  parameters:	population *pop
+  return:	entity *	Selected entity.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static entity *gaul_select_alias_draw( population *pop )
+  {
+  int		i;		/* Slot. */
+
+  i = random_int(pop->orig_size);
+
+  if (random_unit_uniform() >= pop->selectdata.alias_prob[i])
+    i = pop->selectdata.alias_index[i];
+
+  return pop->entity_iarray[i];
+  }
+
+
+/**********************************************************************
+  gaul_select_free()
+  synopsis:	Release memory held by the built-in selection
+		operators.
+  parameters:	population *pop
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+void gaul_select_free( population *pop )
+  {
+
+  if (pop->selectdata.permutation)
+    {
+    s_free(pop->selectdata.permutation);
+    pop->selectdata.permutation = NULL;
+    }
+
+  if (pop->selectdata.alias_prob)
+    {
+    s_free(pop->selectdata.alias_prob);
+    s_free(pop->selectdata.alias_index);
+    pop->selectdata.alias_prob = NULL;
+    pop->selectdata.alias_index = NULL;
+    }
+
+  pop->selectdata.alias_max = 0;
+
+  return;
+  }
+
+
 /**********************************************************************
   ga_select_one_random()
   synopsis:	Select a single random entity.  Selection stops when
@@ -270,7 +449,7 @@ GAULFUNC boolean ga_select_two_every(population *pop, entity **mother, entity **
   synopsis:	Select a single entity by my rank-based method.
   parameters:
   return:	
-  last updated: 23/04/01
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_one_randomrank(population *pop, entity **mother)
@@ -278,6 +457,8 @@ GAULFUNC boolean ga_select_one_randomrank(population *pop, entity **mother)
 
   if (!pop) die("Null pointer to population structure passed.");
 
+  sort_population_on_demand(pop);
+
   pop->select_state++;
 
   *mother = NULL;
@@ -303,7 +484,7 @@ GAULFUNC boolean ga_select_one_randomrank(population *pop, entity **mother)
 		paired with a random, fitter, partner.
   parameters:
   return:	
-  last updated: 23/04/01
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_two_randomrank(population *pop, entity **mother, entity **father)
@@ -311,6 +492,8 @@ GAULFUNC boolean ga_select_two_randomrank(population *pop, entity **mother, enti
 
   if (!pop) die("Null pointer to population structure passed.");
 
+  sort_population_on_demand(pop);
+
   pop->select_state++;
 
   *mother = NULL;
@@ -513,16 +696,17 @@ GAULFUNC boolean ga_select_two_bestof2(population *pop, entity **mother, entity
 		pop->orig_size times, which matches Holland's original
 		implementation.
 		This version is for fitness values where 0.0 is bad and
-		large positive values are good.  Negative values will
-		severely mess-up the algorithm.
+		large positive values are good.  Negative values are
+		treated as zero.
+		Each spin takes O(1) time, using a Walker alias table
+		built on the first call of each generation.
   parameters:
   return:	
-  last updated: 28 Jun 2004
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_one_roulette(population *pop, entity **mother)
   {
-  double	selectval;		/* Select when this reaches zero. */
 
   if (!pop) die("Null pointer to population structure passed.");
 
@@ -536,28 +720,13 @@ GAULFUNC boolean ga_select_one_roulette(population *pop, entity **mother)
 
   if (pop->select_state == 0)
     { /* First call of this generation. */
-    gaul_select_stats(pop, &(pop->selectdata.mean), &(pop->selectdata.stddev), &(pop->selectdata.sum));
-    pop->selectdata.current_expval = pop->selectdata.sum/pop->selectdata.mean;
-    pop->selectdata.marker = random_int(pop->orig_size);
+    gaul_select_alias_build(pop, 0.0);
     }
 
-  selectval = random_double(pop->selectdata.current_expval)*pop->selectdata.mean;
-
-  do
-    {
-    pop->selectdata.marker++;
-
-    if (pop->selectdata.marker >= pop->orig_size)
-      pop->selectdata.marker=0;
-
-    selectval -= pop->entity_iarray[pop->selectdata.marker]->fitness;
-
-    } while (selectval>0.0);
+  *mother = gaul_select_alias_draw(pop);
 
   pop->select_state++;
 
-  *mother = pop->entity_iarray[pop->selectdata.marker];
-
   return FALSE;
   }
 
@@ -572,14 +741,15 @@ GAULFUNC boolean ga_select_one_roulette(population *pop, entity **mother)
 		negative fitness scores.  The single least fit entity
 		will never be selected, but this is not considered a
 		problem.
+		Each spin takes O(1) time, using a Walker alias table
+		built on the first call of each generation.
   parameters:
   return:	
-  last updated: 28 Jun 2004
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_one_roulette_rebased(population *pop, entity **mother)
   {
-  double	selectval;		/* Select when this reaches zero. */
 
   if (!pop) die("Null pointer to population structure passed.");
 
@@ -594,30 +764,16 @@ GAULFUNC boolean ga_select_one_roulette_rebased(population *pop, entity **mother
   if (pop->select_state == 0)
     { /* First call of this generation. */
     gaul_select_stats(pop, &(pop->selectdata.mean), &(pop->selectdata.stddev), &(pop->selectdata.sum));
-    pop->selectdata.marker = random_int(pop->orig_size);
-    pop->selectdata.minval = pop->entity_iarray[pop->orig_size-1]->fitness;
+    pop->selectdata.minval = gaul_select_min_fitness(pop);
     pop->selectdata.mean -= pop->selectdata.minval;
     if (ISTINY(pop->selectdata.mean)) die("Degenerate population?");
-    pop->selectdata.current_expval = (pop->selectdata.sum-pop->selectdata.minval*pop->orig_size)/pop->selectdata.mean;
+    gaul_select_alias_build(pop, pop->selectdata.minval);
     }
 
-  selectval = random_double(pop->selectdata.current_expval);
-
-  do
-    {
-    pop->selectdata.marker++;
-
-    if (pop->selectdata.marker >= pop->orig_size)
-      pop->selectdata.marker=0;
-
-    selectval -= (pop->entity_iarray[pop->selectdata.marker]->fitness-pop->selectdata.minval)/pop->selectdata.mean;
-
-    } while (selectval>0.0);
+  *mother = gaul_select_alias_draw(pop);
 
   pop->select_state++;
 
-  *mother = pop->entity_iarray[pop->selectdata.marker];
-
   return FALSE;
   }
 
@@ -629,18 +785,19 @@ GAULFUNC boolean ga_select_one_roulette_rebased(population *pop, entity **mother
 		pop->orig_size times, which matches Holland's original
 		implementation.
 		This version is for fitness values where 0.0 is bad and
-		large positive values are good.  Negative values will
-		severely mess-up the algorithm.
+		large positive values are good.  Negative values are
+		treated as zero.
         Mother and father may be the same.
+		Each spin takes O(1) time, using a Walker alias table
+		built on the first call of each generation.
   parameters:
   return:	
-  last updated: 28 Jun 2004
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_two_roulette( population *pop,
                                 entity **mother, entity **father )
   {
-  double	selectval;		/* Select when this reaches zero. */
 
   if (!pop) die("Null pointer to population structure passed.");
 
@@ -655,45 +812,13 @@ GAULFUNC boolean ga_select_two_roulette( population *pop,
 
   if (pop->select_state == 0)
     { /* First call of this generation. */
-    gaul_select_stats(pop, &(pop->selectdata.mean), &(pop->selectdata.stddev), &(pop->selectdata.sum));
-    pop->selectdata.current_expval = pop->selectdata.sum/pop->selectdata.mean;
-    pop->selectdata.marker = random_int(pop->orig_size);
-/*
-printf("Mean fitness = %f stddev = %f sum = %f expval = %f\n", mean, stddev, sum, current_expval);
-*/
+    gaul_select_alias_build(pop, 0.0);
     }
 
   pop->select_state++;
 
-  selectval = random_double(pop->selectdata.current_expval)*pop->selectdata.mean;
-
-  do
-    {
-    pop->selectdata.marker++;
-
-    if (pop->selectdata.marker >= pop->orig_size)
-      pop->selectdata.marker=0;
-
-    selectval -= pop->entity_iarray[pop->selectdata.marker]->fitness;
-
-    } while (selectval>0.0);
-
-  *mother = pop->entity_iarray[pop->selectdata.marker];
-
-  selectval = random_double(pop->selectdata.current_expval)*pop->selectdata.mean;
-
-  do
-    {
-    pop->selectdata.marker++;
-
-    if (pop->selectdata.marker >= pop->orig_size)
-      pop->selectdata.marker=0;
-
-    selectval -= pop->entity_iarray[pop->selectdata.marker]->fitness;
-
-    } while (selectval>0.0);
-
-  *father = pop->entity_iarray[pop->selectdata.marker];
+  *mother = gaul_select_alias_draw(pop);
+  *father = gaul_select_alias_draw(pop);
 
   return FALSE;
   }
@@ -710,15 +835,16 @@ printf("Mean fitness = %f stddev = %f sum = %f expval = %f\n", mean, stddev, sum
 		will never be selected, but this is not considered a
 		problem.
         Mother and father may be the same.
+		Each spin takes O(1) time, using a Walker alias table
+		built on the first call of each generation.
   parameters:
   return:	
-  last updated: 28 Jun 2004
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_two_roulette_rebased( population *pop,
                                         entity **mother, entity **father )
   {
-  double	selectval;		/* Select when this reaches zero. */
 
   if (!pop) die("Null pointer to population structure passed.");
 
@@ -733,44 +859,16 @@ GAULFUNC boolean ga_select_two_roulette_rebased( population *pop,
   if (pop->select_state == 0)
     { /* First call of this generation. */
     gaul_select_stats(pop, &(pop->selectdata.mean), &(pop->selectdata.stddev), &(pop->selectdata.sum));
-    pop->selectdata.marker = random_int(pop->orig_size);
-    pop->selectdata.minval = pop->entity_iarray[pop->orig_size-1]->fitness;
+    pop->selectdata.minval = gaul_select_min_fitness(pop);
     pop->selectdata.mean -= pop->selectdata.minval;
     if (ISTINY(pop->selectdata.mean)) die("Degenerate population?");
-    pop->selectdata.current_expval = (pop->selectdata.sum-pop->selectdata.minval*pop->orig_size)/pop->selectdata.mean;
+    gaul_select_alias_build(pop, pop->selectdata.minval);
     }
 
   pop->select_state++;
 
-  selectval = random_double(pop->selectdata.current_expval);
-
-  do
-    {
-    pop->selectdata.marker++;
-
-    if (pop->selectdata.marker >= pop->orig_size)
-      pop->selectdata.marker=0;
-
-    selectval -= (pop->entity_iarray[pop->selectdata.marker]->fitness-pop->selectdata.minval)/pop->selectdata.mean;
-
-    } while (selectval>0.0);
-
-  *mother = pop->entity_iarray[pop->selectdata.marker];
-
-  selectval = random_double(pop->selectdata.current_expval);
-
-  do
-    {
-    pop->selectdata.marker++;
-
-    if (pop->selectdata.marker >= pop->orig_size)
-      pop->selectdata.marker=0;
-
-    selectval -= (pop->entity_iarray[pop->selectdata.marker]->fitness-pop->selectdata.minval)/pop->selectdata.mean;
-
-    } while (selectval>0.0);
-
-  *father = pop->entity_iarray[pop->selectdata.marker];
+  *mother = gaul_select_alias_draw(pop);
+  *father = gaul_select_alias_draw(pop);
 
   return FALSE;
   }
@@ -1069,7 +1167,7 @@ GAULFUNC boolean ga_select_two_sussq(population *pop, entity **mother, entity **
   synopsis:	Select an entity using a very aggressive procedure.
   parameters:
   return:	
-  last updated: 18 Apr 2003
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_one_aggressive(population *pop, entity **mother)
@@ -1077,6 +1175,8 @@ GAULFUNC boolean ga_select_one_aggressive(population *pop, entity **mother)
 
   if (!pop) die("Null pointer to population structure passed.");
 
+  sort_population_on_demand(pop);
+
   pop->select_state++;
 
   *mother = pop->entity_iarray[random_int(1+pop->select_state%(pop->orig_size-1))];
@@ -1091,7 +1191,7 @@ GAULFUNC boolean ga_select_one_aggressive(population *pop, entity **mother)
 		procedure.  The entities may be the same.
   parameters:
   return:	
-  last updated: 18 Apr 2003
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_two_aggressive(population *pop, entity **mother, entity **father)
@@ -1099,6 +1199,8 @@ GAULFUNC boolean ga_select_two_aggressive(population *pop, entity **mother, enti
 
   if (!pop) die("Null pointer to population structure passed.");
 
+  sort_population_on_demand(pop);
+
   pop->select_state++;
 
   *father = pop->entity_iarray[random_int(1+pop->select_state%(pop->orig_size-1))];
@@ -1113,7 +1215,7 @@ GAULFUNC boolean ga_select_two_aggressive(population *pop, entity **mother, enti
   synopsis:	Select the best entity only.
   parameters:
   return:	
-  last updated: 18 Apr 2003
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_one_best(population *pop, entity **mother)
@@ -1121,6 +1223,8 @@ GAULFUNC boolean ga_select_one_best(population *pop, entity **mother)
 
   if (!pop) die("Null pointer to population structure passed.");
 
+  sort_population_on_demand(pop);
+
   pop->select_state++;
 
   *mother = pop->entity_iarray[0];
@@ -1135,7 +1239,7 @@ GAULFUNC boolean ga_select_one_best(population *pop, entity **mother)
                 other is the best entity.
   parameters:
   return:	
-  last updated: 18 Apr 2003
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_two_best(population *pop, entity **mother, entity **father)
@@ -1143,6 +1247,8 @@ GAULFUNC boolean ga_select_two_best(population *pop, entity **mother, entity **f
 
   if (!pop) die("Null pointer to population structure passed.");
 
+  sort_population_on_demand(pop);
+
   pop->select_state++;
 
   *mother = pop->entity_iarray[random_int(pop->orig_size)];
@@ -1158,7 +1264,7 @@ GAULFUNC boolean ga_select_two_best(population *pop, entity **mother, entity **f
 		distribution with respect to rank.
   parameters:
   return:	
-  last updated: 19 Mar 2004
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_one_linearrank(population *pop, entity **mother)
@@ -1166,6 +1272,8 @@ GAULFUNC boolean ga_select_one_linearrank(population *pop, entity **mother)
 
   if (!pop) die("Null pointer to population structure passed.");
 
+  sort_population_on_demand(pop);
+
   pop->select_state++;
 
   *mother = pop->entity_iarray[(int)((1.0-sqrt(random_unit_uniform()))*pop->orig_size)];
@@ -1180,7 +1288,7 @@ GAULFUNC boolean ga_select_one_linearrank(population *pop, entity **mother)
 		distribution with respect to rank.
   parameters:
   return:	
-  last updated: 19 Mar 2004
+  last updated: 17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean ga_select_two_linearrank(population *pop, entity **mother, entity **father)
@@ -1188,6 +1296,8 @@ GAULFUNC boolean ga_select_two_linearrank(population *pop, entity **mother, enti
 
   if (!pop) die("Null pointer to population structure passed.");
 
+  sort_population_on_demand(pop);
+
   pop->select_state++;
 
   *mother = pop->entity_iarray[(int)((1.0-sqrt(random_unit_uniform()))*pop->orig_size)];
@@ -193,14 +193,12 @@ GAULFUNC void ga_genome_euclidian_similarity(population *pop, entity *alpha, ent
 		const entity *alpha	entity containing alpha chromosome.
 		const int chromosomeid	Index of chromosome to consider.
   return:	Returns number of alleles with value "1".
-  last updated:	16 May 2002
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_similarity_bitstring_count_1_alleles( const population *pop,
                                       const entity *alpha, const int chromosomeid )
   {
-  int		i;		/* Loop variable over all alleles. */
-  int		count=0;	/* Number of matching alleles. */
   gaulbyte		*a;		/* Comparison bitstring. */
 
   /* Checks. */
@@ -211,12 +209,7 @@ GAULFUNC int ga_similarity_bitstring_count_1_alleles( const population *pop,
 
   a = (gaulbyte*)(alpha->chromosome[chromosomeid]);
 
-  for ( i=0; i<pop->len_chromosomes; i++ )
-    {
-    if (ga_bit_get( a, i ) == 1) count++;
-    }
-
-  return count;
+  return ga_bit_count( a, pop->len_chromosomes );
   }
 
 
@@ -228,15 +221,13 @@ GAULFUNC int ga_similarity_bitstring_count_1_alleles( const population *pop,
 		const entity *beta	entity containing beta chromosome.
 		const int chromosomeid	Index of chromosome to consider.
   return:	Returns number of matching alleles.
-  last updated:	14 May 2002
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_similarity_bitstring_count_match_alleles( const population *pop,
                                       const entity *alpha, const entity *beta,
                                       const int chromosomeid )
   {
-  int		i;		/* Loop variable over all alleles. */
-  int		count=0;	/* Number of matching alleles. */
   gaulbyte		*a, *b;		/* Comparison bitstrings. */
 
   /* Checks. */
@@ -247,12 +238,7 @@ GAULFUNC int ga_similarity_bitstring_count_match_alleles( const population *pop,
   a = (gaulbyte*)(alpha->chromosome[chromosomeid]);
   b = (gaulbyte*)(beta->chromosome[chromosomeid]);
 
-  for ( i=0; i<pop->len_chromosomes; i++ )
-    {
-    if (ga_bit_get( a, i ) == ga_bit_get( b, i )) count++;
-    }
-
-  return count;
+  return pop->len_chromosomes - ga_bit_count_xor( a, b, pop->len_chromosomes );
   }
 
 
@@ -266,15 +252,13 @@ GAULFUNC int ga_similarity_bitstring_count_match_alleles( const population *pop,
 		const entity *beta	entity containing beta chromosome.
 		const int chromosomeid	Index of chromosome to consider.
   return:	Returns number of alleles set in both bitstrings.
-  last updated:	14 May 2002
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC int ga_similarity_bitstring_count_and_alleles( const population *pop,
                                       const entity *alpha, const entity *beta,
                                       const int chromosomeid )
   {
-  int		i;		/* Loop variable over all alleles. */
-  int		count=0;	/* Number of matching alleles. */
   gaulbyte		*a, *b;		/* Comparison bitstrings. */
 
   /* Checks. */
@@ -285,12 +269,7 @@ GAULFUNC int ga_similarity_bitstring_count_and_alleles( const population *pop,
   a = (gaulbyte*)(alpha->chromosome[chromosomeid]);
   b = (gaulbyte*)(beta->chromosome[chromosomeid]);
 
-  for ( i=0; i<pop->len_chromosomes; i++ )
-    {
-    if (ga_bit_get( a, i ) && ga_bit_get( b, i )) count++;
-    }
-
-  return count;
+  return ga_bit_count_and( a, b, pop->len_chromosomes );
   }
 
 
@@ -374,10 +374,9 @@ GAULFUNC int ga_tabu(	population		*pop,
  * Generate and score new solutions.
  */
     for (i=0; i<pop->tabu_params->search_count; i++)
-      {
       pop->mutate(pop, best, putative[i]);
-      pop->evaluate(pop, putative[i]);
-      }
+
+    ga_entity_evaluate_batch(pop, putative, pop->tabu_params->search_count);
 
 /*
  * Sort new solutions (putative[0] will have highest rank).
@@ -95,9 +95,21 @@ typedef enum ga_elitism_type_t
   GA_ELITISM_PARENTS_DIE = 3,
   GA_ELITISM_RESCORE_PARENTS = 4,
   GA_ELITISM_BEST_SET_SURVIVE = 5,
-  GA_ELITISM_PARETO_SET_SURVIVE = 6
+  GA_ELITISM_PARETO_SET_SURVIVE = 6,
+  GA_ELITISM_PARETO_FRONTS_SURVIVE = 7,
+  GA_ELITISM_HYPERVOLUME_SURVIVE = 8
   } ga_elitism_type;
 
+/*
+ * Population sorting method.
+ */
+typedef enum ga_sort_type_t
+  {
+  GA_SORT_AUTO = 0,
+  GA_SORT_SHUFFLE = 1,
+  GA_SORT_RADIX = 2
+  } ga_sort_type;
+
 /*
  * Stategies available with Differential Evolution implementation.
  */
@@ -168,6 +180,8 @@ typedef char    *(*GAchromosome_to_string)(const population *pop, const entity *
  */
 /* GAevaluate determines the fitness of an entity. */
 typedef boolean (*GAevaluate)(population *pop, entity *entity);
+/* GAevaluate_batch determines the fitnesses of an array of entities. */
+typedef boolean (*GAevaluate_batch)(population *pop, entity **entities, const int num);
 /* GAseed initialises the genomic contents of an entity. */
 typedef boolean	(*GAseed)(population *pop, entity *adam);
 /* GAadapt optimises/performs learning for an entity. */
@@ -228,8 +242,10 @@ GAULFUNC population **ga_get_all_populations(void);
 GAULFUNC boolean	ga_entity_seed(population *pop, entity *e);
 GAULFUNC boolean ga_population_seed(population *pop);
 GAULFUNC double	ga_entity_evaluate(population *pop, entity *entity);
+GAULFUNC void	ga_entity_evaluate_batch(population *pop, entity **entities, const int num);
 GAULFUNC boolean	ga_population_score_and_sort(population *pop);
 GAULFUNC boolean	ga_population_sort(population *pop);
+GAULFUNC boolean	ga_population_sort_best(population *pop, const int num_best);
 GAULFUNC int ga_get_entity_rank(population *pop, entity *e);
 GAULFUNC int ga_get_entity_id(population *pop, entity *e);
 GAULFUNC entity *ga_get_entity_from_id(population *pop, const unsigned int id);
@@ -239,9 +255,14 @@ GAULFUNC int	ga_get_entity_id_from_rank(population *pop, int rank);
 GAULFUNC boolean	ga_entity_dereference_by_rank(population *pop, int rank);
 GAULFUNC boolean ga_entity_dereference(population *p, entity *dying);
 GAULFUNC boolean ga_entity_dereference_by_id(population *pop, int id);
+GAULFUNC int	ga_entity_dereference_by_mask(population *pop, const boolean *mask);
+GAULFUNC int	ga_entity_dereference_by_rank_range(population *pop, int first, int end);
 GAULFUNC void ga_entity_clear_data(population *p, entity *entity, const int chromosome);
 GAULFUNC void ga_entity_blank(population *p, entity *entity);
 GAULFUNC entity *ga_get_free_entity(population *pop);
+GAULFUNC void ga_get_free_entities(population *pop, const int num, entity **fresh);
+GAULFUNC void ga_population_begin_magazines(population *pop, const int size);
+GAULFUNC void ga_population_end_magazines(population *pop);
 GAULFUNC boolean ga_copy_data(population *pop, entity *dest, entity *src, const int chromosome);
 GAULFUNC boolean ga_entity_copy_all_chromosomes(population *pop, entity *dest, entity *src);
 GAULFUNC boolean ga_entity_copy_chromosome(population *pop, entity *dest, entity *src, int chromo);
@@ -275,6 +296,10 @@ GAULFUNC void	ga_population_set_migration(   population            *pop,
 		                       const double          migration);
 GAULFUNC void	ga_population_set_allele_mutation_prob(   population            *pop,
 		                       const double          prob);
+GAULFUNC void	ga_population_set_reproducible(   population            *pop,
+		                       const boolean         reproducible);
+GAULFUNC void	ga_population_set_sort_type(   population            *pop,
+		                       const ga_sort_type    sort_type);
 GAULFUNC void	ga_population_set_allele_min_integer(   population            *pop,
 		                       const int          value);
 GAULFUNC void	ga_population_set_allele_max_integer(   population            *pop,
@@ -293,6 +318,7 @@ GAULFUNC double ga_population_get_allele_min_double(population       *pop);
 GAULFUNC double ga_population_get_allele_max_double(population       *pop);
 GAULFUNC ga_scheme_type ga_population_get_scheme(population       *pop);
 GAULFUNC ga_elitism_type ga_population_get_elitism(population       *pop);
+GAULFUNC ga_sort_type ga_population_get_sort_type(population       *pop);
 GAULFUNC population *ga_transcend(unsigned int id);
 GAULFUNC unsigned int ga_resurect(population *pop);
 GAULFUNC boolean ga_extinction(population *extinct);
@@ -313,6 +339,9 @@ GAULFUNC double	ga_entity_get_fitness(entity *e);
 GAULFUNC boolean	ga_entity_set_fitness(entity *e, double fitness);
 GAULFUNC int ga_population_get_fitness_dimensions(population *pop);
 GAULFUNC boolean ga_population_set_fitness_dimensions(population *pop, int num);
+GAULFUNC boolean ga_population_set_evaluate_batch(population *pop,
+                                              GAevaluate_batch evaluate_batch,
+                                              const int batch_size);
 GAULFUNC int	ga_population_get_stablesize(population *pop);
 GAULFUNC int	ga_population_get_size(population *pop);
 GAULFUNC int	ga_population_get_maxsize(population *pop);
@@ -457,6 +486,7 @@ GAULFUNC boolean	ga_seed_bitstring_zero(population *pop, entity *adam);
  * (Replacement operators)
  */
 GAULFUNC void	ga_replace_by_fitness(population *pop, entity *child);
+GAULFUNC void	ga_replace_by_hypervolume(population *pop, entity *child);
 
 /*
  * Functions located in ga_utility.c:
@@ -619,9 +649,18 @@ GAULFUNC double ga_compare_bitstring_euclidean(population *pop, entity *alpha, e
 
 /*
  * Functions located in ga_rank.c:
- * (Entity comparison functions)
+ * (Entity comparison functions, the Pareto archive and hypervolumes)
  */
 GAULFUNC int ga_rank_fitness(population *alphapop, entity *alpha, population *betapop, entity *beta);
+GAULFUNC int ga_rank_pareto(population *alphapop, entity *alpha, population *betapop, entity *beta);
+GAULFUNC boolean ga_population_set_archive(population *pop, const int max_size);
+GAULFUNC population *ga_population_get_archive(population *pop);
+GAULFUNC boolean ga_population_archive_entity(population *pop, entity *e);
+GAULFUNC int ga_population_archive_update(population *pop);
+GAULFUNC double ga_hypervolume(double **fitvectors, const int num, const int num_dims, const double *reference);
+GAULFUNC void ga_hypervolume_contributions(double **fitvectors, const int num, const int num_dims, const double *reference, double *contribution);
+GAULFUNC boolean ga_population_set_hypervolume_reference(population *pop, const double *reference);
+GAULFUNC double ga_population_hypervolume(population *pop);
 
 /**********************************************************************
  * Include remainder of this library's headers.
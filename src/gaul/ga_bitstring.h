@@ -45,6 +45,35 @@
 #include <limits.h>
 #endif
 
+/*
+ * The bitstring kernels operate on whole words, where possible.
+ */
+typedef unsigned long	ga_bit_word;
+#define GA_BIT_WORDBYTES	sizeof(ga_bit_word)
+
+/*
+ * Runtime selection of x86 popcount instructions requires GCC's
+ * target attributes and CPU detection builtins.
+ */
+#if defined(__GNUC__) && (__GNUC__ >= 5) && \
+    (defined(__x86_64__) || defined(__i386__))
+# define GA_BIT_X86_DISPATCH
+#endif
+
+/*
+ * Layout of one field of an encoded chromosome, for the bulk
+ * conversion functions.  A field is a signed mantissa, or integer,
+ * of mantissa bits followed by a signed exponent of exponent bits,
+ * or by nothing when exponent is zero.  Either part may be Gray or
+ * binary encoded.
+ */
+typedef struct
+  {
+  int		mantissa;	/* Bits in mantissa, or integer. */
+  int		exponent;	/* Bits in exponent, or zero. */
+  boolean	gray;		/* Whether Gray encoded. */
+  } ga_bit_field;
+
 /*
  * Prototypes.
  */
@@ -59,6 +88,17 @@ GAULFUNC void ga_bit_copy( gaulbyte *dest, gaulbyte *src, int ndest, int nsrc, i
 GAULFUNC size_t ga_bit_sizeof( int length );
 GAULFUNC gaulbyte *ga_bit_clone( gaulbyte *dest, gaulbyte *src, int length );
 
+/* Runs of bits. */
+GAULFUNC void ga_bit_set_range( gaulbyte *bstr, int n, int length );
+GAULFUNC void ga_bit_clear_range( gaulbyte *bstr, int n, int length );
+GAULFUNC void ga_bit_randomize_range( gaulbyte *bstr, int n, int length );
+GAULFUNC void ga_bit_blend( gaulbyte *dest, gaulbyte *alpha, gaulbyte *beta, gaulbyte *mask, int length );
+
+/* Population counts. */
+GAULFUNC int ga_bit_count( gaulbyte *bstr, int length );
+GAULFUNC int ga_bit_count_and( gaulbyte *alpha, gaulbyte *beta, int length );
+GAULFUNC int ga_bit_count_xor( gaulbyte *alpha, gaulbyte *beta, int length );
+
 /* Integer conversion. */
 GAULFUNC unsigned int ga_bit_decode_binary_uint( gaulbyte *bstr, int n, int length );
 GAULFUNC void ga_bit_encode_binary_uint( gaulbyte *bstr, int n, int length, unsigned int value );
@@ -75,6 +115,12 @@ GAULFUNC void ga_bit_encode_binary_real( gaulbyte *bstr, int n, int mantissa, in
 GAULFUNC double ga_bit_decode_gray_real( gaulbyte *bstr, int n, int mantissa, int exponent );
 GAULFUNC void ga_bit_encode_gray_real( gaulbyte *bstr, int n, int mantissa, int exponent, double value );
 
+/* Bulk conversion. */
+GAULFUNC int ga_bit_decode_real_array( gaulbyte *bstr, int n, const ga_bit_field *layout, int num_fields, double *value );
+GAULFUNC int ga_bit_encode_real_array( gaulbyte *bstr, int n, const ga_bit_field *layout, int num_fields, const double *value );
+GAULFUNC int ga_bit_decode_int_array( gaulbyte *bstr, int n, const ga_bit_field *layout, int num_fields, int *value );
+GAULFUNC int ga_bit_encode_int_array( gaulbyte *bstr, int n, const ga_bit_field *layout, int num_fields, const int *value );
+
 /* Test. */
 GAULFUNC boolean ga_bit_test( void );
 
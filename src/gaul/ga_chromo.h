@@ -89,5 +89,10 @@ GAULFUNC unsigned int ga_chromosome_list_to_bytes(const population *pop, entity
 GAULFUNC void ga_chromosome_list_from_bytes( const population *pop, entity *joe, gaulbyte *bytes );
 GAULFUNC char *ga_chromosome_list_to_string( const population *pop, const entity *joe, char *text, size_t *textlen);
 
+GAULFUNC void ga_population_set_chromosome_arena(population *pop, const boolean use_arena);
+GAULFUNC vpointer ga_population_get_chromosome_arena(population *pop, const int chromosome, int *num_ids, size_t *row_stride);
+GAULFUNC void ga_population_set_chromosome_pool_size(population *pop, const int max_buffers);
+GAULFUNC void ga_population_trim_chromosome_pool(population *pop, const int keep);
+
 #endif /* GA_CHROMO_H_INCLUDED */
 
@@ -152,8 +152,49 @@ struct entity_t
 
 /* Additional stuff for multiobjective optimisation: */
   double	*fitvector;	/* Fitness vector. */
+
+/* Position within the population, for constant time lookups: */
+  int		id;		/* Index in entity_array. */
+  int		rank;		/* Index in entity_iarray, if still current. */
+
+/* Steady-state replacement: */
+  int		heap_pos;	/* Index in the replacement heap, or -1. */
+  int		birth;		/* Order of insertion into the replacement heap. */
   };
 
+/*
+ * Chromosome arena segment.  Holds the chromosomes of the entities
+ * with ids first_id to (first_id+num_ids-1), as one matrix per
+ * chromosome, with one row per entity.
+ */
+typedef struct ga_arena_segment_t
+  {
+  int				first_id;	/* Id of first entity. */
+  int				num_ids;	/* Number of entities. */
+  vpointer			block;		/* Allocated memory. */
+  gaulbyte			*alleles;	/* Aligned start of matrices. */
+  vpointer			*views;		/* Chromosome pointers for each entity. */
+  struct ga_arena_segment_t	*next;		/* Segment for following ids. */
+  } ga_arena_segment;
+
+/*
+ * Entity magazine.  A thread's private cache of entity structures,
+ * reserved in bulk from a population, which lets it obtain and
+ * release entities without taking the population's lock.  The
+ * entities handed out are ranked by ga_population_end_magazines().
+ */
+typedef struct ga_magazine_t
+  {
+  int			num_spare;	/* Number of reserved, unused, entities. */
+  int			num_fresh;	/* Number of entities handed out. */
+  int			max_entities;	/* Allocated size of each array. */
+  entity		**spare;	/* Reserved, unused, entities. */
+  int			*spare_id;	/* Ids of the spare entities. */
+  entity		**fresh;	/* Entities handed out, not yet ranked. */
+  int			*fresh_id;	/* Ids of the fresh entities. */
+  struct ga_magazine_t	*next;		/* Next magazine of this population. */
+  } ga_magazine;
+
 /*
  * Tabu-search parameter structure.
  */
@@ -268,8 +309,38 @@ typedef struct
   int		num_to_select;		/* Number of individuals to select. */
   int		current1, current2;	/* Currently selected individuals. */
   int		*permutation;		/* Randomly ordered indices. */
+  double	*alias_prob;		/* Roulette wheel alias table; probability of keeping each slot. */
+  int		*alias_index;		/* Roulette wheel alias table; alternative for each slot. */
+  int		alias_max;		/* Allocated size of the alias table. */
   } ga_selectdata_t;
 
+/*
+ * External archive of non-dominated entities.  The archived fitness
+ * vectors are indexed by a k-d tree, in which each node records the
+ * bounding box of its subtree.  Nodes are not unlinked when their
+ * entity is removed; the tree is rebuilt from time to time instead.
+ */
+typedef struct
+  {
+  entity	*entity;	/* Archived entity, or NULL once removed. */
+  int		left, right;	/* Child nodes, or -1. */
+  int		split;		/* Dimension which partitions the children. */
+  } ga_archive_node;
+
+typedef struct
+  {
+  population		*pop;		/* Population which holds the archived entities. */
+  int			max_size;	/* Maximum number of archived entities, or 0 for no limit. */
+  int			num_dims;	/* Size of the fitness vectors. */
+  ga_archive_node	*node;		/* The k-d tree. */
+  double		*box;		/* Fitness vector, then lower and upper bounds of subtree, for each node. */
+  int			*stack;		/* Work space for tree traversal. */
+  int			root;		/* Root node, or -1. */
+  int			num_nodes;	/* Number of nodes in use. */
+  int			max_nodes;	/* Number of nodes allocated. */
+  int			num_removed;	/* Nodes whose entity has been removed. */
+  int			num_inserted;	/* Insertions since the tree was last rebuilt. */
+  } ga_archive_t;
 
 /*
  * Population Structure.
@@ -323,6 +394,10 @@ struct population_t
  * Special (aka miscellaneous) parameters.
  */
   double		allele_mutation_prob;	/* Chance for individual alleles to mutate in certain mutation operators. */
+  boolean		reproducible;		/* Whether parallel code uses counter-based random numbers. */
+  ga_sort_type		sort_type;		/* Method for sorting the population. */
+  ga_archive_t		*archive;		/* Archive of non-dominated entities, or NULL. */
+  double		*hypervolume_reference;	/* Reference point for hypervolumes, or NULL. */
 
 /*
  * Non-evolutionary parameters.
@@ -357,6 +432,8 @@ struct population_t
   GAchromosome_to_string	chromosome_to_string;
 
   GAevaluate			evaluate;
+  GAevaluate_batch		evaluate_batch;		/* Optional; used in preference to evaluate. */
+  int				evaluate_batch_size;	/* Maximum entities per evaluate_batch call, 0 for unlimited. */
   GAseed			seed;
   GAadapt			adapt;
   GAselect_one			select_one;
@@ -369,6 +446,22 @@ struct population_t
 /*
  * Memory handling.
  */
+  size_t			arena_chromosome_size;	/* Bytes per chromosome in the arena, 0 if not in use. */
+  size_t			arena_row_stride;	/* Bytes between rows of an arena matrix. */
+  ga_arena_segment		*arena;			/* Chromosome arena, allocated as required. */
+  vpointer			*chromosome_pool;	/* Spare chromosome buffers. */
+  int				chromosome_pool_size;	/* Number of spare chromosome buffers. */
+  int				chromosome_pool_max;	/* Maximum number of spare chromosome buffers. */
+  GAchromosome_constructor	chromosome_pool_constructor;	/* Constructor of the spare buffers. */
+  GAchromosome_destructor	chromosome_pool_destructor;	/* Destructor for the spare buffers. */
+  ga_magazine			*magazines;		/* Magazines of the threads using this population. */
+  int				magazine_size;		/* Entities reserved per magazine refill. */
+  int				magazine_epoch;		/* Identifies the current magazine phase, 0 if none. */
+  int				num_reserved;		/* Entities held by magazines. */
+  entity			**replace_heap;		/* Steady-state replacement heap, least fit first, or NULL. */
+  int				replace_heap_size;	/* Number of entities in the replacement heap. */
+  int				replace_heap_births;	/* Number of insertions into the replacement heap. */
+  int				unsorted;		/* Replacements since entity_iarray[] was last sorted. */
 #ifdef USE_CHROMO_CHUNKS
   MemChunk			*chromoarray_chunk;
   MemChunk			*chromo_chunk;
@@ -404,9 +497,50 @@ struct population_t
 #define GA_DEFAULT_ALLELE_MUTATION_PROB	0.02
 
 /*
- * A private prototype.
+ * Alignment, in bytes, of each row of a chromosome arena.
+ */
+#define GA_ARENA_ALIGNMENT		64
+
+/*
+ * Default number of entities reserved per entity magazine refill.
+ */
+#define GA_DEFAULT_MAGAZINE_SIZE	16
+
+/*
+ * Purposes of counter-based random number sequences, used to keep
+ * the sequences for a given entity independent.  An entity which is
+ * adapted and then evaluated in the same generation uses both
+ * GA_COUNTER_ADAPTATION and GA_COUNTER_EVALUATION.
+ */
+#define GA_COUNTER_BREEDING		0
+#define GA_COUNTER_EVALUATION		1
+#define GA_COUNTER_DE			2
+#define GA_COUNTER_ADAPTATION		3
+#define GA_NUM_COUNTER_PURPOSES		4
+
+/*
+ * Private prototypes.
  */
 boolean gaul_population_fill(population *pop, int num);
+void gaul_population_evaluate_ranks(population *pop, const int first, const int end, const boolean skip_evaluated);
+void gaul_random_counter_init(population *pop, random_counter *rc, const int index, const int purpose);
+void gaul_population_update_ranks(population *pop, const int first, const int end);
+void gaul_entity_swap_rank(population *pop, const int rank1, const int rank2);
+int gaul_entity_position(population *pop, entity *e);
+void gaul_replace_heap_build(population *pop);
+void gaul_replace_heap_free(population *pop);
+void gaul_replace_heap_remove(population *pop, entity *dying);
+void gaul_select_free(population *pop);
+int gaul_rank_pareto_fronts(double **fitvectors, const int num, const int num_dims, int *front, double *crowding);
+void gaul_rank_pareto_survivors(population *pop, const int num_survivors, boolean *cull, const boolean hypervolume);
+void gaul_rank_hypervolume_reference(population *pop, double **fitvectors, const int num, double *reference);
+void gaul_rank_hypervolume_reduce(double **fitvectors, const int num, const int num_dims, const double *reference, const int num_remove, boolean *cull);
+void gaul_archive_free(population *pop);
+vpointer *gaul_chromosome_arena_attach(population *pop, const int id);
+void gaul_chromosome_arena_free(population *pop);
+boolean gaul_chromosome_recycle(population *pop, entity *corpse);
+boolean gaul_chromosome_reuse(population *pop, entity *embryo);
+void gaul_chromosome_pool_free(population *pop);
 
 #endif	/* GA_CORE_H_INCLUDED */
 
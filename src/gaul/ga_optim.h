@@ -61,10 +61,15 @@ GAULFUNC int	ga_evolution_mpi(	population		*pop,
 			const int		max_generations );
 GAULFUNC int	ga_evolution_forked(	population		*pop,
 			const int		max_generations );
+GAULFUNC int	ga_evolution_preforked(	population		*pop,
+			const int		max_generations );
 GAULFUNC int	ga_evolution_threaded(	population		*pop,
 			const int		max_generations );
 GAULFUNC int	ga_evolution_steady_state(	population		*pop,
 			const int		max_iterations );
+GAULFUNC int	ga_evolution_steady_state_async(	population		*pop,
+			const int		max_iterations,
+			const int		max_in_flight );
 GAULFUNC int	ga_evolution_archipelago( const int num_pops,
                         population              **pops,
                         const int               max_generations );
@@ -46,10 +46,21 @@
 #define GA_QSORT_DEBUG	1
 #endif
 
+/* Populations smaller than this are shuffle sorted by default. */
+#define GA_QSORT_RADIX_MIN	64
+
+/* Up to this many steady-state replacements are sorted by insertion. */
+#define GA_QSORT_INSERTION_MAX	8
+
+/* Arrays of this many entities, or more, are sorted in parallel when OpenMP is used. */
+#define GA_QSORT_PARALLEL_MIN	131072
+
 /*
  * Private prototypes.
  */
 void	sort_population(population *pop);
+void	sort_population_best(population *pop, const int num_best);
+void	sort_population_on_demand(population *pop);
 boolean	ga_qsort_test(void);
 
 #endif	/* GA_QSORT_H_INCLUDED */
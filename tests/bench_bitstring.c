@@ -0,0 +1,596 @@
+/**********************************************************************
+  bench_bitstring.c
+ **********************************************************************
+
+  bench_bitstring - Benchmark the bitstring kernels.
+  Copyright ©2026, Stewart Adcock <stewart@linux-domain.com>
+  All rights reserved.
+
+  The latest version of this program should be available at:
+  http://gaul.sourceforge.net/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.  Alternatively, if your project
+  is incompatible with the GPL, I will probably agree to requests
+  for permission to use the terms of any other license.
+
+  This program is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY WHATSOEVER.
+
+  A full copy of the GNU General Public License should be in the file
+  "COPYING" provided with this distribution; if not, see:
+  http://www.gnu.org/
+
+ **********************************************************************
+
+  Synopsis:	Benchmark the bitstring kernels against bit-at-a-time
+		equivalents.
+
+		Every pair of entities in a population of random
+		bitstrings is compared, and the results of the
+		library similarity and comparison functions are
+		checked to be identical to those of the bit-at-a-time
+		versions.  Runs of bits are copied between random,
+		unaligned, offsets and the results are checked
+		likewise.  Uniform crossover draws different random
+		numbers in each version, so only the validity of the
+		children is checked.  Chromosomes are decoded as
+		Gray-encoded reals, field by field and in bulk, and
+		the values are checked to be identical.  Finally,
+		chromosomes of mixed fixed and floating point fields
+		are decoded, encoded and decoded again, and the
+		values are checked to be unchanged.
+
+		Timings are machine dependent, so this program is not
+		part of the regression tests run by run_tests.sh.
+
+  Usage:	bench_bitstring [num_entities] [len_chromosome]
+
+ **********************************************************************/
+
+/*
+ * Includes
+ */
+#include "gaul.h"
+
+#include <time.h>
+
+/*
+ * Benchmark parameters.
+ */
+#define BENCH_SEED	42
+#define BENCH_MANTISSA	24
+#define BENCH_EXPONENT	8
+#define BENCH_DECODES	20
+
+/**********************************************************************
+  bench_seconds()
+  synopsis:	Processor time in seconds.
+  parameters:
+  return:	double	Seconds.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_seconds(void)
+  {
+  return (double) clock() / CLOCKS_PER_SEC;
+  }
+
+
+/**********************************************************************
+  bench_tanimoto()
+  synopsis:	Tanimoto similarity, a bit at a time.
+  parameters:	population *pop
+		entity *alpha
+		entity *beta
+  return:	double	Similarity.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_tanimoto(population *pop, entity *alpha, entity *beta)
+  {
+  int		i, j;		/* Loop over chromosomes, alleles. */
+  int		a=0, b=0, n=0;	/* Bits set in alpha, beta and both. */
+  gaulbyte	*x, *y;		/* Chromosomes. */
+
+  for (i=0; i<pop->num_chromosomes; i++)
+    {
+    x = (gaulbyte *) alpha->chromosome[i];
+    y = (gaulbyte *) beta->chromosome[i];
+
+    for (j=0; j<pop->len_chromosomes; j++)
+      {
+      a += ga_bit_get(x, j);
+      b += ga_bit_get(y, j);
+      n += ga_bit_get(x, j) && ga_bit_get(y, j);
+      }
+    }
+
+  return (double) n/(a+b-n);
+  }
+
+
+/**********************************************************************
+  bench_hamming()
+  synopsis:	Hamming distance, a bit at a time.
+  parameters:	population *pop
+		entity *alpha
+		entity *beta
+  return:	double	Distance.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_hamming(population *pop, entity *alpha, entity *beta)
+  {
+  int		i, j;		/* Loop over chromosomes, alleles. */
+  int		dist=0;		/* Distance. */
+
+  for (i=0; i<pop->num_chromosomes; i++)
+    for (j=0; j<pop->len_chromosomes; j++)
+      dist += ga_bit_get((gaulbyte *) alpha->chromosome[i], j) !=
+              ga_bit_get((gaulbyte *) beta->chromosome[i], j);
+
+  return (double) dist;
+  }
+
+
+/**********************************************************************
+  bench_pairs()
+  synopsis:	Time a comparison function over every pair of
+		entities, and sum the results.
+  parameters:	population *pop
+		double (*compare)(population *, entity *, entity *)
+		double *total	Returns sum of results.
+  return:	double	Seconds taken.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_pairs(population *pop,
+                          double (*compare)(population *, entity *, entity *),
+                          double *total)
+  {
+  int		i, j;		/* Loop over entities. */
+  double	start;		/* Start time. */
+
+  *total = 0.0;
+  start = bench_seconds();
+
+  for (i=0; i<pop->size; i++)
+    for (j=0; j<i; j++)
+      *total += compare(pop, pop->entity_iarray[i], pop->entity_iarray[j]);
+
+  return bench_seconds() - start;
+  }
+
+
+/**********************************************************************
+  bench_library_tanimoto()
+  synopsis:	Wrapper for ga_similarity_bitstring_tanimoto().
+  parameters:	population *pop
+		entity *alpha
+		entity *beta
+  return:	double	Similarity.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_library_tanimoto(population *pop, entity *alpha, entity *beta)
+  {
+  return ga_similarity_bitstring_tanimoto(pop, alpha, beta);
+  }
+
+
+/**********************************************************************
+  bench_copy()
+  synopsis:	Copy a run of bits, a bit at a time.
+  parameters:	gaulbyte *dest
+		gaulbyte *src
+		int ndest
+		int nsrc
+		int length
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void bench_copy(gaulbyte *dest, gaulbyte *src, int ndest, int nsrc, int length)
+  {
+  int		i;		/* Loop over bits. */
+
+  for (i=0; i<length; i++)
+    {
+    if (ga_bit_get(src, nsrc+i))
+      ga_bit_set(dest, ndest+i);
+    else
+      ga_bit_clear(dest, ndest+i);
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  bench_copies()
+  synopsis:	Time copies of runs of bits between every pair of
+		entities, at random offsets.
+  parameters:	population *pop
+		void (*copy)(gaulbyte *, gaulbyte *, int, int, int)
+		gaulbyte *result	Returns final bitstring.
+  return:	double	Seconds taken.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_copies(population *pop,
+                           void (*copy)(gaulbyte *, gaulbyte *, int, int, int),
+                           gaulbyte *result)
+  {
+  int		i, j;		/* Loop over entities. */
+  int		length;		/* Number of bits copied. */
+  double	start;		/* Start time. */
+
+  random_seed(BENCH_SEED);
+  ga_bit_clear_range(result, 0, pop->len_chromosomes);
+
+  start = bench_seconds();
+
+  for (i=0; i<pop->size; i++)
+    {
+    for (j=0; j<i; j++)
+      {
+      length = random_int(pop->len_chromosomes);
+      copy(result, pop->entity_iarray[j]->chromosome[0],
+           random_int(pop->len_chromosomes-length),
+           random_int(pop->len_chromosomes-length), length);
+      }
+    }
+
+  return bench_seconds() - start;
+  }
+
+
+/**********************************************************************
+  bench_allele_mixing()
+  synopsis:	Uniform crossover, a bit at a time.
+  parameters:	population *pop
+		entity *father, *mother	Parent entities.
+		entity *son, *daughter	Child entities.
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void bench_allele_mixing(population *pop,
+                                entity *father, entity *mother,
+                                entity *son, entity *daughter)
+  {
+  int		i, j;		/* Loop over chromosomes, alleles. */
+
+  for (i=0; i<pop->num_chromosomes; i++)
+    {
+    for (j=0; j<pop->len_chromosomes; j++)
+      {
+      if (random_boolean())
+        {
+        bench_copy(son->chromosome[i], father->chromosome[i], j, j, 1);
+        bench_copy(daughter->chromosome[i], mother->chromosome[i], j, j, 1);
+        }
+      else
+        {
+        bench_copy(son->chromosome[i], mother->chromosome[i], j, j, 1);
+        bench_copy(daughter->chromosome[i], father->chromosome[i], j, j, 1);
+        }
+      }
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  bench_crossovers()
+  synopsis:	Time crossovers of every pair of entities, and check
+		that each pair of children has the parents' alleles.
+  parameters:	population *pop
+		GAcrossover crossover
+  return:	double	Seconds taken.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_crossovers(population *pop, GAcrossover crossover)
+  {
+  int		i, j, k;	/* Loop over entities, alleles. */
+  entity	*son, *daughter;	/* Children. */
+  entity	*father, *mother;	/* Parents. */
+  double	start, total=0.0;	/* Timings. */
+
+  son = ga_get_free_entity(pop);
+  daughter = ga_get_free_entity(pop);
+
+  for (i=0; i<pop->orig_size; i++)
+    {
+    for (j=0; j<i; j++)
+      {
+      father = pop->entity_iarray[i];
+      mother = pop->entity_iarray[j];
+
+      start = bench_seconds();
+      crossover(pop, father, mother, son, daughter);
+      total += bench_seconds() - start;
+
+      for (k=0; k<pop->len_chromosomes; k++)
+        {
+        if ( ga_bit_get(son->chromosome[0], k) + ga_bit_get(daughter->chromosome[0], k) !=
+             ga_bit_get(father->chromosome[0], k) + ga_bit_get(mother->chromosome[0], k) )
+          die("Children don't have the parents' alleles.");
+        }
+      }
+    }
+
+  ga_entity_dereference(pop, son);
+  ga_entity_dereference(pop, daughter);
+
+  return total;
+  }
+
+
+/**********************************************************************
+  bench_gray_int()
+  synopsis:	Decode a Gray-encoded signed int, a bit at a time.
+  parameters:	gaulbyte *bstr
+		int n	Initial bit index.
+		int length	Number of bits.
+  return:	int	Decoded value.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static int bench_gray_int(gaulbyte *bstr, int n, int length)
+  {
+  int		i;		/* Loop over bits. */
+  boolean	sign, bit;	/* Decoded bits. */
+  unsigned int	value=0;	/* Magnitude. */
+
+  sign = bit = ga_bit_get(bstr, n);
+  for (i=1; i<length; i++)
+    {
+    bit ^= ga_bit_get(bstr, n+i);
+    value = (value << 1) | bit;
+    }
+
+  return sign ? - (int) value : (int) value;
+  }
+
+
+/**********************************************************************
+  bench_decodes()
+  synopsis:	Time the decoding of every chromosome into reals,
+		field by field, a bit at a time, or in bulk.
+  parameters:	population *pop
+		boolean bulk	Whether to decode in bulk.
+		double *values	Returns decoded values.
+  return:	double	Seconds taken.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_decodes(population *pop, boolean bulk, double *values)
+  {
+  int		i, j, k;	/* Loop over repeats, entities, fields. */
+  int		num_fields;	/* Fields per chromosome. */
+  ga_bit_field	*layout;	/* Layout of chromosomes. */
+  gaulbyte	*bstr;		/* Chromosome. */
+  double	*v;		/* Values of current entity. */
+  int		mantissa, exponent;	/* Decoded parts of field. */
+  double	start;		/* Start time. */
+
+  num_fields = pop->len_chromosomes/(BENCH_MANTISSA+BENCH_EXPONENT);
+  layout = s_malloc(sizeof(ga_bit_field)*num_fields);
+  for (k=0; k<num_fields; k++)
+    {
+    layout[k].mantissa = BENCH_MANTISSA;
+    layout[k].exponent = BENCH_EXPONENT;
+    layout[k].gray = TRUE;
+    }
+
+  start = bench_seconds();
+
+  for (i=0; i<BENCH_DECODES; i++)
+    {
+    for (j=0; j<pop->orig_size; j++)
+      {
+      bstr = (gaulbyte *) pop->entity_iarray[j]->chromosome[0];
+      v = &(values[j*num_fields]);
+
+      if (bulk)
+        {
+        ga_bit_decode_real_array(bstr, 0, layout, num_fields, v);
+        }
+      else
+        {
+        for (k=0; k<num_fields; k++)
+          {
+          mantissa = bench_gray_int(bstr, k*(BENCH_MANTISSA+BENCH_EXPONENT),
+                                    BENCH_MANTISSA);
+          exponent = bench_gray_int(bstr, k*(BENCH_MANTISSA+BENCH_EXPONENT)+BENCH_MANTISSA,
+                                    BENCH_EXPONENT);
+          v[k] = pow(2.0, (double) exponent) *
+                 ((double) mantissa) / ((double) (1<<(BENCH_MANTISSA-1)));
+          }
+        }
+      }
+    }
+
+  start = bench_seconds() - start;
+
+  s_free(layout);
+
+  return start;
+  }
+
+
+/**********************************************************************
+  bench_roundtrips()
+  synopsis:	Time the encoding of every chromosome's decoded
+		values, and check that decoding the result gives
+		identical values.  The fields cycle through fixed
+		and floating point, binary and Gray encoded layouts.
+  parameters:	population *pop
+  return:	double	Seconds taken.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_roundtrips(population *pop)
+  {
+  static const ga_bit_field	kinds[] = {
+	{ 8, 0, FALSE }, { 8, 0, TRUE }, { 13, 0, FALSE }, { 24, 0, TRUE },
+	{ BENCH_MANTISSA, BENCH_EXPONENT, FALSE },
+	{ BENCH_MANTISSA, BENCH_EXPONENT, TRUE } };
+  int		num_kinds=(int) (sizeof(kinds)/sizeof(ga_bit_field));
+  int		j, k;		/* Loop over entities, fields. */
+  int		num_fields=0;	/* Fields per chromosome. */
+  int		length=0;	/* Bits used per chromosome. */
+  ga_bit_field	*layout;	/* Layout of chromosomes. */
+  gaulbyte	*bstr;		/* Encoded chromosome. */
+  double	*v, *w;		/* Decoded values. */
+  double	start, total=0.0;	/* Timings. */
+
+  while (length+kinds[num_fields%num_kinds].mantissa
+         +kinds[num_fields%num_kinds].exponent <= pop->len_chromosomes)
+    {
+    length += kinds[num_fields%num_kinds].mantissa
+              +kinds[num_fields%num_kinds].exponent;
+    num_fields++;
+    }
+
+  if (num_fields == 0) return 0.0;
+
+  layout = s_malloc(sizeof(ga_bit_field)*num_fields);
+  for (k=0; k<num_fields; k++)
+    layout[k] = kinds[k%num_kinds];
+
+  bstr = ga_bit_new(pop->len_chromosomes);
+  v = s_malloc(sizeof(double)*num_fields);
+  w = s_malloc(sizeof(double)*num_fields);
+
+  for (j=0; j<pop->orig_size; j++)
+    {
+    ga_bit_decode_real_array((gaulbyte *) pop->entity_iarray[j]->chromosome[0],
+                             0, layout, num_fields, v);
+
+    start = bench_seconds();
+    ga_bit_encode_real_array(bstr, 0, layout, num_fields, v);
+    total += bench_seconds() - start;
+
+    ga_bit_decode_real_array(bstr, 0, layout, num_fields, w);
+
+    for (k=0; k<num_fields; k++)
+      if (v[k] != w[k])
+        dief("Field %d (%d, %d, %s) decoded as %g, but reencoded as %g.",
+             k, layout[k].mantissa, layout[k].exponent,
+             layout[k].gray?"Gray":"binary", v[k], w[k]);
+    }
+
+  ga_bit_free(bstr);
+  s_free(w);
+  s_free(v);
+  s_free(layout);
+
+  return total;
+  }
+
+
+/**********************************************************************
+  main()
+  synopsis:	Benchmark bitstring kernels.
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+int main(int argc, char **argv)
+  {
+  int		num_entities=300;	/* Population size. */
+  int		len_chromosome=4096;	/* Bits per chromosome. */
+  population	*pop;			/* Population. */
+  int		i;			/* Loop over entities. */
+  double	t_bit, t_word;		/* Timings. */
+  double	r_bit, r_word;		/* Summed results. */
+  gaulbyte	*c_bit, *c_word;	/* Copied bits. */
+  double	*v_bit, *v_word;	/* Decoded values. */
+  size_t	num_values;		/* Number of decoded values. */
+
+  if (argc > 1) num_entities = atoi(argv[1]);
+  if (argc > 2) len_chromosome = atoi(argv[2]);
+  if (num_entities < 2 || len_chromosome < 1)
+    die("Usage: bench_bitstring [num_entities] [len_chromosome]");
+
+  random_seed(BENCH_SEED);
+
+  pop = ga_genesis_bitstring(
+       num_entities,		/* const int              population_size */
+       1,			/* const int              num_chromo */
+       len_chromosome,		/* const int              len_chromo */
+       NULL,			/* GAgeneration_hook      generation_hook */
+       NULL,			/* GAiteration_hook       iteration_hook */
+       NULL,			/* GAdata_destructor      data_destructor */
+       NULL,			/* GAdata_ref_incrementor data_ref_incrementor */
+       NULL,			/* GAevaluate             evaluate */
+       ga_seed_bitstring_random,	/* GAseed                 seed */
+       NULL,			/* GAadapt                adapt */
+       NULL,			/* GAselect_one           select_one */
+       NULL,			/* GAselect_two           select_two */
+       NULL,			/* GAmutate               mutate */
+       NULL,			/* GAcrossover            crossover */
+       NULL,			/* GAreplace              replace */
+       NULL			/* vpointer	User data */
+            );
+
+  for (i=0; i<num_entities; i++)
+    ga_entity_seed(pop, ga_get_free_entity(pop));
+  pop->orig_size = pop->size;
+
+  printf("%d entities, %d bits.\n", num_entities, len_chromosome);
+  printf("function         bitwise s   kernel s\n");
+
+  t_bit = bench_pairs(pop, bench_tanimoto, &r_bit);
+  t_word = bench_pairs(pop, bench_library_tanimoto, &r_word);
+  if (r_bit != r_word) die("Tanimoto similarities disagree.");
+  printf("tanimoto    %14.4f  %9.4f\n", t_bit, t_word);
+
+  t_bit = bench_pairs(pop, bench_hamming, &r_bit);
+  t_word = bench_pairs(pop, ga_compare_bitstring_hamming, &r_word);
+  if (r_bit != r_word) die("Hamming distances disagree.");
+  printf("hamming     %14.4f  %9.4f\n", t_bit, t_word);
+
+  c_bit = ga_bit_new(len_chromosome);
+  c_word = ga_bit_new(len_chromosome);
+  t_bit = bench_copies(pop, bench_copy, c_bit);
+  t_word = bench_copies(pop, ga_bit_copy, c_word);
+  if (memcmp(c_bit, c_word, ga_bit_sizeof(len_chromosome)))
+    die("Copied bits disagree.");
+  printf("copy        %14.4f  %9.4f\n", t_bit, t_word);
+  ga_bit_free(c_bit);
+  ga_bit_free(c_word);
+
+  t_bit = bench_crossovers(pop, bench_allele_mixing);
+  t_word = bench_crossovers(pop, ga_crossover_bitstring_allele_mixing);
+  printf("uniform     %14.4f  %9.4f\n", t_bit, t_word);
+
+  num_values = (size_t) num_entities*(len_chromosome/(BENCH_MANTISSA+BENCH_EXPONENT));
+  if (num_values > 0)
+    {
+    v_bit = s_malloc(sizeof(double)*num_values);
+    v_word = s_malloc(sizeof(double)*num_values);
+    t_bit = bench_decodes(pop, FALSE, v_bit);
+    t_word = bench_decodes(pop, TRUE, v_word);
+    if (memcmp(v_bit, v_word, sizeof(double)*num_values))
+      die("Decoded values disagree.");
+    printf("gray decode %14.4f  %9.4f\n", t_bit, t_word);
+    s_free(v_bit);
+    s_free(v_word);
+    }
+
+  t_word = bench_roundtrips(pop);
+  printf("round trip  %14s  %9.4f\n", "-", t_word);
+
+  ga_extinction(pop);
+
+  exit(EXIT_SUCCESS);
+  }
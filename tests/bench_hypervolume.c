@@ -0,0 +1,217 @@
+/**********************************************************************
+  bench_hypervolume.c
+ **********************************************************************
+
+  bench_hypervolume - Benchmark the hypervolume indicator.
+  Copyright ©2026, Stewart Adcock <stewart@linux-domain.com>
+  All rights reserved.
+
+  The latest version of this program should be available at:
+  http://gaul.sourceforge.net/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.  Alternatively, if your project
+  is incompatible with the GPL, I will probably agree to requests
+  for permission to use the terms of any other license.
+
+  This program is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY WHATSOEVER.
+
+  A full copy of the GNU General Public License should be in the file
+  "COPYING" provided with this distribution; if not, see:
+  http://www.gnu.org/
+
+ **********************************************************************
+
+  Synopsis:	Benchmark the hypervolume indicator, and the exclusive
+		hypervolume contributions, on Pareto fronts of
+		increasing size and dimension.
+
+		The fronts are random points on the positive part
+		of the unit sphere, so that none dominates another.
+		Each result is checked against the same front with
+		an extra dimension of constant value, for which the
+		hypervolume is scaled by that value, and a few of
+		the contributions are checked by removing the point
+		and recalculating the hypervolume.
+
+		Timings are machine dependent, so this program is not
+		part of the regression tests run by run_tests.sh.
+
+  Usage:	bench_hypervolume [max_points]
+
+ **********************************************************************/
+
+/*
+ * Includes
+ */
+#include "gaul.h"
+
+#include <time.h>
+
+/*
+ * Benchmark parameters.
+ */
+#define BENCH_SEED	42
+#define BENCH_DEPTH	0.5	/* Value of the extra dimension. */
+#define BENCH_CHECKS	5	/* Contributions to check. */
+#define BENCH_TOLERANCE	1.0e-9
+#define BENCH_DIMS	4	/* Largest dimension. */
+
+/**********************************************************************
+  bench_seconds()
+  synopsis:	Processor time in seconds.
+  parameters:
+  return:	double	Seconds.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_seconds(void)
+  {
+  return (double) clock() / CLOCKS_PER_SEC;
+  }
+
+
+/**********************************************************************
+  bench_front()
+  synopsis:	Create a random Pareto front on the positive part of
+		the unit sphere.  Each point has room for one extra
+		dimension, which is set to BENCH_DEPTH.
+  parameters:	int num_points
+		int num_dims
+  return:	double **	The front.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double **bench_front(int num_points, int num_dims)
+  {
+  double	**front;	/* The front. */
+  double	norm;		/* Length of a point. */
+  int		i, d;		/* Loop variables. */
+
+  front = s_malloc(sizeof(double *)*num_points);
+
+  for (i=0; i<num_points; i++)
+    {
+    front[i] = s_malloc(sizeof(double)*(num_dims+1));
+
+    do
+      {
+      norm = 0.0;
+      for (d=0; d<num_dims; d++)
+        {
+        front[i][d] = fabs(random_unit_gaussian());
+        norm += front[i][d]*front[i][d];
+        }
+      } while (norm == 0.0);
+
+    norm = sqrt(norm);
+    for (d=0; d<num_dims; d++)
+      front[i][d] /= norm;
+    front[i][num_dims] = BENCH_DEPTH;
+    }
+
+  return front;
+  }
+
+
+/**********************************************************************
+  bench_check()
+  synopsis:	Die unless two volumes agree.
+  parameters:	double found
+		double expected
+		char *what
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void bench_check(double found, double expected, char *what)
+  {
+  if (fabs(found-expected) > BENCH_TOLERANCE*(1.0+fabs(expected)))
+    dief("Inconsistent %s (%f, expected %f).", what, found, expected);
+
+  return;
+  }
+
+
+/**********************************************************************
+  main()
+  synopsis:	Benchmark hypervolume calculations.
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+int main(int argc, char **argv)
+  {
+  int		max_points=10000;	/* Largest front. */
+  double	**front;		/* The front. */
+  double	*contribution;		/* Exclusive contributions. */
+  double	reference[BENCH_DIMS+1];	/* Reference point. */
+  double	vol, vol_extra, vol_less;	/* Hypervolumes. */
+  double	t_vol, t_contrib;	/* Timings. */
+  double	*saved;			/* Point removed for a check. */
+  int		num_dims, num_points;	/* Size of front. */
+  int		i, k;			/* Loop variables. */
+
+  if (argc > 1) max_points = atoi(argv[1]);
+  if (max_points < BENCH_CHECKS)
+    die("Usage: bench_hypervolume [max_points]");
+
+  for (k=0; k<=BENCH_DIMS; k++)
+    reference[k] = 0.0;
+
+  random_seed(BENCH_SEED);
+
+  printf("dims  points  hypervolume  volume s  contributions s\n");
+
+  for (num_dims=2; num_dims<=BENCH_DIMS; num_dims++)
+    {
+    for (num_points=max_points/10; num_points<=max_points; num_points*=10)
+      {
+/* WFG is much slower, so use smaller fronts beyond three dimensions. */
+      if (num_dims > 3 && num_points > max_points/10) break;
+
+      front = bench_front(num_points, num_dims);
+      contribution = s_malloc(sizeof(double)*num_points);
+
+      t_vol = bench_seconds();
+      vol = ga_hypervolume(front, num_points, num_dims, reference);
+      t_vol = bench_seconds() - t_vol;
+
+      t_contrib = bench_seconds();
+      ga_hypervolume_contributions(front, num_points, num_dims, reference,
+                                   contribution);
+      t_contrib = bench_seconds() - t_contrib;
+
+      if (num_dims < BENCH_DIMS)
+        {
+        vol_extra = ga_hypervolume(front, num_points, num_dims+1, reference);
+        bench_check(vol_extra, vol*BENCH_DEPTH, "hypervolume");
+        }
+
+      for (i=0; i<BENCH_CHECKS; i++)
+        {
+        k = i*(num_points-1)/(BENCH_CHECKS-1);
+        saved = front[k];
+        front[k] = front[num_points-1];
+        vol_less = ga_hypervolume(front, num_points-1, num_dims, reference);
+        front[num_points-1] = front[k];
+        front[k] = saved;
+        bench_check(contribution[k], vol-vol_less, "contribution");
+        }
+
+      printf("%4d  %6d  %11.6f  %8.4f  %15.4f\n", num_dims, num_points,
+             vol, t_vol, t_contrib);
+
+      for (i=0; i<num_points; i++)
+        s_free(front[i]);
+      s_free(front);
+      s_free(contribution);
+      }
+    }
+
+  exit(EXIT_SUCCESS);
+  }
@@ -0,0 +1,250 @@
+/**********************************************************************
+  bench_memory_chunks.c
+ **********************************************************************
+
+  bench_memory_chunks - Benchmark memory chunk allocation throughput.
+  Copyright ©2026, Stewart Adcock <stewart@linux-domain.com>
+  All rights reserved.
+
+  The latest version of this program should be available at:
+  http://gaul.sourceforge.net/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.  Alternatively, if your project
+  is incompatible with the GPL, I will probably agree to requests
+  for permission to use the terms of any other license.
+
+  This program is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY WHATSOEVER.
+
+  A full copy of the GNU General Public License should be in the file
+  "COPYING" provided with this distribution; if not, see:
+  http://www.gnu.org/
+
+ **********************************************************************
+
+  Synopsis:	Benchmark the alloc/free throughput of the memory
+		chunk code against the system malloc()/free().
+
+		Three access patterns are timed: LIFO (free in the
+		reverse of the allocation order), FIFO and random.
+		The random pattern touches many memory areas, which
+		is where the owning area lookup used to dominate.
+
+		Timings are machine dependent, so this program is not
+		part of the regression tests run by run_tests.sh.
+
+  Usage:	bench_memory_chunks [num_atoms] [num_rounds]
+
+ **********************************************************************/
+
+/*
+ * Includes
+ */
+#include "gaul.h"
+
+#include <time.h>
+
+/*
+ * Benchmark parameters.
+ */
+#define BENCH_ATOM_SIZE		48
+#define BENCH_AREA_ATOMS	256
+
+typedef enum bench_order_t
+  {
+  BENCH_LIFO, BENCH_FIFO, BENCH_RANDOM
+  } bench_order;
+
+/**********************************************************************
+  bench_seconds()
+  synopsis:	Processor time in seconds.
+  parameters:
+  return:	double	Seconds.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_seconds(void)
+  {
+  return (double) clock() / CLOCKS_PER_SEC;
+  }
+
+
+/**********************************************************************
+  bench_order_fill()
+  synopsis:	Fill the index array that determines the order in
+		which atoms are released.
+  parameters:	int *order	Array of num_atoms indices.
+		int num_atoms
+		bench_order pattern
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void bench_order_fill(int *order, int num_atoms, bench_order pattern)
+  {
+  int	i;		/* Loop over atoms. */
+  int	pos, tmp;	/* Shuffle. */
+
+  for (i = 0; i < num_atoms; i++)
+    order[i] = pattern==BENCH_LIFO?num_atoms-1-i:i;
+
+  if (pattern == BENCH_RANDOM)
+    {
+    for (i = num_atoms-1; i > 0; i--)
+      {
+      pos = random_int(i+1);
+      tmp = order[i];
+      order[i] = order[pos];
+      order[pos] = tmp;
+      }
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  bench_chunk()
+  synopsis:	Time alloc/free cycles through a MemChunk.
+  parameters:	int num_atoms	Atoms live at the peak.
+		int num_rounds	Number of alloc/free cycles.
+		int *order	Release order.
+  return:	double	Seconds taken.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_chunk(int num_atoms, int num_rounds, int *order)
+  {
+  MemChunk	*chunk;		/* Chunk under test. */
+  void		**atoms;	/* Live atoms. */
+  int		i, round;	/* Loop variables. */
+  double	start;		/* Start time. */
+
+  atoms = s_malloc(sizeof(void *)*num_atoms);
+  chunk = mem_chunk_new(BENCH_ATOM_SIZE, BENCH_AREA_ATOMS);
+
+  start = bench_seconds();
+
+  for (round = 0; round < num_rounds; round++)
+    {
+    for (i = 0; i < num_atoms; i++)
+      {
+      atoms[i] = mem_chunk_alloc(chunk);
+      *((int *)atoms[i]) = i;
+      }
+
+    for (i = 0; i < num_atoms; i++)
+      {
+      if (*((int *)atoms[order[i]]) != order[i]) die("Atom corrupt.");
+      mem_chunk_free(chunk, atoms[order[i]]);
+      }
+    }
+
+  start = bench_seconds() - start;
+
+  if (!mem_chunk_isempty(chunk)) die("Chunk not empty.");
+
+  mem_chunk_destroy(chunk);
+  s_free(atoms);
+
+  return start;
+  }
+
+
+/**********************************************************************
+  bench_malloc()
+  synopsis:	Time the equivalent alloc/free cycles through the
+		system's malloc() and free().
+  parameters:	int num_atoms	Atoms live at the peak.
+		int num_rounds	Number of alloc/free cycles.
+		int *order	Release order.
+  return:	double	Seconds taken.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_malloc(int num_atoms, int num_rounds, int *order)
+  {
+  void		**atoms;	/* Live atoms. */
+  int		i, round;	/* Loop variables. */
+  double	start;		/* Start time. */
+
+  atoms = s_malloc(sizeof(void *)*num_atoms);
+
+  start = bench_seconds();
+
+  for (round = 0; round < num_rounds; round++)
+    {
+    for (i = 0; i < num_atoms; i++)
+      {
+      if ( !(atoms[i] = malloc(BENCH_ATOM_SIZE)) )
+        die("Unable to allocate memory.");
+      *((int *)atoms[i]) = i;
+      }
+
+    for (i = 0; i < num_atoms; i++)
+      {
+      if (*((int *)atoms[order[i]]) != order[i]) die("Atom corrupt.");
+      free(atoms[order[i]]);
+      }
+    }
+
+  start = bench_seconds() - start;
+
+  s_free(atoms);
+
+  return start;
+  }
+
+
+/**********************************************************************
+  main()
+  synopsis:	Benchmark memory chunks.
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+int main(int argc, char **argv)
+  {
+  int		num_atoms=100000;	/* Atoms live at the peak. */
+  int		num_rounds=50;		/* Number of alloc/free cycles. */
+  int		*order;			/* Release order. */
+  bench_order	pattern;		/* Access pattern. */
+  double	t_chunk, t_malloc;	/* Timings. */
+  double	mops;			/* Total operations, in millions. */
+  static char	*pattern_name[] = { "LIFO", "FIFO", "random" };
+
+  if (argc > 1) num_atoms = atoi(argv[1]);
+  if (argc > 2) num_rounds = atoi(argv[2]);
+  if (num_atoms < 1 || num_rounds < 1)
+    die("Usage: bench_memory_chunks [num_atoms] [num_rounds]");
+
+  random_seed(42);
+
+  order = s_malloc(sizeof(int)*num_atoms);
+  mops = 2.0e-6*num_atoms*num_rounds;
+
+  printf("%d atoms of %d bytes, %d atoms per area, %d rounds.\n",
+         num_atoms, BENCH_ATOM_SIZE, BENCH_AREA_ATOMS, num_rounds);
+  printf("pattern   mem_chunk Mop/s   malloc Mop/s\n");
+
+  for (pattern = BENCH_LIFO; pattern <= BENCH_RANDOM; pattern++)
+    {
+    bench_order_fill(order, num_atoms, pattern);
+
+    t_chunk = bench_chunk(num_atoms, num_rounds, order);
+    t_malloc = bench_malloc(num_atoms, num_rounds, order);
+
+    printf("%-8s  %15.1f  %13.1f\n", pattern_name[pattern],
+           t_chunk>0.0?mops/t_chunk:0.0,
+           t_malloc>0.0?mops/t_malloc:0.0);
+    }
+
+  s_free(order);
+
+  exit(EXIT_SUCCESS);
+  }
+
@@ -0,0 +1,252 @@
+/**********************************************************************
+  bench_sort.c
+ **********************************************************************
+
+  bench_sort - Benchmark the population sorting methods.
+  Copyright ©2026, Stewart Adcock <stewart@linux-domain.com>
+  All rights reserved.
+
+  The latest version of this program should be available at:
+  http://gaul.sourceforge.net/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.  Alternatively, if your project
+  is incompatible with the GPL, I will probably agree to requests
+  for permission to use the terms of any other license.
+
+  This program is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY WHATSOEVER.
+
+  A full copy of the GNU General Public License should be in the file
+  "COPYING" provided with this distribution; if not, see:
+  http://www.gnu.org/
+
+ **********************************************************************
+
+  Synopsis:	Benchmark the population sorting methods against
+		each other.
+
+		For each fitness distribution, identical populations
+		are ordered by the shuffle sort, by the radix top-k
+		selection and by a full radix sort.  The shuffle sort
+		and top-k selection are asked for the survivors only,
+		as in the survival stage of the GA.  The orderings of
+		the survivors are checked to be identical.
+
+		Timings are machine dependent, so this program is not
+		part of the regression tests run by run_tests.sh.
+		When compiled with OpenMP, wall clock time is
+		reported and large populations are sorted in parallel.
+
+  Usage:	bench_sort [num_entities] [num_survivors]
+
+ **********************************************************************/
+
+/*
+ * Includes
+ */
+#include "gaul.h"
+
+#include <time.h>
+
+/*
+ * Benchmark parameters.
+ */
+#define BENCH_SEED	42
+
+typedef enum bench_dist_t
+  {
+  BENCH_DISTINCT, BENCH_DEGENERATE, BENCH_CONSTANT, BENCH_SORTED
+  } bench_dist;
+
+/**********************************************************************
+  bench_seconds()
+  synopsis:	Time in seconds.  This is wall clock time for OpenMP
+		builds, and processor time otherwise.
+  parameters:
+  return:	double	Seconds.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_seconds(void)
+  {
+#ifdef USE_OPENMP
+  return omp_get_wtime();
+#else
+  return (double) clock() / CLOCKS_PER_SEC;
+#endif
+  }
+
+
+/**********************************************************************
+  bench_population()
+  synopsis:	Create a population with the given distribution of
+		fitness scores.  The same arguments always result in
+		an identical population.
+  parameters:	int num_entities
+		int num_survivors	The stable size.
+		bench_dist dist
+  return:	population *
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static population *bench_population(int num_entities, int num_survivors,
+                                    bench_dist dist)
+  {
+  population	*pop;		/* Population. */
+  entity	*adam;		/* New entity. */
+  int		i;		/* Loop over entities. */
+  double	fitness=0.0;	/* Fitness of new entity. */
+
+  pop = ga_genesis_boolean(
+       num_survivors,		/* const int              population_size */
+       1,			/* const int              num_chromo */
+       1,			/* const int              len_chromo */
+       NULL,			/* GAgeneration_hook      generation_hook */
+       NULL,			/* GAiteration_hook       iteration_hook */
+       NULL,			/* GAdata_destructor      data_destructor */
+       NULL,			/* GAdata_ref_incrementor data_ref_incrementor */
+       NULL,			/* GAevaluate             evaluate */
+       NULL,			/* GAseed                 seed */
+       NULL,			/* GAadapt                adapt */
+       NULL,			/* GAselect_one           select_one */
+       NULL,			/* GAselect_two           select_two */
+       NULL,			/* GAmutate               mutate */
+       NULL,			/* GAcrossover            crossover */
+       NULL,			/* GAreplace              replace */
+       NULL			/* vpointer	User data */
+            );
+
+  random_seed(BENCH_SEED);
+
+  for (i=0; i<num_entities; i++)
+    {
+    switch (dist)
+      {
+      case BENCH_DISTINCT:
+        fitness = random_double_range(-1.0, 1.0);
+        break;
+      case BENCH_DEGENERATE:
+        fitness = (double) random_int(8);
+        break;
+      case BENCH_CONSTANT:
+        fitness = 1.0;
+        break;
+      case BENCH_SORTED:
+        fitness = (double) (num_entities-i);
+        break;
+      }
+
+    adam = ga_get_free_entity(pop);
+    ga_entity_set_fitness(adam, fitness);
+    }
+
+  return pop;
+  }
+
+
+/**********************************************************************
+  bench_method()
+  synopsis:	Time the sort of a fresh population, and record the
+		ids of the survivors in order.
+  parameters:	int num_entities
+		int num_survivors
+		bench_dist dist
+		ga_sort_type sort_type
+		boolean full	Whether to sort the entire population.
+		int *ids	Returns survivors' ids.
+  return:	double	Seconds taken.
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static double bench_method(int num_entities, int num_survivors,
+                           bench_dist dist, ga_sort_type sort_type,
+                           boolean full, int *ids)
+  {
+  population	*pop;		/* Population. */
+  int		i;		/* Loop over ranks. */
+  double	start;		/* Start time. */
+
+  pop = bench_population(num_entities, num_survivors, dist);
+  ga_population_set_sort_type(pop, sort_type);
+
+  start = bench_seconds();
+
+  if (full)
+    ga_population_sort(pop);
+  else
+    ga_population_sort_best(pop, num_survivors);
+
+  start = bench_seconds() - start;
+
+  for (i=0; i<num_survivors; i++)
+    {
+    ids[i] = ga_get_entity_id_from_rank(pop, i);
+    if ( i > 0 &&
+         ga_entity_get_fitness(ga_get_entity_from_rank(pop, i)) >
+         ga_entity_get_fitness(ga_get_entity_from_rank(pop, i-1)) )
+      die("Population is incorrectly ordered.");
+    }
+
+  ga_extinction(pop);
+
+  return start;
+  }
+
+
+/**********************************************************************
+  main()
+  synopsis:	Benchmark population sorting.
+  parameters:
+  return:
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+int main(int argc, char **argv)
+  {
+  int		num_entities=20000;	/* Population size. */
+  int		num_survivors;		/* Entities that must be ordered. */
+  int		*ids_shuffle, *ids_topk, *ids_radix;	/* Survivors. */
+  bench_dist	dist;			/* Fitness distribution. */
+  double	t_shuffle, t_topk, t_radix;	/* Timings. */
+  static char	*dist_name[] = { "distinct", "degenerate", "constant", "sorted" };
+
+  if (argc > 1) num_entities = atoi(argv[1]);
+  num_survivors = num_entities/4;
+  if (argc > 2) num_survivors = atoi(argv[2]);
+  if (num_survivors < 1 || num_entities < num_survivors)
+    die("Usage: bench_sort [num_entities] [num_survivors]");
+
+  ids_shuffle = s_malloc(sizeof(int)*num_survivors);
+  ids_topk = s_malloc(sizeof(int)*num_survivors);
+  ids_radix = s_malloc(sizeof(int)*num_survivors);
+
+  printf("%d entities, %d survivors.\n", num_entities, num_survivors);
+  printf("fitnesses    shuffle top-k s   radix top-k s   radix full s\n");
+
+  for (dist = BENCH_DISTINCT; dist <= BENCH_SORTED; dist++)
+    {
+    t_shuffle = bench_method(num_entities, num_survivors, dist,
+                             GA_SORT_SHUFFLE, FALSE, ids_shuffle);
+    t_topk = bench_method(num_entities, num_survivors, dist,
+                          GA_SORT_AUTO, FALSE, ids_topk);
+    t_radix = bench_method(num_entities, num_survivors, dist,
+                           GA_SORT_RADIX, TRUE, ids_radix);
+
+    if ( memcmp(ids_shuffle, ids_topk, sizeof(int)*num_survivors) ||
+         memcmp(ids_shuffle, ids_radix, sizeof(int)*num_survivors) )
+      die("Sorting methods disagree.");
+
+    printf("%-10s  %16.4f  %14.4f  %13.4f\n", dist_name[dist],
+           t_shuffle, t_topk, t_radix);
+    }
+
+  s_free(ids_shuffle);
+  s_free(ids_topk);
+  s_free(ids_radix);
+
+  exit(EXIT_SUCCESS);
+  }
+
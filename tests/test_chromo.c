@@ -0,0 +1,217 @@
+/**********************************************************************
+  test_chromo.c
+ **********************************************************************
+
+  test_chromo - Test GAUL chromosome serialization.
+  Copyright ©2026, Stewart Adcock <stewart@linux-domain.com>
+  All rights reserved.
+
+  The latest version of this program should be available at:
+  http://gaul.sourceforge.net/
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.  Alternatively, if your project
+  is incompatible with the GPL, I will probably agree to requests
+  for permission to use the terms of any other license.
+
+  This program is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY WHATSOEVER.
+
+  A full copy of the GNU General Public License should be in the file
+  "COPYING" provided with this distribution; if not, see:
+  http://www.gnu.org/
+
+ **********************************************************************
+
+  Synopsis:	Test serialization of the built-in chromosome types,
+		with and without a chromosome arena.
+
+ **********************************************************************/
+
+/*
+ * Includes
+ */
+#include "gaul.h"
+
+#define NUM_ENTITIES	4
+#define NUM_CHROMO	2
+#define LEN_CHROMO	3
+
+static char *filename="test_chromo.pop";
+
+/**********************************************************************
+  fill_entity()
+  synopsis:	Set every byte of an entity's chromosomes to a value
+		depending on the entity, chromosome and byte.
+  parameters:
+  return:	none
+  updated:	17 Oct 2026
+ **********************************************************************/
+
+static void fill_entity(population *pop, entity *joe, const int e,
+                        const size_t allele_size)
+  {
+  int		k;	/* Loop over chromosomes. */
+  size_t	b;	/* Loop over bytes. */
+
+  for (k=0; k<pop->num_chromosomes; k++)
+    for (b=0; b<pop->len_chromosomes*allele_size; b++)
+      ((gaulbyte *)joe->chromosome[k])[b] = (gaulbyte) (e*31 + k*7 + b + 1);
+
+  return;
+  }
+
+
+/**********************************************************************
+  same_entity()
+  synopsis:	Compare the chromosomes of two entities.
+  parameters:
+  return:	TRUE if they are identical.
+  updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean same_entity(population *pop, entity *a, entity *b,
+                           const size_t allele_size)
+  {
+  int		k;	/* Loop over chromosomes. */
+
+  for (k=0; k<pop->num_chromosomes; k++)
+    if (memcmp(a->chromosome[k], b->chromosome[k], pop->len_chromosomes*allele_size) != 0)
+      return FALSE;
+
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  test_population()
+  synopsis:	Round trip each entity of a population through
+		chromosome_to_bytes() and chromosome_from_bytes(),
+		and the whole population through a population file.
+  parameters:
+  return:	TRUE if all checks pass.
+  updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean test_population(const char *name, population *pop,
+                               const size_t allele_size,
+                               const boolean use_arena)
+  {
+  population	*copy;			/* Population read back from disk. */
+  entity	*joe[NUM_ENTITIES];	/* Original entities. */
+  entity	*clone;			/* Entity rebuilt from bytes. */
+  gaulbyte	*buffer=NULL;		/* Serialised chromosomes. */
+  unsigned int	len, max_len=0;		/* Length of buffer. */
+  int		e, k;			/* Loop over entities, chromosomes. */
+  boolean	bytes_ok=TRUE, file_ok=TRUE;
+
+  ga_population_set_chromosome_arena(pop, use_arena);
+
+  for (e=0; e<NUM_ENTITIES; e++)
+    {
+    joe[e] = ga_get_free_entity(pop);
+    fill_entity(pop, joe[e], e, allele_size);
+    ga_entity_set_fitness(joe[e], (double) e);
+    }
+
+  for (e=0; e<NUM_ENTITIES; e++)
+    {
+    len = pop->chromosome_to_bytes(pop, joe[e], &buffer, &max_len);
+
+    if (len != NUM_CHROMO*LEN_CHROMO*allele_size) bytes_ok = FALSE;
+
+    for (k=0; k<NUM_CHROMO; k++)
+      if (memcmp(buffer+k*LEN_CHROMO*allele_size, joe[e]->chromosome[k], LEN_CHROMO*allele_size) != 0)
+        bytes_ok = FALSE;
+
+    clone = ga_get_free_entity(pop);
+    pop->chromosome_from_bytes(pop, clone, buffer);
+    if (!same_entity(pop, joe[e], clone, allele_size)) bytes_ok = FALSE;
+    ga_entity_dereference(pop, clone);
+
+    for (k=0; k<NUM_ENTITIES; k++)
+      {	/* Neighbouring entities must be untouched. */
+      clone = ga_entity_clone(pop, joe[k]);
+      fill_entity(pop, clone, k, allele_size);
+      if (!same_entity(pop, joe[k], clone, allele_size)) bytes_ok = FALSE;
+      ga_entity_dereference(pop, clone);
+      }
+    }
+
+  if (max_len!=0)
+    s_free(buffer);
+
+  printf("%s chromosomes%s, bytes: %s\n", name, use_arena?" in arena":"",
+         bytes_ok?"PASSED":"FAILED");
+
+  ga_population_write(pop, filename);
+  copy = ga_population_read(filename);
+  remove(filename);
+
+  if (copy->size != NUM_ENTITIES) file_ok = FALSE;
+
+  for (e=0; file_ok && e<NUM_ENTITIES; e++)
+    if (!same_entity(pop, ga_get_entity_from_rank(pop, e),
+                     ga_get_entity_from_rank(copy, e), allele_size))
+      file_ok = FALSE;
+
+  printf("%s chromosomes%s, population file: %s\n", name, use_arena?" in arena":"",
+         file_ok?"PASSED":"FAILED");
+
+  ga_extinction(copy);
+  ga_extinction(pop);
+
+  return bytes_ok && file_ok;
+  }
+
+
+/**********************************************************************
+  main()
+  synopsis:	Test GAUL's chromosome serialization.
+  parameters:
+  return:
+  updated:	17 Oct 2026
+ **********************************************************************/
+
+int main(int argc, char **argv)
+  {
+  int		i;		/* Loop over storage. */
+  boolean	success=TRUE;
+
+  random_seed(42);
+
+  for (i=0; i<2; i++)
+    {
+    success &= test_population("integer",
+                   ga_genesis_integer(NUM_ENTITIES, NUM_CHROMO, LEN_CHROMO,
+                   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                   NULL, NULL, NULL, NULL),
+                   sizeof(int), i==1);
+    success &= test_population("boolean",
+                   ga_genesis_boolean(NUM_ENTITIES, NUM_CHROMO, LEN_CHROMO,
+                   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                   NULL, NULL, NULL, NULL),
+                   sizeof(boolean), i==1);
+    success &= test_population("double",
+                   ga_genesis_double(NUM_ENTITIES, NUM_CHROMO, LEN_CHROMO,
+                   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                   NULL, NULL, NULL, NULL),
+                   sizeof(double), i==1);
+    success &= test_population("char",
+                   ga_genesis_char(NUM_ENTITIES, NUM_CHROMO, LEN_CHROMO,
+                   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                   NULL, NULL, NULL, NULL),
+                   sizeof(char), i==1);
+    }
+
+  if (success==FALSE)
+    printf("*** Chromosome serialization IS NOT correct.\n");
+  else
+    printf("Chromosome serialization is correct.\n");
+
+  exit(EXIT_SUCCESS);
+  }
+
+
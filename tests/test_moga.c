@@ -67,6 +67,29 @@ static boolean test_score(population *pop, entity *this_entity)
   }
 
 
+/**********************************************************************
+  test_fronts_score()
+  synopsis:	Fitness function.  As test_score(), except that the
+		errors are negated in the fitness vector, since
+		larger values are better.
+  parameters:
+  return:
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static boolean test_fronts_score(population *pop, entity *this_entity)
+  {
+  int		i;		/* Loop over objectives. */
+
+  test_score(pop, this_entity);
+
+  for (i=0; i<4; i++)
+    this_entity->fitvector[i] = -this_entity->fitvector[i];
+
+  return TRUE;
+  }
+
+
 /**********************************************************************
   test_generation_callback()
   synopsis:	Generation callback
@@ -123,12 +146,16 @@ static boolean test_seed(population *pop, entity *adam)
   synopsis:	Main function.
   parameters:
   return:
-  updated:	05 Aug 2005
+  updated:	17 Oct 2026
  **********************************************************************/
 
 int main(int argc, char **argv)
   {
   population		*pop;			/* Population of solutions. */
+  population		*archive;		/* Archive of non-dominated solutions. */
+  entity		*this_entity;		/* An archived solution. */
+  int			i;			/* Loop over archived solutions. */
+  static double		reference[4] = { -2.0, -2.0, -2.0, -2.0 };	/* Hypervolume reference point. */
 
   random_seed(23091975);
 
@@ -212,6 +239,100 @@ int main(int argc, char **argv)
 
   ga_extinction(pop);
 
+/* "Pareto Fronts" (NSGA-II style) Multiobjective GA. */
+  printf("Using the Pareto Fronts Multiobjective GA varient.\n");
+
+  pop = ga_genesis_double(
+       100,			/* const int              population_size */
+       1,			/* const int              num_chromo */
+       4,			/* const int              len_chromo */
+       test_generation_callback,/* GAgeneration_hook      generation_hook */
+       NULL,			/* GAiteration_hook       iteration_hook */
+       NULL,			/* GAdata_destructor      data_destructor */
+       NULL,			/* GAdata_ref_incrementor data_ref_incrementor */
+       test_fronts_score,	/* GAevaluate             evaluate */
+       test_seed,		/* GAseed                 seed */
+       NULL,			/* GAadapt                adapt */
+       ga_select_one_bestof2,	/* GAselect_one           select_one */
+       ga_select_two_bestof2,	/* GAselect_two           select_two */
+       ga_mutate_double_singlepoint_drift,	/* GAmutate               mutate */
+       ga_crossover_double_doublepoints,	/* GAcrossover            crossover */
+       NULL,			/* GAreplace              replace */
+       NULL			/* vpointer	User data */
+            );
+
+  ga_population_set_parameters(
+       pop,				/* population      *pop */
+       GA_SCHEME_DARWIN,		/* const ga_scheme_type     scheme */
+       GA_ELITISM_PARETO_FRONTS_SURVIVE,	/* const ga_elitism_type   elitism */
+       0.8,				/* double  crossover */
+       0.2,				/* double  mutation */
+       0.0      		        /* double  migration */
+                              );
+
+  ga_population_set_fitness_dimensions(pop, 4);
+  ga_population_set_archive(pop, 20);
+
+  ga_evolution(
+       pop,				/* population	*pop */
+       200				/* const int	max_generations */
+              );
+
+  archive = ga_population_get_archive(pop);
+  printf("Pareto archive of %d solutions:\n", ga_population_get_size(archive));
+  for (i=0; i<ga_population_get_size(archive); i++)
+    {
+    this_entity = ga_get_entity_from_rank(archive, i);
+    printf("%f %f %f %f\n",
+           this_entity->fitvector[0], this_entity->fitvector[1],
+           this_entity->fitvector[2], this_entity->fitvector[3]);
+    }
+
+  ga_extinction(pop);
+
+/* "Hypervolume" (SMS-EMOA style) Multiobjective GA. */
+  printf("Using the Hypervolume Multiobjective GA varient.\n");
+
+  pop = ga_genesis_double(
+       100,			/* const int              population_size */
+       1,			/* const int              num_chromo */
+       4,			/* const int              len_chromo */
+       test_generation_callback,/* GAgeneration_hook      generation_hook */
+       NULL,			/* GAiteration_hook       iteration_hook */
+       NULL,			/* GAdata_destructor      data_destructor */
+       NULL,			/* GAdata_ref_incrementor data_ref_incrementor */
+       test_fronts_score,	/* GAevaluate             evaluate */
+       test_seed,		/* GAseed                 seed */
+       NULL,			/* GAadapt                adapt */
+       ga_select_one_bestof2,	/* GAselect_one           select_one */
+       ga_select_two_bestof2,	/* GAselect_two           select_two */
+       ga_mutate_double_singlepoint_drift,	/* GAmutate               mutate */
+       ga_crossover_double_doublepoints,	/* GAcrossover            crossover */
+       NULL,			/* GAreplace              replace */
+       NULL			/* vpointer	User data */
+            );
+
+  ga_population_set_parameters(
+       pop,				/* population      *pop */
+       GA_SCHEME_DARWIN,		/* const ga_scheme_type     scheme */
+       GA_ELITISM_HYPERVOLUME_SURVIVE,	/* const ga_elitism_type   elitism */
+       0.8,				/* double  crossover */
+       0.2,				/* double  mutation */
+       0.0      		        /* double  migration */
+                              );
+
+  ga_population_set_fitness_dimensions(pop, 4);
+  ga_population_set_hypervolume_reference(pop, reference);
+
+  ga_evolution(
+       pop,				/* population	*pop */
+       200				/* const int	max_generations */
+              );
+
+  printf("Hypervolume %f\n", ga_population_hypervolume(pop));
+
+  ga_extinction(pop);
+
   exit(EXIT_SUCCESS);
   }
 
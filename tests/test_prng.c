@@ -34,12 +34,207 @@
  */
 #include "gaul.h"
 
+/**********************************************************************
+  test_streams()
+  synopsis:	Check that streams split from the master seed are
+		reproducible and distinct, and that a saved state
+		also restores the streams split from it.
+  parameters:
+  return:	TRUE if all checks pass.
+  updated:	17 Oct 2026
+ **********************************************************************/
+
+#define NUM_STREAM_SAMPLES 1000
+
+static boolean test_streams(void)
+  {
+  random_stream	first, second, again;	/* Streams to compare. */
+  random_stream	saved, restored;	/* Streams split around a saved state. */
+  random_state	state;			/* Saved state. */
+  int		i;			/* Loop over samples. */
+  int		num_same=0;		/* Matching values in distinct streams. */
+  boolean	success=TRUE;
+  boolean	restores=TRUE;		/* Whether saved states restore streams. */
+
+  random_seed(42);
+  random_stream_init(&first);
+  random_stream_init(&second);
+
+  random_seed(42);
+  random_stream_init(&again);
+
+  for (i=0; i<NUM_STREAM_SAMPLES; i++)
+    {
+    unsigned int	val = random_stream_rand(&first);
+
+    if (val != random_stream_rand(&again)) success = FALSE;
+    if (val == random_stream_rand(&second)) num_same++;
+    }
+
+  if (success==FALSE)
+    printf("Stream reproducibility - FAILED\n");
+  else
+    printf("Stream reproducibility - PASSED\n");
+
+  state = random_get_state();
+  random_stream_init(&saved);
+  random_set_state(state);
+  random_stream_init(&restored);
+
+  for (i=0; i<NUM_STREAM_SAMPLES; i++)
+    if (random_stream_rand(&saved) != random_stream_rand(&restored))
+      restores = FALSE;
+
+  if (restores==FALSE)
+    {
+    printf("Stream state restoration - FAILED\n");
+    success = FALSE;
+    }
+  else
+    {
+    printf("Stream state restoration - PASSED\n");
+    }
+
+  if (num_same > 1)
+    {
+    printf("Stream independence - FAILED\n");
+    success = FALSE;
+    }
+  else
+    {
+    printf("Stream independence - PASSED\n");
+    }
+
+  return success;
+  }
+
+
+#define NUM_ZIGGURAT_SAMPLES	1000000
+#define NUM_ZIGGURAT_BINS	64
+#define ZIGGURAT_CHISQ_LIMIT	110.0	/* 63 d.o.f., p < 0.0001 */
+
+/*
+ * Cumulative distribution functions to test against.
+ */
+static double normal_cdf(double x)
+  {
+  return 0.5*erfc(-x/sqrt(2.0));
+  }
+
+static double exponential_cdf(double x)
+  {
+  return x<=0.0?0.0:1.0-exp(-x);
+  }
+
+
+/**********************************************************************
+  ziggurat_chisq()
+  synopsis:	Chi-squared test of samples against a distribution,
+		over equal bins between lo and hi, plus a bin for
+		each tail.
+  parameters:
+  return:	TRUE if the test passes.
+  updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean ziggurat_chisq(const char *name, double *samples, double (*cdf)(double), double lo, double hi)
+  {
+  long		bins[NUM_ZIGGURAT_BINS];	/* Histogram, with tails in the end bins. */
+  double	width=(hi-lo)/(NUM_ZIGGURAT_BINS-2);
+  double	expected, chisq=0.0;
+  int		i, bin;
+
+  for (i=0; i<NUM_ZIGGURAT_BINS; i++) bins[i] = 0;
+
+  for (i=0; i<NUM_ZIGGURAT_SAMPLES; i++)
+    {
+    if (samples[i] < lo)
+      bin = 0;
+    else if (samples[i] >= hi)
+      bin = NUM_ZIGGURAT_BINS-1;
+    else
+      bin = MIN(1 + (int)((samples[i]-lo)/width), NUM_ZIGGURAT_BINS-2);
+    bins[bin]++;
+    }
+
+  for (i=0; i<NUM_ZIGGURAT_BINS; i++)
+    {
+    if (i==0)
+      expected = cdf(lo);
+    else if (i==NUM_ZIGGURAT_BINS-1)
+      expected = 1.0-cdf(hi);
+    else
+      expected = cdf(lo+i*width)-cdf(lo+(i-1)*width);
+    expected *= NUM_ZIGGURAT_SAMPLES;
+    if (expected > 0.0) chisq += (bins[i]-expected)*(bins[i]-expected)/expected;
+    }
+
+  if (chisq > ZIGGURAT_CHISQ_LIMIT)
+    {
+    printf("%s chi-squared = %f - FAILED\n", name, chisq);
+    return FALSE;
+    }
+
+  printf("%s chi-squared = %f - PASSED\n", name, chisq);
+  return TRUE;
+  }
+
+
+/**********************************************************************
+  test_ziggurat()
+  synopsis:	Check the Ziggurat samplers against the normal and
+		exponential distributions with chi-squared tests, by
+		binning samples from each of the scalar and bulk
+		entry points.
+  parameters:
+  return:	TRUE if all checks pass.
+  updated:	17 Oct 2026
+ **********************************************************************/
+
+static boolean test_ziggurat(void)
+  {
+  double	*samples;		/* Generated deviates. */
+  int		i;			/* Loop over samples. */
+  boolean	success=TRUE;
+
+  samples = s_malloc(sizeof(double)*NUM_ZIGGURAT_SAMPLES);
+
+  random_seed(42);
+
+  for (i=0; i<NUM_ZIGGURAT_SAMPLES; i++)
+    samples[i] = random_unit_gaussian();
+  success &= ziggurat_chisq("random_unit_gaussian()", samples, normal_cdf, -4.0, 4.0);
+
+  for (i=0; i<NUM_ZIGGURAT_SAMPLES; i++)
+    samples[i] = random_float_unit_gaussian();
+  success &= ziggurat_chisq("random_float_unit_gaussian()", samples, normal_cdf, -4.0, 4.0);
+
+  random_fill_unit_gaussian(samples, NUM_ZIGGURAT_SAMPLES);
+  success &= ziggurat_chisq("random_fill_unit_gaussian()", samples, normal_cdf, -4.0, 4.0);
+
+  for (i=0; i<NUM_ZIGGURAT_SAMPLES; i++)
+    samples[i] = random_exponential();
+  success &= ziggurat_chisq("random_exponential()", samples, exponential_cdf, 0.0, 8.0);
+
+  for (i=0; i<NUM_ZIGGURAT_SAMPLES; i++)
+    samples[i] = random_float_exponential();
+  success &= ziggurat_chisq("random_float_exponential()", samples, exponential_cdf, 0.0, 8.0);
+
+  random_fill_exponential(samples, NUM_ZIGGURAT_SAMPLES);
+  success &= ziggurat_chisq("random_fill_exponential()", samples, exponential_cdf, 0.0, 8.0);
+
+  s_free(samples);
+
+  return success;
+  }
+
+
 /**********************************************************************
   main()
   synopsis:	Test GAUL's PRNG code.
   parameters:
   return:
-  updated:	25 Jul 2003
+  updated:	17 Oct 2026
  **********************************************************************/
 
 int main(int argc, char **argv)
@@ -65,6 +260,30 @@ int main(int argc, char **argv)
     printf("Routines produce sufficiently random numbers.\n");
     }
 
+/*
+ * Check per-thread streams.
+ */
+  if (test_streams()==FALSE)
+    {
+    printf("*** Streams ARE NOT reproducible and independent.\n");
+    }
+  else
+    {
+    printf("Streams are reproducible and independent.\n");
+    }
+
+/*
+ * Check the Ziggurat samplers.
+ */
+  if (test_ziggurat()==FALSE)
+    {
+    printf("*** Ziggurat samplers DO NOT follow their distributions.\n");
+    }
+  else
+    {
+    printf("Ziggurat samplers follow their distributions.\n");
+    }
+
   exit(EXIT_SUCCESS);
   }
 
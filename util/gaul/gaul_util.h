@@ -128,6 +128,24 @@
 # endif
 #endif
 
+/*
+ * Thread-local storage.  If the compiler can't provide it,
+ * HAVE_THREAD_LOCAL is 0 and THREAD_LOCAL variables are
+ * simply shared between threads.
+ */
+#ifndef THREAD_LOCAL
+# if defined(__GNUC__) || defined(__INTEL_COMPILER) || defined(__SUNPRO_C)
+#  define THREAD_LOCAL	__thread
+#  define HAVE_THREAD_LOCAL	1
+# elif defined(_MSC_VER)
+#  define THREAD_LOCAL	__declspec(thread)
+#  define HAVE_THREAD_LOCAL	1
+# else
+#  define THREAD_LOCAL
+#  define HAVE_THREAD_LOCAL	0
+# endif
+#endif
+
 /*
  * Includes needed for this stuff.
  */
@@ -65,24 +65,47 @@
 #define RANDOM_RAND_MAX         (unsigned int) 0xFFFFFFFF      /* Maximum 32-bit unsigned int */
 #endif
 
+/*
+ * An independent stream, which uses the xoshiro128** generator.
+ */
+typedef struct random_stream_t
+  {
+  unsigned int	s[4];
+  } random_stream;
+
 /*
  * Type definitions.
  * sizeof(random_state) should be 64*sizeof(int) which is
- * hopefully, fairly, optimal.
+ * hopefully, fairly, optimal.  The stream is the source from
+ * which per-thread streams are split.
  */
 #define RANDOM_NUM_STATE_VALS	57
 typedef struct random_state_t
   {
   unsigned int	v[RANDOM_NUM_STATE_VALS];
   int		j, k, x;
+  random_stream	stream;
   } random_state;
 
+/*
+ * A counter-based source, which uses the Philox4x32-10 generator.
+ */
+typedef struct random_counter_t
+  {
+  unsigned int	key[2];		/* Seed and generation. */
+  unsigned int	counter[4];	/* Draw index (two words), entity index and stream. */
+  unsigned int	buffer[4];	/* Output of the most recent block. */
+  int		num_buffered;	/* Unused values remaining in buffer. */
+  } random_counter;
+
 /*
  * Function prototypes.
  */
 
 GAULFUNC unsigned int	 random_rand(void);
 GAULFUNC void	random_seed(const unsigned int seed);
+GAULFUNC void	random_seed_state(random_state *state, const unsigned int seed);
+GAULFUNC random_state	*random_set_thread_state(random_state *state);
 GAULFUNC void	random_tseed(void);
 GAULFUNC void	random_init(void);
 GAULFUNC boolean	random_isinit(void);
@@ -122,6 +145,32 @@ GAULFUNC float	random_float_exponential(void);
 
 GAULFUNC void	random_int_permutation(const int size, int *iarray, int *oarray);
 
+GAULFUNC void	random_stream_seed(random_stream *stream, const unsigned int seed);
+GAULFUNC void	random_stream_init(random_stream *stream);
+GAULFUNC void	random_stream_jump(random_stream *stream);
+GAULFUNC unsigned int	random_stream_rand(random_stream *stream);
+GAULFUNC unsigned int	random_stream_int(random_stream *stream, const unsigned int max);
+GAULFUNC int	random_stream_int_range(random_stream *stream, const int min, const int max);
+GAULFUNC boolean	random_stream_boolean_prob(random_stream *stream, const double prob);
+GAULFUNC double	random_stream_unit_uniform(random_stream *stream);
+GAULFUNC double	random_stream_double_range(random_stream *stream, const double min, const double max);
+GAULFUNC double	random_stream_unit_gaussian(random_stream *stream);
+
+GAULFUNC void	random_fill_rand(unsigned int *out, const int num);
+GAULFUNC void	random_fill_double_range(double *out, const int num, const double min, const double max);
+GAULFUNC void	random_fill_float_range(float *out, const int num, const float min, const float max);
+GAULFUNC void	random_fill_int_range(int *out, const int num, const int min, const int max);
+GAULFUNC void	random_fill_boolean_prob(boolean *out, const int num, const double prob);
+GAULFUNC void	random_fill_bitmask(gaulbyte *mask, const int num_bits, const double prob);
+GAULFUNC void	random_fill_unit_gaussian(double *out, const int num);
+GAULFUNC void	random_fill_exponential(double *out, const int num);
+
+GAULFUNC unsigned int	random_get_seed(void);
+GAULFUNC void	random_philox(const unsigned int counter[4], const unsigned int key[2], unsigned int out[4]);
+GAULFUNC void	random_counter_init(random_counter *rc, const unsigned int seed, const unsigned int generation, const unsigned int index, const unsigned int stream);
+GAULFUNC unsigned int	random_counter_rand(random_counter *rc);
+GAULFUNC random_counter	*random_set_thread_counter(random_counter *rc);
+
 #define random_int_full	random_rand
 
 #ifdef HAVE_SLANG
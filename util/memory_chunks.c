@@ -38,6 +38,10 @@
 	       	mem_chunk_reset() or mem_chunk_free() to implicitly
 	       	deallocate all memory atoms (which would normally be
 		a valid thing to do).
+
+		Each atom of a freeable chunk is preceded by a hidden
+		pointer to the memory area that owns it, so releasing
+		an atom never requires a search.
  
 		This is thread safe.
 
@@ -50,7 +54,6 @@
  
   Known bugs:	High padding may be offset from the real end of the data - so some
  		overflows will be missed.
-		Much of the tree handling code may now be optimised.
  
  **********************************************************************/
 
@@ -66,22 +69,6 @@
 #   define IS_MEMORY_PADDING    0
 #endif
 
-typedef void *Key_t;
-
-typedef struct node_s
-  {
-  struct node_s *left;		/* Left subtree. */
-  struct node_s *right;		/* Right subtree. */
-  int		balance;	/* Height (left) - height (right). */
-  Key_t		key;		/* The key for this node. */
-  vpointer	data;		/* Data stored at this node. */
-  } node_t;
-
-typedef struct
-  {
-  node_t	*root;
-  } tree_t;
-
 typedef struct FreeAtom_t
   {
   struct FreeAtom_t *next;
@@ -102,558 +89,42 @@ struct MemChunk_t
   unsigned int	num_mem_areas;		/* The total number of memory areas */
   unsigned int	num_unused_areas;	/* The number of areas that may be deallocated */
   size_t	atom_size;		/* The size of an atom (used in mimic routines) */
+  size_t	owner_size;		/* The size of the owner header preceding each atom */
+  size_t	atom_stride;		/* The offset between atoms, including any owner header */
   size_t	area_size;		/* The size of a memory area */
   MemArea	*mem_area;		/* The current memory area */
   MemArea	*mem_areas;		/* A list of all the memory areas owned by this chunk */
   MemArea	*free_mem_area;		/* Free area... which is about to be destroyed */
   FreeAtom	*free_atoms;		/* Free atoms list */
-  tree_t	*mem_tree;		/* Tree of memory areas sorted by memory address */
+  boolean	freeable;		/* Whether atoms may be individually released */
   long		num_atoms_alloc;	/* The number of allocated atoms (only used in mimic routines) */
   };
 
 
 /*
- * Private function prototypes.
- */
-static node_t	*node_new(Key_t key, void *data);
-static void	node_free(node_t *node);
-static void	node_delete(node_t *node);
-static node_t	*node_insert(node_t *node, Key_t key,
-					     void *data, boolean *inserted);
-static node_t	*node_remove(node_t *node,
-                                             Key_t key, void **removed_data);
-static node_t	*node_balance(node_t *node);
-static node_t	*node_remove_leftmost(node_t *node,
-						     node_t **leftmost);
-static node_t	*node_restore_left_balance(node_t *node,
-						     int old_balance);
-static node_t	*node_restore_right_balance(node_t *node,
-						     int old_balance);
-static int	node_height(node_t *node);
-static node_t	*node_rotate_left(node_t *node);
-static node_t	*node_rotate_right(node_t *node);
-
-/*
- * Compilation constants.
- */
-#define _NODE_BUFFER_NUM_INCR	16
-#define _NODE_BUFFER_SIZE		1024
-
-/*
- * Global variables.
+ * The atoms of a freeable chunk are each preceded by an owner header,
+ * which points back to the MemArea from which they were allocated.
+ * This gives a constant time lookup of an atom's area when it is
+ * released, or popped from the free atoms list.
  */
-static node_t		*node_free_list = NULL;
-static int		num_trees = 0;	/* Count number of trees in use. */
-static int		buffer_num = -1;
-static int		num_buffers = 0;
-static int		num_used = _NODE_BUFFER_SIZE;
-static node_t		**node_buffers = NULL;
+#define MEMORY_OWNER_SIZE	( sizeof(MemArea *) + (MEMORY_ALIGN_SIZE - sizeof(MemArea *) % MEMORY_ALIGN_SIZE) % MEMORY_ALIGN_SIZE )
+#define ATOM_OWNER(C,X)		( *((MemArea **) (((unsigned char *)(X))-(C)->owner_size)) )
 
-/*
- * Note that a single coarse thread lock is used when a number of
- * less coarse locks might be better.
- */
-THREAD_LOCK_DEFINE_STATIC(node_buffer_lock);
-#ifdef USE_OPENMP
-static boolean mem_chunk_openmp_initialised = FALSE;
-#endif
 
 /*
  * This function must be called before any other functions is OpenMP
  * code is to be used.  Can be safely called when OpenMP code is not
  * being used, and can be safely called more than once.
+ * There is no longer any global state shared between memory chunks,
+ * so this is now a no-op.
  */
 void mem_chunk_init_openmp(void)
   {
 
-#ifdef USE_OPENMP
-  if (mem_chunk_openmp_initialised == FALSE)
-    {
-    omp_init_lock(&node_buffer_lock);
-    mem_chunk_openmp_initialised = TRUE;
-    }
-#endif
-
-  return;
-  }
-
-
-
-/*
- * Private functions.
- */
-
-/*
- * Deallocate all memory associated with buffers.  Should
- * never be called outside of a "node_buffer_lock"
- * block.
- */
-static void _destroy_buffers(void)
-  {
-
-  while (buffer_num >= 0)
-    {
-    s_free(node_buffers[buffer_num]);
-    buffer_num--;
-    }
-
-  s_free(node_buffers);
-  node_buffers = NULL;
-  num_buffers = 0;
-  num_used = _NODE_BUFFER_SIZE;
-
-  node_free_list = NULL;
-
-  return;
-  }
-
-
-static node_t *node_new(Key_t key, void *data)
-  {
-  node_t *node;
-
-  THREAD_LOCK(node_buffer_lock);
-/*
- * Find an unused node.  Look for unused node in current buffer, then
- * in the free node list, then allocate new buffer.
- */
-  if (num_used < _NODE_BUFFER_SIZE)
-    {
-    node = &(node_buffers[buffer_num][num_used]);
-    num_used++;
-    }
-  else
-    {
-    if (node_free_list)
-      {
-      node = node_free_list;
-      node_free_list = node->right;
-      }
-    else
-      {
-      buffer_num++;
-
-      if (buffer_num == num_buffers)
-        {
-        num_buffers += _NODE_BUFFER_NUM_INCR;
-        node_buffers = s_realloc(node_buffers, sizeof(node_t *)*num_buffers);
-        }
-
-      node_buffers[buffer_num] = malloc(sizeof(node_t)*_NODE_BUFFER_SIZE);
-
-      if (!node_buffers[buffer_num]) die("Unable to allocate memory.");
-
-      node = node_buffers[buffer_num];
-      num_used = 1;
-      }
-    }
-  THREAD_UNLOCK(node_buffer_lock);
-
-  node->balance = 0;
-  node->left = NULL;
-  node->right = NULL;
-  node->key = key;
-  node->data = data;
-
-  return node;
-  }
-
-
-static void node_free(node_t *node)
-  {
-  THREAD_LOCK(node_buffer_lock);
-  node->right = node_free_list;
-  node_free_list = node;
-  THREAD_UNLOCK(node_buffer_lock);
-
-  return;
-  }
-
-
-static void node_delete(node_t *node)
-  {
-  if (node)
-    {
-    node_delete(node->right);
-    node_delete(node->left);
-    node_free(node);
-    }
-
-  return;
-  }
-
-
-/*
- * Systematically search tree with a search function which has the
- * same ordering as the tree.
- * This iterative version is much faster than the equivalent recursive version.
- */
-static void *node_ordered_search(node_t *node, void *userdata)
-  {
-
-  while (node)
-    {
-    if (userdata < (void *) ((MemArea *)node->data)->mem)
-      node=node->left;
-    else if (userdata > (void *) &(((MemArea *)node->data)->mem[((MemArea *)node->data)->index]))
-      node=node->right;
-    else
-      return node->data;
-    }
-
-  return NULL;
-  }
-
-
-static node_t *node_insert(node_t *node,
-		    Key_t key, void *data, boolean *inserted)
-  {
-  int old_balance;
-
-  if (!node)
-    {
-    *inserted = TRUE;
-    return node_new(key, data);
-    }
-
-  if (key < node->key)
-    {
-    if (node->left)
-      {
-      old_balance = node->left->balance;
-      node->left = node_insert(node->left, key, data, inserted);
-
-      if ((old_balance != node->left->balance) && node->left->balance)
-        node->balance--;
-      }
-    else
-      {
-      *inserted = TRUE;
-      node->left = node_new(key, data);
-      node->balance--;
-      }
-    }
-  else if (key > node->key)
-    {
-    if (node->right)
-      {
-      old_balance = node->right->balance;
-      node->right = node_insert(node->right, key, data, inserted);
-
-      if ((old_balance != node->right->balance) && node->right->balance)
-        node->balance++;
-      }
-    else
-      {
-      *inserted = TRUE;
-      node->right = node_new(key, data);
-      node->balance++;
-      }
-    }
-  else
-    {	/* key == node->key */
-/*
-    *inserted = FALSE;
- */
-    printf("WARNING: -- Replaced node -- (Key clash?)\n");
-
-    node->data = data;
-    return node;
-    }
-
-  if (*inserted && (node->balance < -1 || node->balance > 1))
-    node = node_balance(node);
-
-  return node;
-  }
-
-
-static node_t *node_remove(node_t *node,
-                            Key_t key, void **removed_data)
-  {
-  node_t	*new_root;
-  int		old_balance;
-
-  if (!node) return NULL;
-
-  if (key < node->key)
-    {
-    if (node->left)
-      {
-      old_balance = node->left->balance;
-      node->left = node_remove(node->left, key, removed_data);
-      node = node_restore_left_balance(node, old_balance);
-      }
-    }
-  else if (key > node->key)
-    {
-    if (node->right)
-      {
-      old_balance = node->right->balance;
-      node->right = node_remove(node->right, key, removed_data);
-      node = node_restore_right_balance(node, old_balance);
-      }
-    }
-  else if (key == node->key)
-    {
-    node_t *removed_node;
-
-    removed_node = node;
-
-    if (!node->right)
-      {
-      node = node->left;
-      }
-    else
-      {
-      old_balance = node->right->balance;
-      node->right = node_remove_leftmost (node->right, &new_root);
-      new_root->left = node->left;
-      new_root->right = node->right;
-      new_root->balance = node->balance;
-      node = node_restore_right_balance (new_root, old_balance);
-      }
-
-    *removed_data = removed_node->data;
-    node_free(removed_node);
-    }
-
-  return node;
-  }
-
-
-static node_t *node_balance(node_t *node)
-  {
-  if (node->balance < -1)
-    {
-    if (node->left->balance > 0)
-      node->left = node_rotate_left(node->left);
-    node = node_rotate_right (node);
-    }
-  else if (node->balance > 1)
-    {
-    if (node->right->balance < 0)
-      node->right = node_rotate_right(node->right);
-    node = node_rotate_left (node);
-    }
-
-  return node;
-  }
-
-
-static node_t *node_remove_leftmost(node_t  *node,
-			     node_t **leftmost)
-  {
-  int old_balance;
-
-  if (!node->left)
-    {
-    *leftmost = node;
-    return node->right;
-    }
-
-  old_balance = node->left->balance;
-  node->left = node_remove_leftmost(node->left, leftmost);
-  return node_restore_left_balance(node, old_balance);
-  }
-
-
-static node_t *node_restore_left_balance(node_t	*node,
-				  int		old_balance)
-  {
-  if ( (!node->left) || ((node->left->balance != old_balance) &&
-           (node->left->balance == 0)) )
-    {
-    node->balance++;
-    }
-
-  if (node->balance > 1) return node_balance(node);
-
-  return node;
-  }
-
-
-static node_t *node_restore_right_balance(node_t	*node,
-				   int		old_balance)
-  {
-  if ( (!node->right) || ((node->right->balance != old_balance) &&
-	   (node->right->balance == 0)) )
-    {
-    node->balance--;
-    }
-
-  if (node->balance < -1) return node_balance(node);
-
-  return node;
-  }
-
-
-static int node_height(node_t *node)
-  {
-  int left_height;
-  int right_height;
-
-  if (!node) return 0;
-
-  if (node->left)
-    left_height = node_height(node->left);
-  else
-    left_height = 0;
-
-  if (node->right)
-    right_height = node_height(node->right);
-  else
-    right_height = 0;
-
-  return MAX(left_height, right_height) + 1;
-  }
-
-
-static node_t *node_rotate_left(node_t *node)
-  {
-  node_t *right;
-  int a_bal;
-  int b_bal;
-
-  right = node->right;
-
-  node->right = right->left;
-  right->left = node;
-
-  a_bal = node->balance;
-  b_bal = right->balance;
-
-  if (b_bal <= 0)
-    {
-    if (a_bal >= 1) right->balance = b_bal - 1;
-    else right->balance = a_bal + b_bal - 2;
-
-    node->balance = a_bal - 1;
-    }
-  else
-    {
-    if (a_bal <= b_bal) right->balance = a_bal - 2;
-    else right->balance = b_bal - 1;
-
-    node->balance = a_bal - b_bal - 1;
-    }
-
-  return right;
-  }
-
-
-static node_t *node_rotate_right(node_t *node)
-  {
-  node_t *left;
-  int a_bal;
-  int b_bal;
-
-  left = node->left;
-
-  node->left = left->right;
-  left->right = node;
-
-  a_bal = node->balance;
-  b_bal = left->balance;
-
-  if (b_bal <= 0)
-    {
-    if (b_bal > a_bal) left->balance = b_bal + 1;
-    else left->balance = a_bal + 2;
-
-    node->balance = a_bal - b_bal + 1;
-    }
-  else
-    {
-    if (a_bal <= -1) left->balance = b_bal + 1;
-    else left->balance = a_bal + b_bal + 2;
-
-    node->balance = a_bal + 1;
-    }
-
-  return left;
-  }
-
-
-static tree_t *tree_new(void)
-  {
-  tree_t *tree;
-
-  num_trees++;
-
-  if (!(tree = malloc(sizeof(tree_t))) )
-    die("Unable to allocate memory.");
-
-  tree->root = NULL;
-
-  return tree;
-  }
-
-
-static void delete(tree_t *tree)
-  {
-  if (!tree) return;
-
-  node_delete(tree->root);
-
-  s_free(tree);
-
-  num_trees--;
-
-  THREAD_LOCK(node_buffer_lock);
-  if (num_trees == 0)
-    _destroy_buffers();
-  THREAD_UNLOCK(node_buffer_lock);
-
   return;
   }
 
 
-static boolean insert(tree_t *tree, void *data)
-  {
-  boolean	inserted=FALSE;
-
-  if (!data) die("Internal error: Trying to insert NULL data.");
-  if (!tree) die("Internal error: Trying to insert into NULL tree.");
-
-  tree->root = node_insert(tree->root, (Key_t) ((MemArea *)data)->mem, data, &inserted);
-
-  return inserted;
-  }
-
-
-static void *remove_data(tree_t *tree, void *data)
-  {
-  void *removed=NULL;
-
-  if (!tree || !tree->root) return NULL;
-
-  tree->root = node_remove(tree->root, (Key_t) ((MemArea *)data)->mem, &removed);
-
-  return removed;
-  }
-
-
-static void *remove_key(tree_t *tree, Key_t key)
-  {
-  void *removed=NULL;
-
-  if (!tree || !tree->root) return NULL;
-
-  tree->root = node_remove(tree->root, key, &removed);
-
-  return removed;
-  }
-
-
-static void *ordered_search(tree_t *tree, void *userdata)
-  {
-  if (!tree || !tree->root) return NULL;
-
-  return node_ordered_search(tree->root, userdata);
-  }
-
-
 /*
  * Padding functions:
  */
@@ -698,11 +169,12 @@ static int check_pad_high(MemChunk *mem_chunk, void *mem)
 boolean mem_chunk_has_freeable_atoms_real(MemChunk *mem_chunk)
   {
 
-  return mem_chunk->mem_tree?TRUE:FALSE;
+  return mem_chunk->freeable;
   }
 
 
-static MemChunk *_mem_chunk_new(size_t atom_size, unsigned int num_atoms)
+static MemChunk *_mem_chunk_new(size_t atom_size, unsigned int num_atoms,
+                                boolean freeable)
   {
   MemChunk	*mem_chunk;
 
@@ -730,8 +202,10 @@ static MemChunk *_mem_chunk_new(size_t atom_size, unsigned int num_atoms)
   mem_chunk->free_atoms = NULL;
   mem_chunk->mem_areas = NULL;
   mem_chunk->atom_size = atom_size;
-  mem_chunk->area_size = atom_size*num_atoms;
-  mem_chunk->mem_tree = NULL;
+  mem_chunk->owner_size = freeable?MEMORY_OWNER_SIZE:0;
+  mem_chunk->atom_stride = mem_chunk->owner_size+atom_size;
+  mem_chunk->area_size = mem_chunk->atom_stride*num_atoms;
+  mem_chunk->freeable = freeable;
   
   return mem_chunk;
   }
@@ -759,7 +233,7 @@ MemChunk *mem_chunk_new_unfreeable_real(size_t atom_size, unsigned int num_atoms
   if (atom_size<1) die("Passed atom size is < 1 byte.");
   if (num_atoms<1) die("Passed number of atoms is < 1.");
 
-  mem_chunk = _mem_chunk_new(atom_size, num_atoms);
+  mem_chunk = _mem_chunk_new(atom_size, num_atoms, FALSE);
 
   return mem_chunk;
   }
@@ -772,9 +246,8 @@ MemChunk *mem_chunk_new_real(size_t atom_size, unsigned int num_atoms)
   if (atom_size<1) die("Passed atom size is < 1 byte.");
   if (num_atoms<1) die("Passed number of atoms is < 1.");
 
-  mem_chunk = _mem_chunk_new(atom_size, num_atoms);
-  mem_chunk->mem_tree = tree_new();
-  
+  mem_chunk = _mem_chunk_new(atom_size, num_atoms, TRUE);
+
   return mem_chunk;
   }
 
@@ -794,8 +267,6 @@ void mem_chunk_destroy_real(MemChunk *mem_chunk)
     free(temp_area);
     }
   
-  delete(mem_chunk->mem_tree);
-  
   free(mem_chunk);
 
   return;
@@ -820,7 +291,7 @@ void *mem_chunk_alloc_real(MemChunk *mem_chunk)
       mem_chunk->free_atoms = mem_chunk->free_atoms->next;
 
       /* Determine which area this piece of memory is allocated from */
-      temp_area = ordered_search(mem_chunk->mem_tree, mem);
+      temp_area = ATOM_OWNER(mem_chunk, mem);
 
       /* If the area is unused, then it may be destroyed.
        * We check to see if all of the segments on the free list that
@@ -836,7 +307,7 @@ void *mem_chunk_alloc_real(MemChunk *mem_chunk)
       if (temp_area->used==0)
         {
           /* Update the "free" memory available in that area */
-          temp_area->free += mem_chunk->atom_size;
+          temp_area->free += mem_chunk->atom_stride;
 
           if (temp_area->free == mem_chunk->area_size)
             {
@@ -854,11 +325,6 @@ void *mem_chunk_alloc_real(MemChunk *mem_chunk)
                   if (temp_area == mem_chunk->mem_areas)
                     mem_chunk->mem_areas = mem_chunk->mem_areas->next;
 
-                  if (mem_chunk->mem_tree)
-                    {
-                    if (!remove_data(mem_chunk->mem_tree, temp_area)) die("Unable to find temp_area.");
-                    }
-
                   free (temp_area);
                 }
               else
@@ -894,7 +360,7 @@ void *mem_chunk_alloc_real(MemChunk *mem_chunk)
    * use the "free_mem_area".  Otherwise we'll just malloc the memory area.
    */
   if ((!mem_chunk->mem_area) ||
-      ((mem_chunk->mem_area->index + mem_chunk->atom_size) > mem_chunk->area_size))
+      ((mem_chunk->mem_area->index + mem_chunk->atom_stride) > mem_chunk->area_size))
     {
       if (mem_chunk->free_mem_area)
         {
@@ -921,9 +387,6 @@ void *mem_chunk_alloc_real(MemChunk *mem_chunk)
           if (mem_chunk->mem_areas)
             mem_chunk->mem_areas->prev = mem_chunk->mem_area;
           mem_chunk->mem_areas = mem_chunk->mem_area;
-
-          if (mem_chunk->mem_tree)
-            insert(mem_chunk->mem_tree, mem_chunk->mem_area);
         }
 
       mem_chunk->mem_area->index = 0;
@@ -934,9 +397,11 @@ void *mem_chunk_alloc_real(MemChunk *mem_chunk)
 /*
  * Get the memory and modify the state variables appropriately.
  */
-  mem = (vpointer) &(mem_chunk->mem_area->mem[mem_chunk->mem_area->index]);
-  mem_chunk->mem_area->index += mem_chunk->atom_size;
-  mem_chunk->mem_area->free -= mem_chunk->atom_size;
+  mem = (vpointer) &(mem_chunk->mem_area->mem[mem_chunk->mem_area->index+mem_chunk->owner_size]);
+  if (mem_chunk->freeable)
+    ATOM_OWNER(mem_chunk, mem) = mem_chunk->mem_area;
+  mem_chunk->mem_area->index += mem_chunk->atom_stride;
+  mem_chunk->mem_area->free -= mem_chunk->atom_stride;
   mem_chunk->mem_area->used++;
 
 #ifdef MEMORY_PADDING
@@ -959,7 +424,7 @@ void mem_chunk_free_real(MemChunk *mem_chunk, void *mem)
   FreeAtom *free_atom;
 
   if (!mem_chunk) die("Null pointer to mem_chunk passed.");
-  if (!mem_chunk->mem_tree) die("MemChunk passed has no freeable atoms.");
+  if (!mem_chunk->freeable) die("MemChunk passed has no freeable atoms.");
   if (!mem) die("NULL pointer passed.");
 
 #ifdef MEMORY_PADDING
@@ -977,7 +442,7 @@ void mem_chunk_free_real(MemChunk *mem_chunk, void *mem)
   free_atom->next = mem_chunk->free_atoms;
   mem_chunk->free_atoms = free_atom;
 
-  if (!(temp_area = ordered_search(mem_chunk->mem_tree, mem)) )
+  if (!(temp_area = ATOM_OWNER(mem_chunk, mem)) )
     die("Unable to find temp_area.");
 
   temp_area->used--;
@@ -1000,60 +465,51 @@ void mem_chunk_clean_real(MemChunk *mem_chunk)
   void *mem;
 
   if (!mem_chunk) die("Null pointer to mem_chunk passed.");
-  if (!mem_chunk->mem_tree) die("MemChunk passed has no freeable atoms.");
+  if (!mem_chunk->freeable) die("MemChunk passed has no freeable atoms.");
 
-  if (mem_chunk->mem_tree)
-    {
-    prev_free_atom = NULL;
-    temp_free_atom = mem_chunk->free_atoms;
+  prev_free_atom = NULL;
+  temp_free_atom = mem_chunk->free_atoms;
 
-    while (temp_free_atom)
-      {
-      mem = (vpointer) temp_free_atom;
+  while (temp_free_atom)
+    {
+    mem = (vpointer) temp_free_atom;
 
-      if (!(mem_area = ordered_search(mem_chunk->mem_tree, mem)) ) die("mem_area not found.");
+    if (!(mem_area = ATOM_OWNER(mem_chunk, mem)) ) die("mem_area not found.");
 
 /*
  * If this memory area is unused, delete the area, list node and decrement the free mem.
  */
-      if (mem_area->used==0)
-        {
-        if (prev_free_atom)
-          prev_free_atom->next = temp_free_atom->next;
-        else
-          mem_chunk->free_atoms = temp_free_atom->next;
-        temp_free_atom = temp_free_atom->next;
-
-        mem_area->free += mem_chunk->atom_size;
-        if (mem_area->free == mem_chunk->area_size)
-          {
-          mem_chunk->num_mem_areas--;
-          mem_chunk->num_unused_areas--;
-
-          if (mem_area->next)
-          mem_area->next->prev = mem_area->prev;
-          if (mem_area->prev)
-            mem_area->prev->next = mem_area->next;
-          if (mem_area == mem_chunk->mem_areas)
-            mem_chunk->mem_areas = mem_chunk->mem_areas->next;
-          if (mem_area == mem_chunk->mem_area)
-            mem_chunk->mem_area = NULL;
- 
-          if (mem_chunk->mem_tree)
-            {
-            if (!remove_key(mem_chunk->mem_tree, (Key_t) mem_area))
-              die("mem_area not found.");
-            }
-
-          free(mem_area);
-          }
-        }
+    if (mem_area->used==0)
+      {
+      if (prev_free_atom)
+        prev_free_atom->next = temp_free_atom->next;
       else
+        mem_chunk->free_atoms = temp_free_atom->next;
+      temp_free_atom = temp_free_atom->next;
+
+      mem_area->free += mem_chunk->atom_stride;
+      if (mem_area->free == mem_chunk->area_size)
         {
-        prev_free_atom = temp_free_atom;
-        temp_free_atom = temp_free_atom->next;
+        mem_chunk->num_mem_areas--;
+        mem_chunk->num_unused_areas--;
+
+        if (mem_area->next)
+        mem_area->next->prev = mem_area->prev;
+        if (mem_area->prev)
+          mem_area->prev->next = mem_area->next;
+        if (mem_area == mem_chunk->mem_areas)
+          mem_chunk->mem_areas = mem_chunk->mem_areas->next;
+        if (mem_area == mem_chunk->mem_area)
+          mem_chunk->mem_area = NULL;
+
+        free(mem_area);
         }
       }
+    else
+      {
+      prev_free_atom = temp_free_atom;
+      temp_free_atom = temp_free_atom->next;
+      }
     }
 
   return;
@@ -1069,8 +525,10 @@ void mem_chunk_reset_real(MemChunk *mem_chunk)
   
   mem_areas = mem_chunk->mem_areas;
   mem_chunk->num_mem_areas = 0;
+  mem_chunk->num_unused_areas = 0;
   mem_chunk->mem_areas = NULL;
   mem_chunk->mem_area = NULL;
+  mem_chunk->free_mem_area = NULL;
   
   while (mem_areas)
     {
@@ -1080,12 +538,6 @@ void mem_chunk_reset_real(MemChunk *mem_chunk)
     }
   
   mem_chunk->free_atoms = NULL;
-  
-  if (mem_chunk->mem_tree)
-    {
-    delete(mem_chunk->mem_tree);
-    mem_chunk->mem_tree = tree_new();
-    }
 
   return;
   }
@@ -1100,10 +552,10 @@ static int memarea_check_bounds(MemChunk *mem_chunk, MemArea *mem_area)
 
   while (index < mem_area->index)
     {
-    mem = (unsigned char*) &mem_area->mem[index];
+    mem = (unsigned char*) &mem_area->mem[index+mem_chunk->owner_size];
     if (check_pad_low(mem_chunk, mem)!=0) count++;
     if (check_pad_high(mem_chunk, mem)!=0) count++;
-    index += mem_chunk->atom_size;
+    index += mem_chunk->atom_stride;
     }
 
   return count;
@@ -1176,7 +628,7 @@ boolean mem_chunk_test_real(void)
     {
     tmem[i] = mem_chunk_alloc(tmem_chunk);
 
-    *tmem[i] = (unsigned char)i%254;
+    *tmem[i] = (unsigned char)(i%254);
     }
 
   for (i = 0; i < 1000; i++)
@@ -1200,7 +652,7 @@ boolean mem_chunk_test_real(void)
     {
     tmem[i] = mem_chunk_alloc(tmem_chunk);
 
-    *tmem[i] = (unsigned char)i%254;
+    *tmem[i] = (unsigned char)(i%254);
     }
 
   for (i = 0; i < 1000; i++)
@@ -1220,6 +672,8 @@ boolean mem_chunk_test_real(void)
     mem_chunk_free(tmem_chunk, tmem[i]);
     }
 
+  mem_chunk_destroy(tmem_chunk);
+
   printf("ok.\n");
 
   return TRUE;
@@ -1243,6 +697,7 @@ void mem_chunk_diagnostics_real(void)
   printf("FreeAtom           %lu\n", (unsigned long) sizeof(FreeAtom));
   printf("MemArea            %lu\n", (unsigned long) sizeof(MemArea));
   printf("MemChunk           %lu\n", (unsigned long) sizeof(MemChunk));
+  printf("owner header       %lu\n", (unsigned long) MEMORY_OWNER_SIZE);
   printf("==============================================================\n");
 
   return;
@@ -83,114 +83,1359 @@
 		o random_get_state() and random_set_state() may be used
 		  to set, save, restore, and query the current state.
 
+		o Threads other than the one which called random_seed()
+		  automatically draw from their own, non-overlapping,
+		  streams.  A stream may also be managed explicitly
+		  with random_stream_init() and random_stream_*().
+
 		These functions can be tested by compiling with
 		something like:
 		gcc -o testrand random_util.c -DRANDOM_UTIL_TEST
 
-  To do:	Gaussian/Boltzmann distributions.
-		Need a proper test of randomness.
-		Properly implement stack of states.
-		I could do with some handy documentation.
+  To do:	Gaussian/Boltzmann distributions.
+		Need a proper test of randomness.
+		Properly implement stack of states.
+		I could do with some handy documentation.
+
+ **********************************************************************/
+
+#include "gaul/random_util.h"
+
+/*
+ * PRNG constants.  Don't mess with these values willie-nillie.
+ */
+#define RANDOM_MM_ALPHA	55
+#define RANDOM_MM_BETA	24
+#define RANDOM_LC_ALPHA	3
+#define RANDOM_LC_BETA	257
+#define RANDOM_LC_GAMMA	RANDOM_RAND_MAX
+
+/*
+ * Stream generator constants.  The jump polynomial advances an
+ * xoshiro128** state by 2^64 steps.
+ */
+#define RANDOM_STREAM_MASK	0xFFFFFFFFU
+#define RANDOM_STREAM_ROTL(x, k)	((((x) << (k)) | (((x) & RANDOM_STREAM_MASK) >> (32-(k)))) & RANDOM_STREAM_MASK)
+
+/*
+ * Philox4x32-10 constants.
+ */
+#define RANDOM_PHILOX_M0	0xD2511F53U
+#define RANDOM_PHILOX_M1	0xCD9E8D57U
+#define RANDOM_PHILOX_W0	0x9E3779B9U
+#define RANDOM_PHILOX_W1	0xBB67AE85U
+#define RANDOM_PHILOX_ROUNDS	10
+
+/*
+ * Bulk fills.  RANDOM_FILL_LANES interleaved xoshiro128** generators
+ * are advanced together; values are mapped RANDOM_FILL_CHUNK at a
+ * time; fills shorter than RANDOM_FILL_MIN use random_rand() directly.
+ */
+#define RANDOM_FILL_LANES	8
+#define RANDOM_FILL_CHUNK	256
+#define RANDOM_FILL_MIN		32
+
+typedef struct random_lanes_t
+  {
+  unsigned int	s0[RANDOM_FILL_LANES];
+  unsigned int	s1[RANDOM_FILL_LANES];
+  unsigned int	s2[RANDOM_FILL_LANES];
+  unsigned int	s3[RANDOM_FILL_LANES];
+  } random_lanes;
+
+/*
+ * Ziggurat constants, from Marsaglia and Tsang, "The Ziggurat Method
+ * for Generating Random Variables", J. Stat. Software 5(8), 2000.
+ * R is the start of the tail and V the area of each layer.
+ */
+#define RANDOM_ZIG_NORMAL_LAYERS	128
+#define RANDOM_ZIG_NORMAL_R		3.442619855899
+#define RANDOM_ZIG_NORMAL_V		9.91256303526217e-3
+#define RANDOM_ZIG_EXP_LAYERS		256
+#define RANDOM_ZIG_EXP_R		7.697117470131487
+#define RANDOM_ZIG_EXP_V		3.949659822581572e-3
+#define RANDOM_ZIG_SCALE24		(1.0/16777216.0)
+#define RANDOM_ZIG_SCALE56		(1.0/72057594037927936.0)
+
+/*
+ * Global state variable stack.
+ * (Implemented using singly-linked list.)
+ */
+/*
+static GSList	*state_list=NULL;
+*/
+static random_state	current_state;
+static boolean		is_initialised=FALSE;
+static unsigned int	master_seed=0;
+
+THREAD_LOCK_DEFINE_STATIC(random_state_lock);
+
+/*
+ * Private state, or counter, installed by the calling thread, if any.
+ */
+static THREAD_LOCAL random_state	*thread_state=NULL;
+static THREAD_LOCAL random_counter	*thread_counter=NULL;
+
+/*
+ * Per-thread streams.  The thread which called random_seed() most
+ * recently owns current_state and draws from it directly.  Any other
+ * thread draws from its own stream, split from current_state.stream
+ * the first time that thread needs a random number after each reseed.
+ * seed_epoch counts calls to random_seed() and random_set_state().
+ * It is only written while random_state_lock is held, and is read
+ * with random_current_epoch().
+ */
+static unsigned int			seed_epoch=0;
+static THREAD_LOCAL unsigned int	owner_epoch=0;
+static THREAD_LOCAL random_stream	thread_stream;
+static THREAD_LOCAL unsigned int	stream_epoch=0;
+
+/*
+ * Ziggurat tables, built by the first call to random_seed().  For
+ * each layer, k is the fraction of its width which lies wholly under
+ * the density, w is its width and f is the density at its edge.
+ */
+static boolean	ziggurat_ready=FALSE;
+static double	zig_kn[RANDOM_ZIG_NORMAL_LAYERS];
+static double	zig_wn[RANDOM_ZIG_NORMAL_LAYERS];
+static double	zig_fn[RANDOM_ZIG_NORMAL_LAYERS];
+static double	zig_ke[RANDOM_ZIG_EXP_LAYERS];
+static double	zig_we[RANDOM_ZIG_EXP_LAYERS];
+static double	zig_fe[RANDOM_ZIG_EXP_LAYERS];
+
+/**********************************************************************
+ random_advance()
+ Synopsis:	Returns the next value from the given state's sequence
+		and updates that state.  No locking is done.
+  parameters:	random_state *state
+  return:	unsigned int
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static unsigned int random_advance(random_state *state)
+  {
+  unsigned int val;
+
+  val = (state->v[state->j]+state->v[state->k])
+        & RANDOM_RAND_MAX;
+
+  state->x = (state->x+1) % RANDOM_NUM_STATE_VALS;
+  state->j = (state->j+1) % RANDOM_NUM_STATE_VALS;
+  state->k = (state->k+1) % RANDOM_NUM_STATE_VALS;
+  state->v[state->x] = val;
+
+  return val;
+  }
+
+
+/**********************************************************************
+ random_current_epoch()
+ Synopsis:	Returns seed_epoch, which is zero until the PRNG has
+		been seeded.  The load is atomic, and everything
+		written before the epoch was published is visible
+		afterwards.  Without compiler support for atomics,
+		the lock is taken instead.
+  parameters:	none
+  return:	unsigned int
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static unsigned int random_current_epoch(void)
+  {
+#if defined(__GNUC__)
+  return __atomic_load_n(&seed_epoch, __ATOMIC_ACQUIRE);
+#else
+  unsigned int epoch;
+
+  if (!is_initialised) return 0;
+
+  THREAD_LOCK(random_state_lock);
+  epoch = seed_epoch;
+  THREAD_UNLOCK(random_state_lock);
+
+  return epoch;
+#endif
+  }
+
+
+/**********************************************************************
+ random_publish_epoch()
+ Synopsis:	Starts a new epoch, so that every thread splits a
+		fresh stream from current_state.stream, and makes the
+		calling thread the owner of current_state.  Must be
+		called with random_state_lock held.
+  parameters:	none
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+static void random_publish_epoch(void)
+  {
+#if defined(__GNUC__)
+  __atomic_store_n(&seed_epoch, seed_epoch+1, __ATOMIC_RELEASE);
+#else
+  seed_epoch++;
+#endif
+  owner_epoch = seed_epoch;
+
+  return;
+  }
+
+
+/**********************************************************************
+ random_rand()
+ Synopsis:	Replacement for the standard rand().
+		Returns a new pseudo-random value from the sequence, in
+		the range 0 to RANDOM_RAND_MAX inclusive, and updates
+		global state for next call.  size should be non-zero,
+		and state should be initialized.  If the calling
+		thread has installed a private state with
+		random_set_thread_state(), or a counter with
+		random_set_thread_counter(), that is used instead.
+		Otherwise, a thread other than the one which seeded
+		the PRNG draws from its own stream.  No lock is taken
+		unless the compiler lacks thread-local storage.
+  parameters:
+  return:	none
+  last updated:	17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC unsigned int random_rand(void)
+  {
+#if HAVE_THREAD_LOCAL==1
+  unsigned int epoch;	/* Current seed epoch. */
+#else
+  unsigned int val;
+#endif
+
+  if (thread_state) return random_advance(thread_state);
+  if (thread_counter) return random_counter_rand(thread_counter);
+
+#if HAVE_THREAD_LOCAL==1
+  epoch = random_current_epoch();
+
+  if (epoch == 0) die("Neither random_init() or random_seed() have been called.");
+
+  if (owner_epoch == epoch) return random_advance(&current_state);
+
+  if (stream_epoch != epoch)
+    {
+    random_stream_init(&thread_stream);
+    stream_epoch = epoch;
+    }
+
+  return random_stream_rand(&thread_stream);
+#else
+  if (!is_initialised) die("Neither random_init() or random_seed() have been called.");
+
+  THREAD_LOCK(random_state_lock);
+
+  val = random_advance(&current_state);
+
+  THREAD_UNLOCK(random_state_lock);
+
+  return val;
+#endif
+  } 
+
+
+/**********************************************************************
+  random_ziggurat_setup()
+  synopsis:	Build the Ziggurat tables for the normal and
+		exponential distributions.  The tables depend on
+		nothing but the constants above, so this only ever
+		needs to be done once.
+  parameters:	none
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void random_ziggurat_setup(void)
+  {
+  double	q;		/* Width of the base layer. */
+  double	x, x_prev;	/* Edges of successive layers. */
+  int		i;		/* Loop over layers. */
+
+/* Normal distribution, for x>=0. */
+  x = x_prev = RANDOM_ZIG_NORMAL_R;
+  q = RANDOM_ZIG_NORMAL_V/exp(-0.5*x*x);
+
+  zig_kn[0] = x/q;
+  zig_kn[1] = 0.0;
+  zig_wn[0] = q;
+  zig_wn[RANDOM_ZIG_NORMAL_LAYERS-1] = x;
+  zig_fn[0] = 1.0;
+  zig_fn[RANDOM_ZIG_NORMAL_LAYERS-1] = exp(-0.5*x*x);
+
+  for (i=RANDOM_ZIG_NORMAL_LAYERS-2; i>=1; i--)
+    {
+    x = sqrt(-2.0*log(RANDOM_ZIG_NORMAL_V/x + exp(-0.5*x*x)));
+    zig_kn[i+1] = x/x_prev;
+    x_prev = x;
+    zig_fn[i] = exp(-0.5*x*x);
+    zig_wn[i] = x;
+    }
+
+/* Exponential distribution. */
+  x = x_prev = RANDOM_ZIG_EXP_R;
+  q = RANDOM_ZIG_EXP_V/exp(-x);
+
+  zig_ke[0] = x/q;
+  zig_ke[1] = 0.0;
+  zig_we[0] = q;
+  zig_we[RANDOM_ZIG_EXP_LAYERS-1] = x;
+  zig_fe[0] = 1.0;
+  zig_fe[RANDOM_ZIG_EXP_LAYERS-1] = exp(-x);
+
+  for (i=RANDOM_ZIG_EXP_LAYERS-2; i>=1; i--)
+    {
+    x = -log(RANDOM_ZIG_EXP_V/x + exp(-x));
+    zig_ke[i+1] = x/x_prev;
+    x_prev = x;
+    zig_fe[i] = exp(-x);
+    zig_we[i] = x;
+    }
+
+  ziggurat_ready = TRUE;
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_ziggurat_uniform()
+  synopsis:	Uniform deviate in the range 0.0<r<=1.0, which is
+		safe to pass to log().
+  parameters:	none
+  return:	double
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static double random_ziggurat_uniform(void)
+  {
+  return ((double)random_rand()+1.0)/((double)RANDOM_RAND_MAX+1.0);
+  }
+
+
+/**********************************************************************
+  random_ziggurat_normal_fix()
+  synopsis:	Slow path of the normal Ziggurat sampler, taken
+		when a point falls outside the rectangular part of
+		its layer: sample from the tail for the base layer,
+		otherwise test the point against the density.  A
+		rejected point is replaced by a fresh sample.
+  parameters:	const int layer		Layer of the point.
+		const double x		Magnitude of the point.
+  return:	double	Magnitude of the deviate.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static double random_ziggurat_normal_fix(const int layer, const double x)
+  {
+  double	t, y;		/* Tail offset and test value. */
+
+  if (layer == 0)
+    {
+    do
+      {
+      t = -log(random_ziggurat_uniform())/RANDOM_ZIG_NORMAL_R;
+      y = -log(random_ziggurat_uniform());
+      } while (y+y < t*t);
+
+    return RANDOM_ZIG_NORMAL_R + t;
+    }
+
+  if ( zig_fn[layer] + random_ziggurat_uniform()*(zig_fn[layer-1]-zig_fn[layer])
+       < exp(-0.5*x*x) )
+    return x;
+
+  return random_unit_gaussian();
+  }
+
+
+/**********************************************************************
+  random_ziggurat_normal()
+  synopsis:	Normal Ziggurat sampler, from two raw values.  The
+		low 7 bits of lo select the layer and the next bit
+		the sign; the remaining 56 bits give the position
+		within the layer.
+  parameters:	const unsigned int hi
+		const unsigned int lo
+  return:	double
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static double random_ziggurat_normal(const unsigned int hi, const unsigned int lo)
+  {
+  int		layer=lo&0x7F;	/* Layer of the ziggurat. */
+  double	u, x;		/* Position within layer. */
+
+  u = ((double)hi*16777216.0 + (double)((lo>>8)&0xFFFFFF))*RANDOM_ZIG_SCALE56;
+  x = u*zig_wn[layer];
+
+  if (u >= zig_kn[layer]) x = random_ziggurat_normal_fix(layer, x);
+
+  return (lo&0x80) ? -x : x;
+  }
+
+
+/**********************************************************************
+  random_ziggurat_exponential()
+  synopsis:	Exponential Ziggurat sampler, from two raw values.
+		The low 8 bits of lo select the layer; the remaining
+		56 bits give the position within the layer.
+  parameters:	const unsigned int hi
+		const unsigned int lo
+  return:	double
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static double random_ziggurat_exponential(const unsigned int hi, const unsigned int lo)
+  {
+  int		layer=lo&0xFF;	/* Layer of the ziggurat. */
+  double	u, x;		/* Position within layer. */
+
+  u = ((double)hi*16777216.0 + (double)((lo>>8)&0xFFFFFF))*RANDOM_ZIG_SCALE56;
+  x = u*zig_we[layer];
+
+  if (u < zig_ke[layer]) return x;
+
+  if (layer == 0)
+    return RANDOM_ZIG_EXP_R - log(random_ziggurat_uniform());
+
+  if ( zig_fe[layer] + random_ziggurat_uniform()*(zig_fe[layer-1]-zig_fe[layer])
+       < exp(-x) )
+    return x;
+
+  return random_exponential();
+  }
+
+
+/**********************************************************************
+  random_seed()
+  synopsis:	Set seed for pseudo random number generator.
+		Uses the linear congruential algorithm to fill
+		state array.
+  parameters:	const unsigned int seed		Seed value.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_seed(const unsigned int seed)
+  { 
+#ifdef USE_OPENMP
+  if (is_initialised == FALSE)
+    {
+    omp_init_lock(&random_state_lock);
+    is_initialised = TRUE;
+    }
+#endif
+
+  THREAD_LOCK(random_state_lock);
+
+  if (!ziggurat_ready) random_ziggurat_setup();
+
+  master_seed = seed;
+  random_seed_state(&current_state, seed);
+  is_initialised = TRUE;
+  random_publish_epoch();
+
+  THREAD_UNLOCK(random_state_lock);
+
+  return;
+  } 
+
+
+/**********************************************************************
+  random_seed_state()
+  synopsis:	Seed a private state, in the same way that
+		random_seed() seeds the global state.
+  parameters:	random_state *state	State to seed.
+		const unsigned int seed		Seed value.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_seed_state(random_state *state, const unsigned int seed)
+  { 
+  int	i; 
+
+  state->v[0]=(seed & RANDOM_RAND_MAX);
+
+  for(i=1; i<RANDOM_NUM_STATE_VALS; i++)
+    state->v[i] = (RANDOM_LC_ALPHA * state->v[i-1]
+                          + RANDOM_LC_BETA) & RANDOM_RAND_MAX;
+
+  state->j = 0;
+  state->k = RANDOM_MM_ALPHA-RANDOM_MM_BETA;
+  state->x = RANDOM_MM_ALPHA-0;
+
+  random_stream_seed(&(state->stream), seed);
+
+  return;
+  } 
+
+
+/**********************************************************************
+  random_set_thread_state()
+  synopsis:	Install a private state for the calling thread.
+		Subsequent random_*() calls from this thread draw
+		from, and update, that state without locking.
+		Passing NULL reverts to the shared global state.
+		Without compiler support for thread-local storage
+		the installed state is shared by all threads.
+  parameters:	random_state *state	State to use, or NULL.
+  return:	The previously installed state, or NULL.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC random_state *random_set_thread_state(random_state *state)
+  { 
+  random_state	*previous=thread_state;
+
+  thread_state = state;
+
+  return previous;
+  } 
+
+
+/**********************************************************************
+  random_stream_seed()
+  synopsis:	Seed a stream.  The seed is spread over the 128-bit
+		xoshiro128** state with a 32-bit finalising hash.
+  parameters:	random_stream *stream	Stream to seed.
+		const unsigned int seed		Seed value.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_stream_seed(random_stream *stream, const unsigned int seed)
+  {
+  int		i;		/* Loop over state words. */
+  unsigned int	z;		/* Hashed value. */
+
+  for (i=0; i<4; i++)
+    {
+    z = (seed + (i+1)*0x9E3779B9U) & RANDOM_STREAM_MASK;
+    z = ((z ^ (z >> 16)) * 0x85EBCA6BU) & RANDOM_STREAM_MASK;
+    z = ((z ^ (z >> 13)) * 0xC2B2AE35U) & RANDOM_STREAM_MASK;
+    stream->s[i] = z ^ (z >> 16);
+    }
+
+  if ((stream->s[0] | stream->s[1] | stream->s[2] | stream->s[3]) == 0)
+    stream->s[0] = 1;
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_stream_rand()
+  synopsis:	Returns a new pseudo-random value from a stream, in
+		the range 0 to RANDOM_RAND_MAX inclusive.  No locking
+		is done, so a stream must only be used by one thread
+		at a time.
+  parameters:	random_stream *stream
+  return:	unsigned int
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC unsigned int random_stream_rand(random_stream *stream)
+  {
+  unsigned int	*s = stream->s;
+  unsigned int	val, t;
+
+  val = (RANDOM_STREAM_ROTL((s[1]*5) & RANDOM_STREAM_MASK, 7) * 9) & RANDOM_STREAM_MASK;
+  t = (s[1] << 9) & RANDOM_STREAM_MASK;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = RANDOM_STREAM_ROTL(s[3], 11);
+
+  return val & RANDOM_RAND_MAX;
+  }
+
+
+/**********************************************************************
+  random_stream_jump()
+  synopsis:	Advance a stream by 2^64 values.  Streams which are
+		jumped apart from a common state never overlap unless
+		more than 2^64 values are drawn from one of them.
+  parameters:	random_stream *stream
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_stream_jump(random_stream *stream)
+  {
+  static const unsigned int	jump[4] = { 0x8764000BU, 0xF542D2D3U, 0x6FA035C3U, 0x77F2DB5BU };
+  unsigned int	s0=0, s1=0, s2=0, s3=0;	/* Accumulated state. */
+  int		i, b;			/* Loop over jump polynomial. */
+
+  for (i=0; i<4; i++)
+    {
+    for (b=0; b<32; b++)
+      {
+      if (jump[i] & (1U << b))
+        {
+        s0 ^= stream->s[0];
+        s1 ^= stream->s[1];
+        s2 ^= stream->s[2];
+        s3 ^= stream->s[3];
+        }
+      random_stream_rand(stream);
+      }
+    }
+
+  stream->s[0] = s0;
+  stream->s[1] = s1;
+  stream->s[2] = s2;
+  stream->s[3] = s3;
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_stream_init()
+  synopsis:	Initialise a stream from the master seed, that is
+		the seed most recently passed to random_seed().
+		Every stream initialised this way starts 2^64 values
+		beyond the previous one, so streams never overlap.
+		The sequence of streams handed out is fixed by the
+		master seed.
+  parameters:	random_stream *stream	Stream to initialise.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_stream_init(random_stream *stream)
+  {
+
+  if (random_current_epoch() == 0) die("Neither random_init() or random_seed() have been called.");
+
+  THREAD_LOCK(random_state_lock);
+
+  *stream = current_state.stream;
+  random_stream_jump(&(current_state.stream));
+
+  THREAD_UNLOCK(random_state_lock);
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_stream_int()
+  synopsis:	Return a random integer between 0 and (N-1)
+		inclusive, from a stream.
+  parameters:	random_stream *stream
+		const unsigned int max
+  return:	unsigned int
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC unsigned int random_stream_int(random_stream *stream, const unsigned int max)
+  {
+  return (max==0) ? 0 : random_stream_rand(stream)%max;
+  }
+
+
+/**********************************************************************
+  random_stream_int_range()
+  synopsis:	Return a random integer between min and (max-1)
+		inclusive, from a stream.
+  parameters:	random_stream *stream
+		const int min
+		const int max
+  return:	int
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC int random_stream_int_range(random_stream *stream, const int min, const int max)
+  {
+  return (max-min==0) ? max : min + (random_stream_rand(stream)%(max-min));
+  }
+
+
+/**********************************************************************
+  random_stream_boolean_prob()
+  synopsis:	Return TRUE with the given probability, from a
+		stream.
+  parameters:	random_stream *stream
+		const double prob
+  return:	boolean
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC boolean random_stream_boolean_prob(random_stream *stream, const double prob)
+  {
+  return (boolean)(random_stream_rand(stream) <= (unsigned int)(prob*(double)RANDOM_RAND_MAX));
+  }
+
+
+/**********************************************************************
+  random_stream_unit_uniform()
+  synopsis:	Return a pseudo-random number with a uniform
+		distribution in the range 0.0=>r>1.0, from a stream.
+  parameters:	random_stream *stream
+  return:	double
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC double random_stream_unit_uniform(random_stream *stream)
+  {
+  return ( (((double)random_stream_rand(stream))/(double)RANDOM_RAND_MAX) );
+  }
+
+
+/**********************************************************************
+  random_stream_double_range()
+  synopsis:	Return a random double within the specified range,
+		from a stream.
+  parameters:	random_stream *stream
+		const double min
+		const double max
+  return:	double
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC double random_stream_double_range(random_stream *stream, const double min, const double max)
+  {
+  return ( (max-min)*(((double)random_stream_rand(stream))/(double)RANDOM_RAND_MAX) + min );
+  }
+
+
+/**********************************************************************
+  random_stream_unit_gaussian()
+  synopsis:	Random number with normal distribution, average 0.0,
+		deviation 1.0, from a stream.  Only one of each
+		pair of deviates is used, so that no state is held
+		outside the stream.
+  parameters:	random_stream *stream
+  return:	double
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC double random_stream_unit_gaussian(random_stream *stream)
+  {
+  double	r, u, v;
+
+  do
+    {
+    u = 2.0 * random_stream_unit_uniform(stream) - 1.0;
+    v = 2.0 * random_stream_unit_uniform(stream) - 1.0;
+    r = u*u + v*v;
+    } while (r >= 1.0 || r == 0.0);
+
+  return u*sqrt(-2.0 * log(r) / r);
+  }
+
+
+/**********************************************************************
+  random_lanes_seed()
+  synopsis:	Seed a set of interleaved generators for a bulk
+		fill.  Each lane is seeded from random_rand(), so a
+		bulk fill consumes the same source as the scalar
+		functions would, whether that is the global state, a
+		per-thread stream, a private state or a counter.
+  parameters:	random_lanes *lanes
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void random_lanes_seed(random_lanes *lanes)
+  {
+  random_stream	stream;		/* Used to hash each seed. */
+  int		lane;		/* Loop over lanes. */
+
+  for (lane=0; lane<RANDOM_FILL_LANES; lane++)
+    {
+    random_stream_seed(&stream, random_rand());
+    lanes->s0[lane] = stream.s[0];
+    lanes->s1[lane] = stream.s[1];
+    lanes->s2[lane] = stream.s[2];
+    lanes->s3[lane] = stream.s[3];
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_lanes_step()
+  synopsis:	Advance every lane once, writing RANDOM_FILL_LANES
+		values.  The lanes are independent xoshiro128**
+		generators held in separate arrays, so that the
+		compiler is able to vectorize this loop.
+  parameters:	random_lanes *lanes
+		unsigned int *out
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void random_lanes_step(random_lanes *lanes, unsigned int *out)
+  {
+  int		lane;		/* Loop over lanes. */
+  unsigned int	t;		/* Shifted state word. */
+
+  for (lane=0; lane<RANDOM_FILL_LANES; lane++)
+    {
+    out[lane] = (RANDOM_STREAM_ROTL((lanes->s1[lane]*5) & RANDOM_STREAM_MASK, 7) * 9) & RANDOM_STREAM_MASK;
+    t = (lanes->s1[lane] << 9) & RANDOM_STREAM_MASK;
+
+    lanes->s2[lane] ^= lanes->s0[lane];
+    lanes->s3[lane] ^= lanes->s1[lane];
+    lanes->s1[lane] ^= lanes->s2[lane];
+    lanes->s0[lane] ^= lanes->s3[lane];
+    lanes->s2[lane] ^= t;
+    lanes->s3[lane] = RANDOM_STREAM_ROTL(lanes->s3[lane], 11);
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_fill_begin()
+  synopsis:	Prepare the source for a bulk fill of num values.
+		Short fills are not worth seeding the lanes for, and
+		draw from random_rand() directly.
+  parameters:	random_lanes *lanes	Storage for the lanes.
+		const int num		Number of values required.
+  return:	random_lanes *	The lanes, or NULL for short fills.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static random_lanes *random_fill_begin(random_lanes *lanes, const int num)
+  {
+  if (num < RANDOM_FILL_MIN) return NULL;
+
+  random_lanes_seed(lanes);
+
+  return lanes;
+  }
+
+
+/**********************************************************************
+  random_fill_source()
+  synopsis:	Write num raw values, in the range 0 to
+		RANDOM_RAND_MAX inclusive, from the lanes, or from
+		random_rand() if lanes is NULL.
+  parameters:	random_lanes *lanes
+		unsigned int *out
+		const int num
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static void random_fill_source(random_lanes *lanes, unsigned int *out, const int num)
+  {
+  unsigned int	block[RANDOM_FILL_LANES];	/* Partial block. */
+  int		i;				/* Loop over values. */
+
+  if (!lanes)
+    {
+    for (i=0; i<num; i++)
+      out[i] = random_rand();
+    return;
+    }
+
+  for (i=0; i+RANDOM_FILL_LANES<=num; i+=RANDOM_FILL_LANES)
+    random_lanes_step(lanes, &out[i]);
+
+  if (i<num)
+    {
+    random_lanes_step(lanes, block);
+    memcpy(&out[i], block, (num-i)*sizeof(unsigned int));
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_fill_rand()
+  synopsis:	Fill an array with pseudo-random values, in the
+		range 0 to RANDOM_RAND_MAX inclusive.
+  parameters:	unsigned int *out	Array to fill.
+		const int num		Number of values.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_fill_rand(unsigned int *out, const int num)
+  {
+  random_lanes	lanes;
+
+  if (!out) die("Null pointer to array passed.");
+
+  random_fill_source(random_fill_begin(&lanes, num), out, num);
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_fill_double_range()
+  synopsis:	Fill an array with random doubles within the
+		specified range, distributed as for
+		random_double_range().
+  parameters:	double *out		Array to fill.
+		const int num		Number of values.
+		const double min
+		const double max
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_fill_double_range(double *out, const int num, const double min, const double max)
+  {
+  random_lanes	lanes, *source;			/* Source of values. */
+  unsigned int	raw[RANDOM_FILL_CHUNK];		/* Raw values. */
+  double	scale=(max-min)/(double)RANDOM_RAND_MAX;
+  int		i, j, n;			/* Loop over values. */
+
+  if (!out) die("Null pointer to array passed.");
+
+  source = random_fill_begin(&lanes, num);
+
+  for (i=0; i<num; i+=RANDOM_FILL_CHUNK)
+    {
+    n = MIN(RANDOM_FILL_CHUNK, num-i);
+    random_fill_source(source, raw, n);
+    for (j=0; j<n; j++)
+      out[i+j] = scale*(double)raw[j] + min;
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_fill_float_range()
+  synopsis:	Fill an array with random floats within the
+		specified range, distributed as for
+		random_float_range().
+  parameters:	float *out		Array to fill.
+		const int num		Number of values.
+		const float min
+		const float max
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_fill_float_range(float *out, const int num, const float min, const float max)
+  {
+  random_lanes	lanes, *source;			/* Source of values. */
+  unsigned int	raw[RANDOM_FILL_CHUNK];		/* Raw values. */
+  float		scale=(max-min)/(float)RANDOM_RAND_MAX;
+  int		i, j, n;			/* Loop over values. */
+
+  if (!out) die("Null pointer to array passed.");
+
+  source = random_fill_begin(&lanes, num);
+
+  for (i=0; i<num; i+=RANDOM_FILL_CHUNK)
+    {
+    n = MIN(RANDOM_FILL_CHUNK, num-i);
+    random_fill_source(source, raw, n);
+    for (j=0; j<n; j++)
+      out[i+j] = scale*(float)raw[j] + min;
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_fill_int_range()
+  synopsis:	Fill an array with random integers between min and
+		(max-1) inclusive.  The raw values are scaled, rather
+		than reduced modulo the range, which avoids both the
+		division and the bias of random_int_range().
+  parameters:	int *out		Array to fill.
+		const int num		Number of values.
+		const int min
+		const int max
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_fill_int_range(int *out, const int num, const int min, const int max)
+  {
+  random_lanes	lanes, *source;			/* Source of values. */
+  unsigned int	raw[RANDOM_FILL_CHUNK];		/* Raw values. */
+  double	scale=(double)(max-min)/((double)RANDOM_RAND_MAX+1.0);
+  int		i, j, n;			/* Loop over values. */
+
+  if (!out) die("Null pointer to array passed.");
+
+  if (max==min)
+    {
+    for (i=0; i<num; i++)
+      out[i] = max;
+    return;
+    }
+
+  source = random_fill_begin(&lanes, num);
+
+  for (i=0; i<num; i+=RANDOM_FILL_CHUNK)
+    {
+    n = MIN(RANDOM_FILL_CHUNK, num-i);
+    random_fill_source(source, raw, n);
+    for (j=0; j<n; j++)
+      out[i+j] = min + (int)(scale*(double)raw[j]);
+    }
+
+  return;
+  }
+
 
+/**********************************************************************
+  random_fill_boolean_prob()
+  synopsis:	Fill an array with booleans, each TRUE with the
+		given probability.
+  parameters:	boolean *out		Array to fill.
+		const int num		Number of values.
+		const double prob
+  return:	none
+  last updated: 17 Oct 2026
  **********************************************************************/
 
-#include "gaul/random_util.h"
+GAULFUNC void random_fill_boolean_prob(boolean *out, const int num, const double prob)
+  {
+  random_lanes	lanes, *source;			/* Source of values. */
+  unsigned int	raw[RANDOM_FILL_CHUNK];		/* Raw values. */
+  unsigned int	threshold=(unsigned int)(prob*(double)RANDOM_RAND_MAX);
+  int		i, j, n;			/* Loop over values. */
 
-/*
- * PRNG constants.  Don't mess with these values willie-nillie.
- */
-#define RANDOM_MM_ALPHA	55
-#define RANDOM_MM_BETA	24
-#define RANDOM_LC_ALPHA	3
-#define RANDOM_LC_BETA	257
-#define RANDOM_LC_GAMMA	RANDOM_RAND_MAX
+  if (!out) die("Null pointer to array passed.");
 
-/*
- * Global state variable stack.
- * (Implemented using singly-linked list.)
- */
-/*
-static GSList	*state_list=NULL;
-*/
-static random_state	current_state;
-static boolean		is_initialised=FALSE;
+  source = random_fill_begin(&lanes, num);
+
+  for (i=0; i<num; i+=RANDOM_FILL_CHUNK)
+    {
+    n = MIN(RANDOM_FILL_CHUNK, num-i);
+    random_fill_source(source, raw, n);
+    for (j=0; j<n; j++)
+      out[i+j] = (boolean)(raw[j] <= threshold);
+    }
+
+  return;
+  }
 
-THREAD_LOCK_DEFINE_STATIC(random_state_lock);
 
 /**********************************************************************
- random_rand()
- Synopsis:	Replacement for the standard rand().
-		Returns a new pseudo-random value from the sequence, in
-		the range 0 to RANDOM_RAND_MAX inclusive, and updates
-		global state for next call.  size should be non-zero,
-		and state should be initialized.
-  parameters:
+  random_fill_bitmask()
+  synopsis:	Fill a packed bit array, in the layout used by the
+		bitstring chromosomes, with bits each set with the
+		given probability.  For a probability of 0.5 every
+		raw value supplies 32 bits.  Unused bits in the final
+		byte are cleared.
+  parameters:	gaulbyte *mask		Bit array to fill.
+		const int num_bits	Number of bits.
+		const double prob
   return:	none
-  last updated:	30/12/00
+  last updated: 17 Oct 2026
  **********************************************************************/
 
-GAULFUNC unsigned int random_rand(void)
+GAULFUNC void random_fill_bitmask(gaulbyte *mask, const int num_bits, const double prob)
   {
-  unsigned int val;
+  random_lanes	lanes, *source;			/* Source of values. */
+  unsigned int	raw[RANDOM_FILL_CHUNK];		/* Raw values. */
+  unsigned int	threshold=(unsigned int)(prob*(double)RANDOM_RAND_MAX);
+  int		num_bytes=(num_bits+BYTEBITS-1)/BYTEBITS;
+  int		i, j, k, n;			/* Loop over values. */
 
-  if (!is_initialised) die("Neither random_init() or random_seed() have been called.");
+  if (!mask) die("Null pointer to bit array passed.");
 
-  THREAD_LOCK(random_state_lock);
+  if (prob == 0.5)
+    {
+    n = (num_bytes+3)/4;
+    source = random_fill_begin(&lanes, n);
 
-  val = (current_state.v[current_state.j]+current_state.v[current_state.k])
-        & RANDOM_RAND_MAX;
+    for (i=0; i<n; i+=RANDOM_FILL_CHUNK)
+      {
+      k = MIN(RANDOM_FILL_CHUNK, n-i);
+      random_fill_source(source, raw, k);
+      for (j=0; j<4*k && 4*i+j<num_bytes; j++)
+        mask[4*i+j] = (gaulbyte)((raw[j/4] >> (BYTEBITS*(j%4))) & 0xFF);
+      }
+    }
+  else
+    {
+    memset(mask, 0, num_bytes);
+    source = random_fill_begin(&lanes, num_bits);
 
-  current_state.x = (current_state.x+1) % RANDOM_NUM_STATE_VALS;
-  current_state.j = (current_state.j+1) % RANDOM_NUM_STATE_VALS;
-  current_state.k = (current_state.k+1) % RANDOM_NUM_STATE_VALS;
-  current_state.v[current_state.x] = val;
+    for (i=0; i<num_bits; i+=RANDOM_FILL_CHUNK)
+      {
+      n = MIN(RANDOM_FILL_CHUNK, num_bits-i);
+      random_fill_source(source, raw, n);
+      for (j=0; j<n; j++)
+        if (raw[j] <= threshold)
+          mask[(i+j)/BYTEBITS] |= (gaulbyte)(1<<((i+j)%BYTEBITS));
+      }
+    }
 
-  THREAD_UNLOCK(random_state_lock);
+  if (num_bits%BYTEBITS)
+    mask[num_bytes-1] &= (gaulbyte)((1<<(num_bits%BYTEBITS))-1);
 
-  return val;
-  } 
+  return;
+  }
 
 
 /**********************************************************************
-  random_seed()
-  synopsis:	Set seed for pseudo random number generator.
-		Uses the linear congruential algorithm to fill
-		state array.
-  parameters:	const unsigned int seed		Seed value.
+  random_fill_unit_gaussian()
+  synopsis:	Fill an array with random numbers with normal
+		distribution, average 0.0, deviation 1.0, using the
+		Ziggurat sampler.  Two raw values are consumed per
+		deviate; the rare points outside the rectangular
+		part of a layer draw further values with
+		random_rand().
+  parameters:	double *out		Array to fill.
+		const int num		Number of values.
   return:	none
-  last updated: 04 May 2004
+  last updated: 17 Oct 2026
  **********************************************************************/
 
-GAULFUNC void random_seed(const unsigned int seed)
-  { 
-  int	i; 
+GAULFUNC void random_fill_unit_gaussian(double *out, const int num)
+  {
+  random_lanes	lanes, *source;			/* Source of values. */
+  unsigned int	raw[RANDOM_FILL_CHUNK];		/* Raw values. */
+  int		i, j, n;			/* Loop over values. */
 
-#ifdef USE_OPENMP
-  if (is_initialised == FALSE)
+  if (!out) die("Null pointer to array passed.");
+
+  source = random_fill_begin(&lanes, 2*num);
+
+  for (i=0; i<num; i+=RANDOM_FILL_CHUNK/2)
     {
-    omp_init_lock(&random_state_lock);
-    is_initialised = TRUE;
+    n = MIN(RANDOM_FILL_CHUNK/2, num-i);
+    random_fill_source(source, raw, 2*n);
+    for (j=0; j<n; j++)
+      out[i+j] = random_ziggurat_normal(raw[2*j], raw[2*j+1]);
+    }
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_fill_exponential()
+  synopsis:	Fill an array with random numbers with an
+		exponential distribution, mean of 1.0, using the
+		Ziggurat sampler.
+  parameters:	double *out		Array to fill.
+		const int num		Number of values.
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_fill_exponential(double *out, const int num)
+  {
+  random_lanes	lanes, *source;			/* Source of values. */
+  unsigned int	raw[RANDOM_FILL_CHUNK];		/* Raw values. */
+  int		i, j, n;			/* Loop over values. */
+
+  if (!out) die("Null pointer to array passed.");
+
+  source = random_fill_begin(&lanes, 2*num);
+
+  for (i=0; i<num; i+=RANDOM_FILL_CHUNK/2)
+    {
+    n = MIN(RANDOM_FILL_CHUNK/2, num-i);
+    random_fill_source(source, raw, 2*n);
+    for (j=0; j<n; j++)
+      out[i+j] = random_ziggurat_exponential(raw[2*j], raw[2*j+1]);
     }
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_get_seed()
+  synopsis:	Return the seed most recently passed to random_seed().
+  parameters:	none
+  return:	unsigned int	The master seed.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC unsigned int random_get_seed(void)
+  {
+  return master_seed;
+  }
+
+
+/**********************************************************************
+  random_philox_mulhilo()
+  synopsis:	32x32 bit multiplication, returning both halves of
+		the 64-bit product.
+  parameters:	const unsigned int a
+		const unsigned int b
+		unsigned int *hi
+  return:	unsigned int	Low 32 bits of product.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+static unsigned int random_philox_mulhilo(const unsigned int a, const unsigned int b, unsigned int *hi)
+  {
+#if SIZEOF_LONG >= 8
+  unsigned long	product = (unsigned long)a * (unsigned long)b;
+
+  *hi = (unsigned int)(product >> 32);
+
+  return (unsigned int)(product & RANDOM_STREAM_MASK);
 #else
-  is_initialised = TRUE;
+  unsigned int	a_lo = a & 0xFFFFU, a_hi = a >> 16;
+  unsigned int	b_lo = b & 0xFFFFU, b_hi = b >> 16;
+  unsigned int	lolo, lohi, hilo, mid;
+
+  lolo = a_lo*b_lo;
+  lohi = a_lo*b_hi;
+  hilo = a_hi*b_lo;
+  mid = (lolo >> 16) + (lohi & 0xFFFFU) + (hilo & 0xFFFFU);
+
+  *hi = (a_hi*b_hi + (lohi >> 16) + (hilo >> 16) + (mid >> 16)) & RANDOM_STREAM_MASK;
+
+  return ((mid << 16) | (lolo & 0xFFFFU)) & RANDOM_STREAM_MASK;
 #endif
+  }
 
-  THREAD_LOCK(random_state_lock);
 
-  current_state.v[0]=(seed & RANDOM_RAND_MAX);
+/**********************************************************************
+  random_philox()
+  synopsis:	The Philox4x32-10 counter-based generator.  Maps a
+		128-bit counter and a 64-bit key to 128 random bits.
+		Each distinct (key, counter) pair gives an
+		independent output, so values may be drawn in any
+		order, from any thread, without shared state.
+  parameters:	const unsigned int counter[4]
+		const unsigned int key[2]
+		unsigned int out[4]
+  return:	none
+  last updated: 17 Oct 2026
+  references:	Salmon J.K., Moraes M.A., Dror R.O., Shaw D.E.,
+		"Parallel Random Numbers: As Easy as 1, 2, 3",
+		Proc. SC11 (2011)
+ **********************************************************************/
+
+GAULFUNC void random_philox(const unsigned int counter[4], const unsigned int key[2], unsigned int out[4])
+  {
+  unsigned int	c0=counter[0], c1=counter[1], c2=counter[2], c3=counter[3];
+  unsigned int	k0=key[0], k1=key[1];
+  unsigned int	hi0, hi1, lo0, lo1;
+  int		round;		/* Loop over rounds. */
 
-  for(i=1; i<RANDOM_NUM_STATE_VALS; i++)
-    current_state.v[i] = (RANDOM_LC_ALPHA * current_state.v[i-1]
-                          + RANDOM_LC_BETA) & RANDOM_RAND_MAX;
+  for (round=0; round<RANDOM_PHILOX_ROUNDS; round++)
+    {
+    lo0 = random_philox_mulhilo(RANDOM_PHILOX_M0, c0, &hi0);
+    lo1 = random_philox_mulhilo(RANDOM_PHILOX_M1, c2, &hi1);
 
-  current_state.j = 0;
-  current_state.k = RANDOM_MM_ALPHA-RANDOM_MM_BETA;
-  current_state.x = RANDOM_MM_ALPHA-0;
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
 
-  THREAD_UNLOCK(random_state_lock);
+    k0 = (k0 + RANDOM_PHILOX_W0) & RANDOM_STREAM_MASK;
+    k1 = (k1 + RANDOM_PHILOX_W1) & RANDOM_STREAM_MASK;
+    }
+
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
 
   return;
-  } 
+  }
+
+
+/**********************************************************************
+  random_counter_init()
+  synopsis:	Prepare a counter-based source of random numbers,
+		keyed by seed and generation, for the given entity
+		index.  The stream argument selects one of several
+		independent sequences for the same entity, for
+		example to separate islands.  The n-th value drawn
+		from it is fixed by (seed, generation, index, stream,
+		n), and nothing else.
+  parameters:	random_counter *rc
+		const unsigned int seed
+		const unsigned int generation
+		const unsigned int index
+		const unsigned int stream
+  return:	none
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC void random_counter_init(random_counter *rc,
+                                  const unsigned int seed,
+                                  const unsigned int generation,
+                                  const unsigned int index,
+                                  const unsigned int stream)
+  {
+
+  rc->key[0] = seed;
+  rc->key[1] = generation;
+  rc->counter[0] = 0;
+  rc->counter[1] = 0;
+  rc->counter[2] = index;
+  rc->counter[3] = stream;
+  rc->num_buffered = 0;
+
+  return;
+  }
+
+
+/**********************************************************************
+  random_counter_rand()
+  synopsis:	Return the next value from a counter-based source, in
+		the range 0 to RANDOM_RAND_MAX inclusive.
+  parameters:	random_counter *rc
+  return:	unsigned int
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC unsigned int random_counter_rand(random_counter *rc)
+  {
+
+  if (rc->num_buffered == 0)
+    {
+    random_philox(rc->counter, rc->key, rc->buffer);
+    rc->num_buffered = 4;
+
+    rc->counter[0] = (rc->counter[0]+1) & RANDOM_STREAM_MASK;
+    if (rc->counter[0] == 0) rc->counter[1]++;
+    }
+
+  return rc->buffer[4 - rc->num_buffered--] & RANDOM_RAND_MAX;
+  }
+
+
+/**********************************************************************
+  random_set_thread_counter()
+  synopsis:	Install a counter-based source for the calling
+		thread.  Subsequent random_*() calls from this thread
+		draw from it, so their results depend only on the
+		counter's key and not on the thread or on
+		scheduling.  Passing NULL removes it.
+  parameters:	random_counter *rc	Counter to use, or NULL.
+  return:	The previously installed counter, or NULL.
+  last updated: 17 Oct 2026
+ **********************************************************************/
+
+GAULFUNC random_counter *random_set_thread_counter(random_counter *rc)
+  {
+  random_counter	*previous=thread_counter;
+
+  thread_counter = rc;
+
+  return previous;
+  }
 
 
 /**********************************************************************
@@ -213,30 +1458,44 @@ GAULFUNC void random_tseed(void)
 /*************************************************************************
   random_get_state()
   synopsis:	Retrieve current state.  This can be used for saving
-		the current state.
+		the current state.  The state includes the source from
+		which per-thread streams are split.
   parameters:	none
   return:	random_state state
-  last updated:	16/05/00
+  last updated:	17 Oct 2026
 *************************************************************************/
 
 GAULFUNC random_state random_get_state(void)
   {
-  return current_state;
+  random_state	state;	/* Copy of current state. */
+
+  THREAD_LOCK(random_state_lock);
+  state = current_state;
+  THREAD_UNLOCK(random_state_lock);
+
+  return state;
   }
 
 
 /*************************************************************************
   random_set_state()
   synopsis:	Replace current state with specified state.
-		This can be used for restoring a saved state.
+		This can be used for restoring a saved state.  As
+		after random_seed(), the calling thread takes
+		ownership of the state, and every other thread splits
+		a fresh stream from the restored source the next time
+		it needs a random number.
   parameters:	random_state state
   return:	none
-  last updated:	16/05/00
+  last updated:	17 Oct 2026
 *************************************************************************/
 
 GAULFUNC void random_set_state(random_state state)
   {
+  THREAD_LOCK(random_state_lock);
   current_state = state;
+  random_publish_epoch();
+  THREAD_UNLOCK(random_state_lock);
 
   return;
   }
@@ -278,13 +1537,13 @@ GAULFUNC unsigned int random_get_state_str_len(void)
 		This can be used for restoring a saved state.
   parameters:	char *
   return:	none
-  last updated:	28/01/01
+  last updated:	17 Oct 2026
 *************************************************************************/
 
 GAULFUNC void random_set_state_str(char *state)
   {
   /* This causes potential unaligned trap on Alpha CPUs. */
-  current_state = *((random_state *)state);
+  random_set_state(*((random_state *)state));
 
   return;
   }
@@ -317,12 +1576,12 @@ GAULFUNC void random_init(void)
   synopsis:	Whether these routines have been initialised.
   parameters:
   return:	none
-  last updated:	30/12/00
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC boolean random_isinit(void)
   {
-  return is_initialised;
+  return random_current_epoch() != 0;
   }
 
 
@@ -540,73 +1799,47 @@ GAULFUNC double random_unit_uniform(void)
   random_float_gaussian()
   synopsis:	Return a pseudo-random number with a normal
 		distribution with a given mean and standard devaiation.
-  parameters:
-  return:
-  last updated:	4 Dec 2001
+		The deviation of the values returned is actually twice
+		stddev, as it always has been, so that existing callers
+		keep the same spread.  Use mean+stddev*random_float_unit_gaussian()
+		for a deviation of exactly stddev.
+  parameters:	const float mean
+		const float stddev
+  return:	float	Random value.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC float random_float_gaussian(const float mean, const float stddev)
   {
-  float	q,u,v,x,y;
-
-/* 
- * Generate P = (u,v) uniform in rectangular acceptance region.
- */
-  do
-    {
-    u = 1.0f-random_float_unit_uniform();	/* in range 0.0>u>=1.0 */
-    v = 1.7156f * (0.5f - random_float_unit_uniform());	/* in range 0.8578>v>=0.8578 */
-
-/* Evaluate the quadratic form. */
-    x = u - 0.449871f;
-    y = 0.386595f + fabs(v);
-    q = x * x + y * (0.19600f * y - 0.25472f * x);
-
-/*
- * Accept P if inside inner ellipse.
- * Reject P if outside outer ellipse, or outside acceptance region.
- */
-    } while ((q >= 0.27597) && ((q > 0.27846) || (v * v > -4.0 * log(u) * u * u)));
-
-/* Return ratio of P's coordinates as the normal deviate. */
-  return (float)(mean + 2.0 * stddev * v / u);	/* I'm not entirely sure why this *2.0 factor is needed! */
+  return mean + 2.0f*stddev*random_float_unit_gaussian();
   }
 
 
 /**********************************************************************
   random_float_unit_gaussian()
   synopsis:	Random number with normal distribution, average 0.0,
-		deviation 1.0
-  parameters:
-  return:
-  last updated:	07 Jan 2002
+		deviation 1.0, using the Ziggurat method.  A single
+		raw value gives the 24 bits needed for a float.
+  parameters:	none
+  return:	float	Random value.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC float random_float_unit_gaussian(void)
   {
-  float			r, u, v, fac;
-  static boolean	set = FALSE;
-  static float		dset;
-
-  if (set)
-    {
-    set = FALSE;
-    return dset;
-    }
+  unsigned int	r=random_rand();
+  int		layer=r&0x7F;	/* Layer of the ziggurat. */
+  double	u, x;		/* Position within layer. */
 
-  do
-    {
-    u = 2.0f * random_float_unit_uniform() - 1.0f;
-    v = 2.0f * random_float_unit_uniform() - 1.0f;
-    r = u*u + v*v;
-    } while (r >= 1.0);
+  u = (double)((r>>8)&0xFFFFFF)*RANDOM_ZIG_SCALE24;
+  x = u*zig_wn[layer];
 
-  fac = (float)sqrt(-2.0 * log(r) / r);
-  dset = v*fac;
+  if (u >= zig_kn[layer]) x = random_ziggurat_normal_fix(layer, x);
 
-  return u*fac;
+  return (float)((r&0x80) ? -x : x);
   }
 
+
 /* The original (thread-safe) version was this: */
 #if 0
 float random_float_unit_gaussian(void)
@@ -642,15 +1875,31 @@ GAULFUNC float random_float_cauchy(void)
 /**********************************************************************
   random_float_exponential()
   synopsis:	Random number with an exponential distribution, mean
-		of 1.0.
-  parameters:
-  return:
-  last updated:	4 Dec 2001
+		of 1.0, using the Ziggurat method.
+  parameters:	none
+  return:	float	Random value.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC float random_float_exponential(void)
   {
-  return (float) -log(random_float_unit_uniform());
+  unsigned int	r=random_rand();
+  int		layer=r&0xFF;	/* Layer of the ziggurat. */
+  double	u, x;		/* Position within layer. */
+
+  u = (double)((r>>8)&0xFFFFFF)*RANDOM_ZIG_SCALE24;
+  x = u*zig_we[layer];
+
+  if (u < zig_ke[layer]) return (float)x;
+
+  if (layer == 0)
+    return (float)(RANDOM_ZIG_EXP_R - log(random_ziggurat_uniform()));
+
+  if ( zig_fe[layer] + random_ziggurat_uniform()*(zig_fe[layer-1]-zig_fe[layer])
+       < exp(-x) )
+    return (float)x;
+
+  return (float)random_exponential();
   }
 
 
@@ -658,45 +1907,19 @@ GAULFUNC float random_float_exponential(void)
   random_gaussian()
   synopsis:	Return a pseudo-random number with a normal
 		distribution with a given mean and standard devaiation.
-  parameters:
-  return:
-  last updated:	11/01/01
+		The deviation of the values returned is actually twice
+		stddev, as it always has been, so that existing callers
+		keep the same spread.  Use mean+stddev*random_unit_gaussian()
+		for a deviation of exactly stddev.
+  parameters:	const double mean
+		const double stddev
+  return:	double	Random value.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
-/*
-  Kinda based on: (But optimised quite a bit)
-
-  ALGORITHM 712, COLLECTED ALGORITHMS FROM ACM.
-  THIS WORK PUBLISHED IN TRANSACTIONS ON MATHEMATICAL SOFTWARE,
-  VOL. 18, NO. 4, DECEMBER, 1992, PP. 434-435.
-  The algorithm uses the ratio of uniforms method of A.J. Kinderman
-  and J.F. Monahan augmented with quadratic bounding curves.
- */
 GAULFUNC double random_gaussian(const double mean, const double stddev)
   {
-  double	q,u,v,x,y;
-
-/* 
- * Generate P = (u,v) uniform in rectangular acceptance region.
- */
-  do
-    {
-    u = 1.0-random_unit_uniform();	/* in range 0.0>u>=1.0 */
-    v = 1.7156 * (0.5 - random_unit_uniform());	/* in range 0.8578>v>=0.8578 */
-
-/* Evaluate the quadratic form. */
-    x = u - 0.449871;
-    y = fabs(v) + 0.386595;
-    q = x * x + y * (0.19600 * y - 0.25472 * x);
-
-/*
- * Accept P if inside inner ellipse.
- * Reject P if outside outer ellipse, or outside acceptance region.
- */
-    } while ((q >= 0.27597) && ((q > 0.27846) || (v * v > -4.0 * log(u) * u * u)));
-
-/* Return ratio of P's coordinates as the normal deviate. */
-  return (mean + 2.0 * stddev * v / u);	/* I'm not entirely sure why this *2.0 factor is needed! */
+  return mean + 2.0*stddev*random_unit_gaussian();
   }
 
 
@@ -736,37 +1959,21 @@ double random_unit_gaussian(void)
 /**********************************************************************
   random_unit_gaussian()
   synopsis:	Random number with normal distribution, average 0.0,
-		deviation 1.0
-  parameters:
-  return:
-  last updated:	07 Jan 2002
+		deviation 1.0, using the Ziggurat method.
+  parameters:	none
+  return:	double	Random value.
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC double random_unit_gaussian(void)
   {
-  double		r, u, v, fac;
-  static boolean	set = FALSE;
-  static double		dset;
+  unsigned int	hi=random_rand();
+  unsigned int	lo=random_rand();
 
-  if (set)
-    {
-    set = FALSE;
-    return dset;
-    }
-
-  do
-    {
-    u = 2.0 * random_unit_uniform() - 1.0;
-    v = 2.0 * random_unit_uniform() - 1.0;
-    r = u*u + v*v;
-    } while (r >= 1.0);
-
-  fac = sqrt(-2.0 * log(r) / r);
-  dset = v*fac;
-
-  return u*fac;
+  return random_ziggurat_normal(hi, lo);
   }
 
+
 /* The original (thread-safe) version was this: */
 #if 0
 double random_unit_gaussian(void)
@@ -802,15 +2009,18 @@ GAULFUNC double random_cauchy(void)
 /**********************************************************************
   random_exponential()
   synopsis:	Random number with an exponential distribution, mean
-		of 1.0.
+		of 1.0, using the Ziggurat method.
   parameters:	none
   return:	double	Random value.
-  last updated:	30/04/01
+  last updated:	17 Oct 2026
  **********************************************************************/
 
 GAULFUNC double random_exponential(void)
   {
-  return -log(random_unit_uniform());
+  unsigned int	hi=random_rand();
+  unsigned int	lo=random_rand();
+
+  return random_ziggurat_exponential(hi, lo);
   }
 
 
@@ -872,6 +2082,7 @@ GAULFUNC void random_diagnostics(void)
   printf("--------------------------------------------------------------\n");
   printf("structure                  sizeof\n");
   printf("random_state:              %lu\n", (unsigned long) sizeof(random_state));
+  printf("random_stream:             %lu\n", (unsigned long) sizeof(random_stream));
   printf("--------------------------------------------------------------\n");
 
   if (is_initialised)